@@ -0,0 +1,1104 @@
+// dear imgui: "null" benchmark application
+// (compile and link imgui, run scripted scenarios headless with NO INPUTS, NO GRAPHICS OUTPUT, and report timings as JSON)
+// This is useful to track performance regressions, e.g. compare outputs of two builds in a CI setup.
+// Build with optimizations! (the Makefile uses -O2)
+
+// Usage:
+//   example_null_benchmark [--micro] [--frames N] [--warmup N] [--scenario NAME] [--profile] [--output FILE] [--baseline FILE [--threshold [NAME=]PERCENT]...]
+//   example_null_benchmark --scenario NAME [--record FILE | --replay FILE] [...]
+//   example_null_benchmark [--golden-save FILE | --golden-compare FILE [--golden-tolerance F]] [...]
+// - Each scenario runs in its own context: 'warmup' frames are run first, then 'frames' frames are measured.
+// - Phases: NewFrame(), submitting UI ("submit"), Render() (including EndFrame()).
+// - Allocations are counted with SetAllocatorFunctions(), they include everything allocated by ImGui during measured frames.
+// - --profile: also report profiler zones (see Metrics->Profiler) as ns/frame. This adds a little overhead to other timings.
+// - --micro: run microbenchmarks of core functions instead of scenarios. 'frames' and 'warmup' are numbers of repetitions.
+// - --baseline: compare median times with an output file of a previous run. Exit code is 2 if any of them is slower by more
+//   than the threshold (default: 10%). '--threshold NAME=PERCENT' sets the threshold of one scenario/microbenchmark.
+//   Timings are only comparable on the same machine, and you may want to use higher thresholds on shared CI machines.
+// - --record/--replay: record the inputs of a scenario into a file, or replay them (see misc/cpp/imgui_replay.h).
+//   When replaying, the number of frames comes from the file and the slowest frames are reported, so a recording of
+//   a slowdown can be profiled and bisected. Exit code is 3 if replayed frames are not identical to recorded ones.
+//   Your own application can record with ImGuiReplay, and replay with a copy of this program submitting your UI.
+// - --golden-save/--golden-compare: save ImDrawData of measured frames into a file, or compare them with a file saved by
+//   a previous build (see misc/cpp/imgui_drawgolden.h), to verify that optimizations of imgui_draw.cpp didn't change
+//   the output. Exit code is 4 if they differ (beyond --golden-tolerance, default: 0), the first divergence is reported.
+//   Use the same --frames/--warmup/--scenario arguments (checked before running) and a small number of frames: each
+//   frame is stored entirely.
+// - JSON is written to stdout (or FILE), progress and comparison to stderr.
+
+#include "imgui.h"
+#include "imgui_internal.h"     // Profiler
+#include "misc/cpp/imgui_drawgolden.h"
+#include "misc/cpp/imgui_replay.h"
+#include <stdio.h>
+#include <stdlib.h>             // malloc, free, qsort
+#include <string.h>             // strcmp
+#include <chrono>
+
+//-----------------------------------------------------------------------------
+// Allocation counting
+//-----------------------------------------------------------------------------
+
+struct BenchAllocStats
+{
+    ImU64   AllocCount;
+    ImU64   AllocBytes;
+    ImU64   FreeCount;
+};
+static BenchAllocStats g_AllocStats;
+
+static void* BenchMallocWrapper(size_t size, void*)   { g_AllocStats.AllocCount++; g_AllocStats.AllocBytes += size; return malloc(size); }
+static void  BenchFreeWrapper(void* ptr, void*)       { if (ptr != nullptr) g_AllocStats.FreeCount++; free(ptr); }
+
+static ImU64 BenchGetTimeNs()
+{
+    return (ImU64)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+//-----------------------------------------------------------------------------
+// Scenarios
+//-----------------------------------------------------------------------------
+
+struct BenchScenario
+{
+    const char* Name;
+    const char* Desc;
+    void        (*Setup)();             // Called once after creating context (optional)
+    void        (*PreFrame)(int frame); // Called before NewFrame(), e.g. to submit inputs (optional)
+    void        (*Submit)(int frame);   // Called between NewFrame() and Render()
+    void        (*Shutdown)();          // Called before destroying context (optional)
+};
+
+// Deterministic pseudo-random numbers, so all runs submit the same data
+static unsigned int g_RandomSeed = 1;
+static float BenchRandom(float max) { g_RandomSeed = g_RandomSeed * 1664525u + 1013904223u; return (float)(g_RandomSeed >> 8) / (float)(1 << 24) * max; }
+
+static void BeginFullscreenWindow(const char* name)
+{
+    const ImGuiViewport* viewport = ImGui::GetMainViewport();
+    ImGui::SetNextWindowPos(viewport->Pos);
+    ImGui::SetNextWindowSize(viewport->Size);
+    ImGui::Begin(name, nullptr, ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoSavedSettings);
+}
+
+// Thousands of buttons and labels, without clipper
+static void Scenario_ButtonsLabels_Submit(int)
+{
+    BeginFullscreenWindow("Buttons and Labels");
+    for (int n = 0; n < 5000; n++)
+    {
+        if (n % 10 != 0)
+            ImGui::SameLine();
+        ImGui::PushID(n);
+        if (n & 1)
+            ImGui::Text("Label %d", n);
+        else
+            ImGui::Button("Button");
+        ImGui::PopID();
+    }
+    ImGui::End();
+}
+
+// Big table with clipper, scrolling every frame
+static void Scenario_TableClipper_Submit(int frame)
+{
+    BeginFullscreenWindow("Table");
+    const int ROWS_COUNT = 100000;
+    const ImGuiTableFlags flags = ImGuiTableFlags_ScrollY | ImGuiTableFlags_RowBg | ImGuiTableFlags_Borders | ImGuiTableFlags_Resizable | ImGuiTableFlags_Reorderable | ImGuiTableFlags_Hideable;
+    if (ImGui::BeginTable("table", 6, flags))
+    {
+        ImGui::TableSetupScrollFreeze(0, 1);
+        ImGui::TableSetupColumn("ID");
+        ImGui::TableSetupColumn("Name");
+        ImGui::TableSetupColumn("Value");
+        ImGui::TableSetupColumn("Ratio");
+        ImGui::TableSetupColumn("Flags");
+        ImGui::TableSetupColumn("Action");
+        ImGui::TableHeadersRow();
+        ImGui::SetScrollY((float)((frame * 997) % ROWS_COUNT) * ImGui::GetTextLineHeightWithSpacing());
+        ImGuiListClipper clipper;
+        clipper.Begin(ROWS_COUNT);
+        while (clipper.Step())
+            for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; row++)
+            {
+                ImGui::PushID(row);
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn(); ImGui::Text("%06d", row);
+                ImGui::TableNextColumn(); ImGui::TextUnformatted("Item name");
+                ImGui::TableNextColumn(); ImGui::Text("%d", row * 7);
+                ImGui::TableNextColumn(); ImGui::Text("%.3f", (float)row / ROWS_COUNT);
+                ImGui::TableNextColumn(); ImGui::Text("0x%04X", row & 0xFFFF);
+                ImGui::TableNextColumn(); ImGui::SmallButton("Edit");
+                ImGui::PopID();
+            }
+        ImGui::EndTable();
+    }
+    ImGui::End();
+}
+
+// Long log displayed with a single TextUnformatted() call, scrolling every frame
+static ImGuiTextBuffer* g_LogText = nullptr;
+static void Scenario_TextLog_Setup()
+{
+    g_LogText = IM_NEW(ImGuiTextBuffer)();
+    for (int n = 0; n < 100000; n++)
+        g_LogText->appendf("[%05d] [info] Some message of a long log, with a value: %d\n", n, n * 13);
+}
+static void Scenario_TextLog_Submit(int frame)
+{
+    BeginFullscreenWindow("Log");
+    ImGui::BeginChild("log", ImVec2(0, 0), ImGuiChildFlags_None, ImGuiWindowFlags_HorizontalScrollbar);
+    ImGui::TextUnformatted(g_LogText->begin(), g_LogText->end());
+    ImGui::SetScrollY(ImGui::GetScrollMaxY() * (float)(frame % 100) / 100.0f);
+    ImGui::EndChild();
+    ImGui::End();
+}
+static void Scenario_TextLog_Shutdown()
+{
+    IM_DELETE(g_LogText);
+    g_LogText = nullptr;
+}
+
+// Many ImDrawList primitives
+static void Scenario_DrawList_Submit(int)
+{
+    BeginFullscreenWindow("DrawList");
+    ImDrawList* draw_list = ImGui::GetWindowDrawList();
+    const ImVec2 size = ImGui::GetWindowSize();
+    const ImU32 col = IM_COL32(255, 200, 100, 255);
+    g_RandomSeed = 1;
+    for (int n = 0; n < 2000; n++)
+    {
+        ImVec2 p(BenchRandom(size.x), BenchRandom(size.y));
+        draw_list->AddLine(p, ImVec2(p.x + 50.0f, p.y + 20.0f), col, 2.0f);
+        draw_list->AddRect(p, ImVec2(p.x + 30.0f, p.y + 20.0f), col, 4.0f, 0, 1.5f);
+        draw_list->AddRectFilled(p, ImVec2(p.x + 10.0f, p.y + 10.0f), col);
+        draw_list->AddCircle(p, 15.0f, col);
+        draw_list->AddCircleFilled(p, 8.0f, col);
+        draw_list->AddBezierCubic(p, ImVec2(p.x + 20.0f, p.y - 40.0f), ImVec2(p.x + 40.0f, p.y + 40.0f), ImVec2(p.x + 60.0f, p.y), col, 1.0f);
+        draw_list->AddText(p, col, "Some text");
+        ImVec2 points[16];
+        for (int i = 0; i < IM_ARRAYSIZE(points); i++)
+            points[i] = ImVec2(p.x + i * 4.0f, p.y + ((i & 1) ? 10.0f : 0.0f));
+        draw_list->AddPolyline(points, IM_ARRAYSIZE(points), col, ImDrawFlags_None, 1.0f);
+        draw_list->AddNgonFilled(p, 12.0f, col, 6);
+    }
+    ImGui::End();
+}
+
+// InputTextMultiline() with a large buffer, active and receiving a character every frame
+static ImVector<char>* g_InputTextBuf = nullptr;
+static void Scenario_InputText_Setup()
+{
+    ImGuiTextBuffer text;
+    for (int n = 0; n < 10000; n++)
+        text.appendf("Line %05d: The quick brown fox jumps over the lazy dog.\n", n);
+    g_InputTextBuf = IM_NEW(ImVector<char>)();
+    g_InputTextBuf->resize(text.size() * 2);
+    memcpy(g_InputTextBuf->Data, text.c_str(), (size_t)text.size() + 1);
+}
+static void Scenario_InputText_PreFrame(int frame)
+{
+    if (frame > 0)
+        ImGui::GetIO().AddInputCharacter((unsigned int)('a' + (frame % 26)));
+}
+static void Scenario_InputText_Submit(int frame)
+{
+    BeginFullscreenWindow("InputText");
+    if (frame == 0)
+        ImGui::SetKeyboardFocusHere();
+    ImGui::InputTextMultiline("##text", g_InputTextBuf->Data, (size_t)g_InputTextBuf->Size, ImVec2(-FLT_MIN, -FLT_MIN));
+    ImGui::End();
+}
+static void Scenario_InputText_Shutdown()
+{
+    IM_DELETE(g_InputTextBuf);
+    g_InputTextBuf = nullptr;
+}
+
+// Build a font atlas with several fonts every frame
+static void Scenario_FontAtlas_Submit(int)
+{
+    ImFontAtlas* atlas = IM_NEW(ImFontAtlas)();
+    const float sizes[] = { 13.0f, 16.0f, 20.0f, 32.0f };
+    for (float size : sizes)
+    {
+        ImFontConfig font_cfg;
+        font_cfg.SizePixels = size;
+        atlas->AddFontDefault(&font_cfg);
+    }
+    unsigned char* tex_pixels = nullptr;
+    int tex_w, tex_h;
+    atlas->GetTexDataAsRGBA32(&tex_pixels, &tex_w, &tex_h);
+    IM_DELETE(atlas);
+}
+
+// Demo window, as a "typical" UI
+static void Scenario_DemoWindow_Submit(int)
+{
+    ImGui::ShowDemoWindow(nullptr);
+}
+
+static const BenchScenario g_Scenarios[] =
+{
+    { "buttons_labels",     "5000 buttons and labels, no clipper",                  nullptr,                    nullptr,                        Scenario_ButtonsLabels_Submit,  nullptr },
+    { "table_clipper",      "100000 rows x 6 columns table with clipper, scrolling", nullptr,                   nullptr,                        Scenario_TableClipper_Submit,   nullptr },
+    { "text_log",           "100000 lines log with TextUnformatted(), scrolling",   Scenario_TextLog_Setup,     nullptr,                        Scenario_TextLog_Submit,        Scenario_TextLog_Shutdown },
+    { "drawlist_primitives","2000 x 9 ImDrawList primitives",                       nullptr,                    nullptr,                        Scenario_DrawList_Submit,       nullptr },
+    { "input_text_multiline","Active InputTextMultiline() with 560 KB of text",     Scenario_InputText_Setup,   Scenario_InputText_PreFrame,    Scenario_InputText_Submit,      Scenario_InputText_Shutdown },
+    { "font_atlas_build",   "Build an atlas of 4 fonts",                            nullptr,                    nullptr,                        Scenario_FontAtlas_Submit,      nullptr },
+    { "demo_window",        "ShowDemoWindow()",                                     nullptr,                    nullptr,                        Scenario_DemoWindow_Submit,     nullptr },
+};
+
+//-----------------------------------------------------------------------------
+// Microbenchmarks
+//-----------------------------------------------------------------------------
+// Each repetition calls Run() with 'OpsPerRep' operations, and we report ns per operation.
+// Data is prepared by MicroSetup() in a context which has started a frame, so fonts and ImDrawListSharedData are ready.
+
+struct BenchMicro
+{
+    const char* Name;
+    const char* Desc;
+    int         OpsPerRep;
+    void        (*Run)(int ops);
+};
+
+static volatile ImU32   g_MicroSink;            // Write results here so they are not optimized away
+static char             g_MicroLabels[16][32];
+static ImVector<char>   g_MicroText;            // ~4 KB of ASCII and UTF-8 text, zero-terminated
+static ImVector<ImGuiID> g_MicroKeys;
+static ImGuiStorage*    g_MicroStorage = nullptr;
+static ImDrawList*      g_MicroDrawList = nullptr;
+static ImVec2           g_MicroPolyline[100];
+static ImVec2           g_MicroConvexPoly[64];
+static ImVec2           g_MicroConcavePoly[64];
+static int              g_MicroInts[1000];
+static int              g_MicroIntsSorted[1000];
+
+static void MicroSetup()
+{
+    g_RandomSeed = 1;
+    for (int n = 0; n < IM_ARRAYSIZE(g_MicroLabels); n++)
+        ImFormatString(g_MicroLabels[n], IM_ARRAYSIZE(g_MicroLabels[n]), "Label %d##%08X", n, (unsigned int)BenchRandom(1e9f));
+
+    ImGuiTextBuffer text;
+    while (text.size() < 4096)
+        text.append("The quick brown fox jumps over the lazy dog. \xC3\xA9t\xC3\xA9, \xE6\x97\xA5\xE6\x9C\xAC\xE8\xAA\x9E, \xD0\x9F\xD1\x80\xD0\xB8\xD0\xB2\xD0\xB5\xD1\x82.\n");
+    g_MicroText.resize(text.size() + 1);
+    memcpy(g_MicroText.Data, text.c_str(), (size_t)text.size() + 1);
+
+    g_MicroKeys.resize(10000);
+    g_MicroStorage = IM_NEW(ImGuiStorage)();
+    for (int n = 0; n < g_MicroKeys.Size; n++)
+    {
+        g_MicroKeys[n] = ImHashStr(g_MicroLabels[n % IM_ARRAYSIZE(g_MicroLabels)], 0, (ImGuiID)n);
+        g_MicroStorage->SetInt(g_MicroKeys[n], n);
+    }
+
+    g_MicroDrawList = IM_NEW(ImDrawList)(ImGui::GetDrawListSharedData());
+    for (int n = 0; n < IM_ARRAYSIZE(g_MicroPolyline); n++)
+        g_MicroPolyline[n] = ImVec2(100.0f + n * 8.0f, 100.0f + BenchRandom(200.0f));
+    for (int n = 0; n < IM_ARRAYSIZE(g_MicroConvexPoly); n++)
+    {
+        const float a = (float)n / IM_ARRAYSIZE(g_MicroConvexPoly) * 2.0f * IM_PI;
+        const float r = (n & 1) ? 40.0f : 100.0f;
+        g_MicroConvexPoly[n] = ImVec2(500.0f + ImCos(a) * 100.0f, 500.0f + ImSin(a) * 100.0f);
+        g_MicroConcavePoly[n] = ImVec2(500.0f + ImCos(a) * r, 500.0f + ImSin(a) * r);
+    }
+    for (int n = 0; n < IM_ARRAYSIZE(g_MicroInts); n++)
+        g_MicroInts[n] = (int)BenchRandom(1e6f);
+}
+
+static void MicroShutdown()
+{
+    g_MicroText.clear();
+    g_MicroKeys.clear();
+    IM_DELETE(g_MicroStorage);
+    IM_DELETE(g_MicroDrawList);
+    g_MicroStorage = nullptr;
+    g_MicroDrawList = nullptr;
+}
+
+static void MicroResetDrawList()
+{
+    g_MicroDrawList->_ResetForNewFrame();
+    g_MicroDrawList->PushClipRectFullScreen();
+    g_MicroDrawList->PushTextureID(ImGui::GetIO().Fonts->TexID);
+}
+
+static int IMGUI_CDECL CompareInt(const void* lhs, const void* rhs)
+{
+    return *(const int*)lhs - *(const int*)rhs;
+}
+
+static void Micro_HashStrLabel(int ops)
+{
+    ImGuiID seed = 0;
+    for (int n = 0; n < ops; n++)
+        seed = ImHashStr(g_MicroLabels[n & 15], 0, seed);
+    g_MicroSink = seed;
+}
+static void Micro_HashStr4KB(int ops)
+{
+    for (int n = 0; n < ops; n++)
+        g_MicroSink = ImHashStr(g_MicroText.Data, (size_t)g_MicroText.Size - 1, (ImGuiID)n);
+}
+static void Micro_StorageGetInt(int ops)
+{
+    int sum = 0;
+    for (int n = 0; n < ops; n++)
+        sum += g_MicroStorage->GetInt(g_MicroKeys[n % g_MicroKeys.Size]);
+    g_MicroSink = (ImU32)sum;
+}
+static void Micro_StorageSetInt(int ops)
+{
+    ImGuiStorage storage;
+    for (int n = 0; n < ops; n++)
+        storage.SetInt(g_MicroKeys[n % g_MicroKeys.Size], n);
+    g_MicroSink = (ImU32)storage.Data.Size;
+}
+static void Micro_CalcTextSizeShort(int ops)
+{
+    ImFont* font = ImGui::GetFont();
+    float w = 0.0f;
+    for (int n = 0; n < ops; n++)
+        w += font->CalcTextSizeA(font->FontSize, FLT_MAX, 0.0f, g_MicroLabels[n & 15]).x;
+    g_MicroSink = (ImU32)w;
+}
+static void Micro_CalcTextSizeWrapped(int ops)
+{
+    ImFont* font = ImGui::GetFont();
+    float h = 0.0f;
+    for (int n = 0; n < ops; n++)
+        h += font->CalcTextSizeA(font->FontSize, FLT_MAX, 400.0f, g_MicroText.Data).y;
+    g_MicroSink = (ImU32)h;
+}
+static void Micro_TextCharFromUtf8(int ops)
+{
+    unsigned int sum = 0;
+    const char* text_end = g_MicroText.Data + g_MicroText.Size - 1;
+    for (int n = 0; n < ops; n++)
+        for (const char* p = g_MicroText.Data; p < text_end; )
+        {
+            unsigned int c;
+            p += ImTextCharFromUtf8(&c, p, text_end);
+            sum += c;
+        }
+    g_MicroSink = sum;
+}
+static void Micro_AddPolylineThin(int ops)
+{
+    MicroResetDrawList();
+    for (int n = 0; n < ops; n++)
+        g_MicroDrawList->AddPolyline(g_MicroPolyline, IM_ARRAYSIZE(g_MicroPolyline), IM_COL32_WHITE, ImDrawFlags_None, 1.0f);
+}
+static void Micro_AddPolylineThick(int ops)
+{
+    MicroResetDrawList();
+    for (int n = 0; n < ops; n++)
+        g_MicroDrawList->AddPolyline(g_MicroPolyline, IM_ARRAYSIZE(g_MicroPolyline), IM_COL32_WHITE, ImDrawFlags_None, 4.5f);
+}
+static void Micro_AddConvexPolyFilled(int ops)
+{
+    MicroResetDrawList();
+    for (int n = 0; n < ops; n++)
+        g_MicroDrawList->AddConvexPolyFilled(g_MicroConvexPoly, IM_ARRAYSIZE(g_MicroConvexPoly), IM_COL32_WHITE);
+}
+static void Micro_AddConcavePolyFilled(int ops)
+{
+    MicroResetDrawList();
+    for (int n = 0; n < ops; n++)
+        g_MicroDrawList->AddConcavePolyFilled(g_MicroConcavePoly, IM_ARRAYSIZE(g_MicroConcavePoly), IM_COL32_WHITE);
+}
+static void Micro_PathArcTo(int ops)
+{
+    MicroResetDrawList();
+    for (int n = 0; n < ops; n++)
+    {
+        g_MicroDrawList->PathArcTo(ImVec2(500.0f, 500.0f), 20.0f + (n & 63), 0.0f, IM_PI * 1.5f);
+        g_MicroSink = (ImU32)g_MicroDrawList->_Path.Size;
+        g_MicroDrawList->PathClear();
+    }
+}
+static void Micro_FormatString(int ops)
+{
+    char buf[256];
+    int len = 0;
+    for (int n = 0; n < ops; n++)
+        len += ImFormatString(buf, IM_ARRAYSIZE(buf), "%s: %d (%.3f)", g_MicroLabels[n & 15], n, n * 0.5f);
+    g_MicroSink = (ImU32)len;
+}
+static void Micro_Stristr(int ops)
+{
+    const char* text_end = g_MicroText.Data + g_MicroText.Size - 1;
+    const char* needle = "LAZY CAT";
+    for (int n = 0; n < ops; n++)
+        g_MicroSink = (ImStristr(g_MicroText.Data, text_end, needle, needle + strlen(needle)) != nullptr) ? 1 : 0;
+}
+static void Micro_QsortInts(int ops)
+{
+    for (int n = 0; n < ops; n++)
+    {
+        memcpy(g_MicroIntsSorted, g_MicroInts, sizeof(g_MicroInts));
+        ImQsort(g_MicroIntsSorted, IM_ARRAYSIZE(g_MicroIntsSorted), sizeof(int), CompareInt);
+    }
+    g_MicroSink = (ImU32)g_MicroIntsSorted[0];
+}
+static void Micro_StorageBuildSortByKey(int ops)
+{
+    ImGuiStorage storage;
+    storage.Data.reserve(1000);
+    for (int n = 0; n < ops; n++)
+    {
+        storage.Data.resize(0);
+        for (int i = 0; i < 1000; i++)
+            storage.Data.push_back(ImGuiStoragePair(g_MicroKeys[i], i));
+        storage.BuildSortByKey();
+    }
+    g_MicroSink = storage.Data[0].key;
+}
+
+static const BenchMicro g_Micros[] =
+{
+    { "ImHashStr_label",                "ImHashStr() on a ~20 characters label",                    10000,  Micro_HashStrLabel },
+    { "ImHashStr_4KB",                  "ImHashStr() on 4 KB of text",                              10,     Micro_HashStr4KB },
+    { "ImGuiStorage_GetInt",            "GetInt() in a storage of 10000 keys",                      10000,  Micro_StorageGetInt },
+    { "ImGuiStorage_SetInt",            "SetInt() inserting 1000 keys in an empty storage",         1000,   Micro_StorageSetInt },
+    { "ImGuiStorage_BuildSortByKey",    "BuildSortByKey() of 1000 pairs (ImQsort)",                 10,     Micro_StorageBuildSortByKey },
+    { "ImQsort_ints",                   "ImQsort() of 1000 ints",                                   10,     Micro_QsortInts },
+    { "CalcTextSizeA_label",            "ImFont::CalcTextSizeA() on a ~20 characters label",        10000,  Micro_CalcTextSizeShort },
+    { "CalcTextSizeA_4KB_wrapped",      "ImFont::CalcTextSizeA() on 4 KB of text, wrapped at 400",  10,     Micro_CalcTextSizeWrapped },
+    { "ImTextCharFromUtf8_4KB",         "ImTextCharFromUtf8() over 4 KB of text",                   10,     Micro_TextCharFromUtf8 },
+    { "AddPolyline_aa_thin",            "AddPolyline() 100 points, thickness 1.0, anti-aliased",    100,    Micro_AddPolylineThin },
+    { "AddPolyline_aa_thick",           "AddPolyline() 100 points, thickness 4.5, anti-aliased",    100,    Micro_AddPolylineThick },
+    { "AddConvexPolyFilled",            "AddConvexPolyFilled() 64 points, anti-aliased",            100,    Micro_AddConvexPolyFilled },
+    { "AddConcavePolyFilled",           "AddConcavePolyFilled() 64 points star, anti-aliased",      100,    Micro_AddConcavePolyFilled },
+    { "PathArcTo",                      "PathArcTo() 3/4 of a circle, radius 20..83",               1000,   Micro_PathArcTo },
+    { "ImFormatString",                 "ImFormatString() with a string, an int and a float",       1000,   Micro_FormatString },
+    { "ImStristr_4KB",                  "ImStristr() not finding a needle in 4 KB of text",         10,     Micro_Stristr },
+};
+
+//-----------------------------------------------------------------------------
+// Measurement
+//-----------------------------------------------------------------------------
+
+struct BenchZoneTotal
+{
+    const char* Name;
+    ImU64       Time;
+};
+
+// Frame index and time, when replaying
+struct BenchFrameTime
+{
+    int         Frame;
+    ImU64       Time;
+};
+
+struct BenchResult
+{
+    int         Frames;
+    ImU64       TimeNewFrame;
+    ImU64       TimeSubmit;
+    ImU64       TimeRender;
+    ImVector<ImU64> TimeTotalPerFrame;
+    ImU64       VtxCount;
+    ImU64       IdxCount;
+    ImU64       CmdCount;
+    ImU64       AllocCount;
+    ImU64       AllocBytes;
+    ImVector<BenchZoneTotal> Zones;
+    ImVector<BenchFrameTime> SlowestFrames;     // When replaying
+    int         HashMismatchCount;              // When replaying
+    int         FirstHashMismatchFrame;
+};
+
+enum BenchReplayMode
+{
+    BenchReplayMode_None,
+    BenchReplayMode_Record,
+    BenchReplayMode_Replay,
+};
+
+// Scenarios use BenchRandom(): record its state so replayed frames are identical
+static void BenchSaveAppState(ImGuiReplay*, ImVector<char>* out_data)
+{
+    const char* p = (const char*)&g_RandomSeed;
+    for (size_t n = 0; n < sizeof(g_RandomSeed); n++)
+        out_data->push_back(p[n]);
+}
+static void BenchLoadAppState(ImGuiReplay*, const char* data, int data_size)
+{
+    if (data_size == (int)sizeof(g_RandomSeed))
+        memcpy(&g_RandomSeed, data, sizeof(g_RandomSeed));
+}
+
+static int IMGUI_CDECL CompareFrameTimeDesc(const void* lhs, const void* rhs)
+{
+    const ImU64 a = ((const BenchFrameTime*)lhs)->Time;
+    const ImU64 b = ((const BenchFrameTime*)rhs)->Time;
+    return (a > b) ? -1 : (a < b) ? +1 : 0;
+}
+
+static int IMGUI_CDECL CompareU64(const void* lhs, const void* rhs)
+{
+    const ImU64 a = *(const ImU64*)lhs;
+    const ImU64 b = *(const ImU64*)rhs;
+    return (a < b) ? -1 : (a > b) ? +1 : 0;
+}
+
+static void AccumulateProfilerZones(BenchResult* result)
+{
+    const ImGuiProfilerFrame* frame = ImGui::ProfilerGetFrame(0);
+    if (frame == nullptr)
+        return;
+    for (const ImGuiProfilerZone& zone : frame->Zones)
+    {
+        BenchZoneTotal* total = nullptr;
+        for (BenchZoneTotal& it : result->Zones)
+            if (strcmp(it.Name, zone.Name) == 0)
+                total = &it;
+        if (total == nullptr)
+        {
+            BenchZoneTotal new_total = { zone.Name, 0 };
+            result->Zones.push_back(new_total);
+            total = &result->Zones.back();
+        }
+        total->Time += zone.TimeTotal;
+    }
+}
+
+// Label of measured frames stored with --golden-save, also used to check arguments of --golden-compare
+static void FormatGoldenLabel(char* buf, int buf_size, const BenchScenario* scenario, int frame_n, int warmup_frames)
+{
+    ImFormatString(buf, (size_t)buf_size, "%s:%d (warmup %d)", scenario->Name, frame_n, warmup_frames);
+}
+
+static bool CheckGoldenReference(const ImGuiDrawGolden* reference, const char* filename, const ImVector<const BenchScenario*>& scenarios, int warmup_frames, int frames)
+{
+    int frame_idx = 0;
+    for (const BenchScenario* scenario : scenarios)
+        for (int n = 0; n < frames; n++, frame_idx++)
+        {
+            char label[64];
+            FormatGoldenLabel(label, IM_ARRAYSIZE(label), scenario, n, warmup_frames);
+            const char* ref_label = "";
+            const char* ref_label_end = ref_label;
+            if (frame_idx < reference->GetFramesCount())
+                reference->GetFrameLabel(frame_idx, &ref_label, &ref_label_end);
+            if (strlen(label) != (size_t)(ref_label_end - ref_label) || memcmp(label, ref_label, strlen(label)) != 0)
+            {
+                fprintf(stderr, "'%s' was saved with different --scenario/--frames/--warmup arguments: frame %d is '%.*s', expected '%s'.\n", filename, frame_idx, (int)(ref_label_end - ref_label), ref_label, label);
+                return false;
+            }
+        }
+    if (frame_idx != reference->GetFramesCount())
+    {
+        fprintf(stderr, "'%s' was saved with different --scenario/--frames/--warmup arguments: %d frames, expected %d.\n", filename, reference->GetFramesCount(), frame_idx);
+        return false;
+    }
+    return true;
+}
+
+static void RunScenario(const BenchScenario* scenario, int warmup_frames, int frames, bool profile, BenchReplayMode replay_mode, ImGuiReplay* replay, ImGuiDrawGolden* golden, BenchResult* result)
+{
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = nullptr;
+    io.DisplaySize = ImVec2(1920, 1080);
+    io.DeltaTime = 1.0f / 60.0f;
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset; // Like most renderer backends, allow large meshes (e.g. drawlist_primitives)
+    unsigned char* tex_pixels = nullptr;
+    int tex_w, tex_h;
+    io.Fonts->GetTexDataAsRGBA32(&tex_pixels, &tex_w, &tex_h);
+    GImGui->Profiler.Enabled = profile;
+    if (scenario->Setup)
+        scenario->Setup();
+    if (replay_mode == BenchReplayMode_Record)
+    {
+        replay->SaveAppStateFunc = BenchSaveAppState;
+        replay->StartRecording();
+    }
+    else if (replay_mode == BenchReplayMode_Replay)
+    {
+        // Inputs come from the recording, PreFrame() is not called
+        replay->LoadAppStateFunc = BenchLoadAppState;
+        replay->StartReplay();
+        IM_ASSERT(warmup_frames + frames == replay->GetFramesCount());
+    }
+
+    result->Frames = frames;
+    for (int n = 0; n < warmup_frames + frames; n++)
+    {
+        const bool measure = (n >= warmup_frames);
+        if (scenario->PreFrame && replay_mode != BenchReplayMode_Replay)
+            scenario->PreFrame(n);
+        const BenchAllocStats alloc_stats_begin = g_AllocStats;
+        const ImU64 t0 = BenchGetTimeNs();
+        ImGui::NewFrame();
+        const ImU64 t1 = BenchGetTimeNs();
+        scenario->Submit(n);
+        const ImU64 t2 = BenchGetTimeNs();
+        ImGui::Render();
+        const ImU64 t3 = BenchGetTimeNs();
+        if (!measure)
+            continue;
+
+        // Profiler zones of previous frame (completed by NewFrame() of this frame)
+        if (profile && n > warmup_frames)
+            AccumulateProfilerZones(result);
+
+        result->TimeNewFrame += t1 - t0;
+        result->TimeSubmit += t2 - t1;
+        result->TimeRender += t3 - t2;
+        result->TimeTotalPerFrame.push_back(t3 - t0);
+        if (replay_mode == BenchReplayMode_Replay)
+        {
+            BenchFrameTime frame_time = { n, t3 - t0 };
+            result->SlowestFrames.push_back(frame_time);
+        }
+        ImDrawData* draw_data = ImGui::GetDrawData();
+        result->VtxCount += (ImU64)draw_data->TotalVtxCount;
+        result->IdxCount += (ImU64)draw_data->TotalIdxCount;
+        for (ImDrawList* draw_list : draw_data->CmdLists)
+            result->CmdCount += (ImU64)draw_list->CmdBuffer.Size;
+        result->AllocCount += g_AllocStats.AllocCount - alloc_stats_begin.AllocCount;
+        result->AllocBytes += g_AllocStats.AllocBytes - alloc_stats_begin.AllocBytes;
+
+        if (golden != nullptr)
+        {
+            char label[64];
+            FormatGoldenLabel(label, IM_ARRAYSIZE(label), scenario, n - warmup_frames, warmup_frames);
+            golden->CaptureFrame(draw_data, label);
+        }
+    }
+
+    qsort(result->TimeTotalPerFrame.Data, (size_t)result->TimeTotalPerFrame.Size, sizeof(ImU64), CompareU64);
+    if (replay_mode == BenchReplayMode_Record)
+    {
+        replay->StopRecording();
+    }
+    else if (replay_mode == BenchReplayMode_Replay)
+    {
+        replay->StopReplay();
+        result->HashMismatchCount = replay->HashMismatchCount;
+        result->FirstHashMismatchFrame = replay->FirstHashMismatchFrame;
+        qsort(result->SlowestFrames.Data, (size_t)result->SlowestFrames.Size, sizeof(BenchFrameTime), CompareFrameTimeDesc);
+        result->SlowestFrames.resize(ImMin(result->SlowestFrames.Size, 10));
+    }
+
+    if (scenario->Shutdown)
+        scenario->Shutdown();
+    ImGui::DestroyContext();
+}
+
+// Median of sorted values
+static double GetMedian(const ImVector<ImU64>& sorted_values)
+{
+    return (double)sorted_values[sorted_values.Size / 2];
+}
+
+static void WriteResultJson(FILE* f, const BenchScenario* scenario, BenchResult* result, bool last)
+{
+    const double frames = (double)result->Frames;
+    const ImVector<ImU64>& totals = result->TimeTotalPerFrame;
+    fprintf(f, "    {\n");
+    fprintf(f, "      \"name\": \"%s\",\n", scenario->Name);
+    fprintf(f, "      \"desc\": \"%s\",\n", scenario->Desc);
+    fprintf(f, "      \"frames\": %d,\n", result->Frames);
+    fprintf(f, "      \"ns_per_frame\": { \"new_frame\": %.0f, \"submit\": %.0f, \"render\": %.0f, \"total\": %.0f },\n",
+        result->TimeNewFrame / frames, result->TimeSubmit / frames, result->TimeRender / frames, (result->TimeNewFrame + result->TimeSubmit + result->TimeRender) / frames);
+    fprintf(f, "      \"total_ns\": { \"min\": %llu, \"median\": %llu, \"p99\": %llu, \"max\": %llu },\n",
+        (unsigned long long)totals[0], (unsigned long long)GetMedian(totals), (unsigned long long)totals[(totals.Size * 99) / 100], (unsigned long long)totals.back());
+    fprintf(f, "      \"vertices_per_frame\": %.0f,\n", result->VtxCount / frames);
+    fprintf(f, "      \"indices_per_frame\": %.0f,\n", result->IdxCount / frames);
+    fprintf(f, "      \"draw_cmds_per_frame\": %.0f,\n", result->CmdCount / frames);
+    fprintf(f, "      \"allocs_per_frame\": %.2f,\n", result->AllocCount / frames);
+    fprintf(f, "      \"alloc_bytes_per_frame\": %.0f", result->AllocBytes / frames);
+    if (!result->Zones.empty())
+    {
+        // Zones are accumulated for one frame less than other timings
+        fprintf(f, ",\n      \"zones_ns_per_frame\": {");
+        for (const BenchZoneTotal& zone : result->Zones)
+            fprintf(f, "%s \"%s\": %.0f", (&zone == result->Zones.Data) ? "" : ",", zone.Name, zone.Time / (frames - 1));
+        fprintf(f, " }");
+    }
+    if (!result->SlowestFrames.empty())
+    {
+        fprintf(f, ",\n      \"replay\": { \"hash_mismatches\": %d, \"first_mismatch_frame\": %d, \"slowest_frames\": [", result->HashMismatchCount, result->FirstHashMismatchFrame);
+        for (const BenchFrameTime& frame_time : result->SlowestFrames)
+            fprintf(f, "%s { \"frame\": %d, \"ns\": %llu }", (&frame_time == result->SlowestFrames.Data) ? "" : ",", frame_time.Frame, (unsigned long long)frame_time.Time);
+        fprintf(f, " ] }");
+    }
+    fprintf(f, "\n    }%s\n", last ? "" : ",");
+}
+
+static void RunMicro(const BenchMicro* micro, int warmup_reps, int reps, ImVector<ImU64>* out_times)
+{
+    // Measure each repetition, sorted. Divide by OpsPerRep when reporting so we keep integers here.
+    for (int n = 0; n < warmup_reps; n++)
+        micro->Run(micro->OpsPerRep);
+    for (int n = 0; n < reps; n++)
+    {
+        const ImU64 t0 = BenchGetTimeNs();
+        micro->Run(micro->OpsPerRep);
+        out_times->push_back(BenchGetTimeNs() - t0);
+    }
+    qsort(out_times->Data, (size_t)out_times->Size, sizeof(ImU64), CompareU64);
+}
+
+static void WriteMicroResultJson(FILE* f, const BenchMicro* micro, const ImVector<ImU64>& times, bool last)
+{
+    const double ops = (double)micro->OpsPerRep;
+    fprintf(f, "    {\n");
+    fprintf(f, "      \"name\": \"%s\",\n", micro->Name);
+    fprintf(f, "      \"desc\": \"%s\",\n", micro->Desc);
+    fprintf(f, "      \"reps\": %d,\n", times.Size);
+    fprintf(f, "      \"ops_per_rep\": %d,\n", micro->OpsPerRep);
+    fprintf(f, "      \"ns_per_op\": { \"min\": %.2f, \"median\": %.2f, \"p99\": %.2f, \"max\": %.2f }\n",
+        times[0] / ops, GetMedian(times) / ops, times[(times.Size * 99) / 100] / ops, times.back() / ops);
+    fprintf(f, "    }%s\n", last ? "" : ",");
+}
+
+// Baseline is an output file of a previous run: we only read the first "median" value following each "name".
+struct BenchBaselineEntry
+{
+    char        Name[64];
+    double      Median;
+};
+
+static bool LoadBaseline(const char* filename, ImVector<BenchBaselineEntry>* out_entries)
+{
+    FILE* f = fopen(filename, "rb");
+    if (f == nullptr)
+        return false;
+    ImVector<char> data;
+    char buf[4096];
+    for (size_t size; (size = fread(buf, 1, sizeof(buf), f)) > 0; )
+        for (size_t n = 0; n < size; n++)
+            data.push_back(buf[n]);
+    data.push_back(0);
+    fclose(f);
+
+    const char* name_marker = "\"name\": \"";
+    const char* median_marker = "\"median\": ";
+    for (const char* p = strstr(data.Data, name_marker); p != nullptr; )
+    {
+        p += strlen(name_marker);
+        const char* name_end = strchr(p, '"');
+        const char* next_name = strstr(p, name_marker);
+        const char* median = strstr(p, median_marker);
+        if (name_end != nullptr && median != nullptr && (next_name == nullptr || median < next_name))
+        {
+            BenchBaselineEntry entry;
+            ImStrncpy(entry.Name, p, ImMin((size_t)(name_end - p) + 1, sizeof(entry.Name)));
+            entry.Median = atof(median + strlen(median_marker));
+            out_entries->push_back(entry);
+        }
+        p = next_name;
+    }
+    return true;
+}
+
+// Threshold with a null Name is the default one
+struct BenchThreshold
+{
+    const char* Name;
+    float       Percent;
+};
+
+// Return true if 'name' regressed more than allowed threshold
+static bool CompareWithBaseline(const ImVector<BenchBaselineEntry>& baseline, const ImVector<BenchThreshold>& thresholds, const char* name, const char* unit, double median)
+{
+    const BenchBaselineEntry* entry = nullptr;
+    for (const BenchBaselineEntry& it : baseline)
+        if (strcmp(it.Name, name) == 0)
+            entry = &it;
+    if (entry == nullptr || entry->Median <= 0.0)
+    {
+        fprintf(stderr, "  %-28s %12.2f %s    (not in baseline)\n", name, median, unit);
+        return false;
+    }
+    float threshold = 0.0f;
+    for (const BenchThreshold& it : thresholds)
+        if (it.Name == nullptr || strcmp(it.Name, name) == 0)
+            threshold = it.Percent; // Last matching entry wins, default is first
+    const double delta_percent = (median / entry->Median - 1.0) * 100.0;
+    const bool regressed = delta_percent > threshold;
+    fprintf(stderr, "  %-28s %12.2f %s -> %12.2f %s  %+7.1f%% %s\n", name, entry->Median, unit, median, unit, delta_percent, regressed ? "REGRESSION" : "");
+    return regressed;
+}
+
+int main(int argc, char** argv)
+{
+    IMGUI_CHECKVERSION();
+    int frames = 300;
+    int warmup_frames = 30;
+    bool profile = false;
+    bool micro_mode = false;
+    const char* scenario_filter = nullptr;
+    const char* output_filename = nullptr;
+    const char* baseline_filename = nullptr;
+    const char* record_filename = nullptr;
+    const char* replay_filename = nullptr;
+    const char* golden_save_filename = nullptr;
+    const char* golden_compare_filename = nullptr;
+    float golden_tolerance = 0.0f;
+    ImVector<BenchThreshold> thresholds;
+    BenchThreshold default_threshold = { nullptr, 10.0f };
+    thresholds.push_back(default_threshold);
+    for (int n = 1; n < argc; n++)
+    {
+        if (strcmp(argv[n], "--frames") == 0 && n + 1 < argc)
+            frames = atoi(argv[++n]);
+        else if (strcmp(argv[n], "--warmup") == 0 && n + 1 < argc)
+            warmup_frames = atoi(argv[++n]);
+        else if (strcmp(argv[n], "--scenario") == 0 && n + 1 < argc)
+            scenario_filter = argv[++n];
+        else if (strcmp(argv[n], "--output") == 0 && n + 1 < argc)
+            output_filename = argv[++n];
+        else if (strcmp(argv[n], "--profile") == 0)
+            profile = true;
+        else if (strcmp(argv[n], "--micro") == 0)
+            micro_mode = true;
+        else if (strcmp(argv[n], "--baseline") == 0 && n + 1 < argc)
+            baseline_filename = argv[++n];
+        else if (strcmp(argv[n], "--record") == 0 && n + 1 < argc)
+            record_filename = argv[++n];
+        else if (strcmp(argv[n], "--replay") == 0 && n + 1 < argc)
+            replay_filename = argv[++n];
+        else if (strcmp(argv[n], "--golden-save") == 0 && n + 1 < argc)
+            golden_save_filename = argv[++n];
+        else if (strcmp(argv[n], "--golden-compare") == 0 && n + 1 < argc)
+            golden_compare_filename = argv[++n];
+        else if (strcmp(argv[n], "--golden-tolerance") == 0 && n + 1 < argc)
+            golden_tolerance = (float)atof(argv[++n]);
+        else if (strcmp(argv[n], "--threshold") == 0 && n + 1 < argc)
+        {
+            char* arg = argv[++n];
+            if (char* separator = strchr(arg, '='))
+            {
+                *separator = 0;
+                BenchThreshold threshold = { arg, (float)atof(separator + 1) };
+                thresholds.push_back(threshold);
+            }
+            else
+            {
+                thresholds[0].Percent = (float)atof(arg);
+            }
+        }
+        else
+        {
+            fprintf(stderr, "Usage: %s [--micro] [--frames N] [--warmup N] [--scenario NAME] [--profile] [--output FILE] [--baseline FILE [--threshold [NAME=]PERCENT]...]\n", argv[0]);
+            fprintf(stderr, "       %s --scenario NAME [--record FILE | --replay FILE] [...]\n", argv[0]);
+            fprintf(stderr, "       %s [--golden-save FILE | --golden-compare FILE [--golden-tolerance F]] [...]\n", argv[0]);
+            fprintf(stderr, "Scenarios:\n");
+            for (const BenchScenario& scenario : g_Scenarios)
+                fprintf(stderr, "  %-28s %s\n", scenario.Name, scenario.Desc);
+            fprintf(stderr, "Microbenchmarks (--micro, --frames/--warmup are repetitions):\n");
+            for (const BenchMicro& micro : g_Micros)
+                fprintf(stderr, "  %-28s %s\n", micro.Name, micro.Desc);
+            return 1;
+        }
+    }
+    if (frames < 2)
+        frames = 2;
+
+    BenchReplayMode replay_mode = (record_filename != nullptr) ? BenchReplayMode_Record : (replay_filename != nullptr) ? BenchReplayMode_Replay : BenchReplayMode_None;
+    if (replay_mode != BenchReplayMode_None && (scenario_filter == nullptr || micro_mode || (record_filename != nullptr && replay_filename != nullptr)))
+    {
+        fprintf(stderr, "--record and --replay require a single --scenario\n");
+        return 1;
+    }
+    if ((golden_save_filename != nullptr || golden_compare_filename != nullptr) && (micro_mode || (golden_save_filename != nullptr && golden_compare_filename != nullptr)))
+    {
+        fprintf(stderr, "--golden-save and --golden-compare can't be used together or with --micro\n");
+        return 1;
+    }
+
+    ImVector<BenchBaselineEntry> baseline;
+    if (baseline_filename != nullptr && !LoadBaseline(baseline_filename, &baseline))
+    {
+        fprintf(stderr, "Could not open '%s'\n", baseline_filename);
+        return 1;
+    }
+
+    ImGui::SetAllocatorFunctions(BenchMallocWrapper, BenchFreeWrapper, nullptr);
+
+    ImGuiReplay replay;
+    if (replay_mode == BenchReplayMode_Replay)
+    {
+        if (!replay.LoadFromFile(replay_filename) || replay.GetFramesCount() < 2)
+        {
+            fprintf(stderr, "Could not load replay from '%s'\n", replay_filename);
+            return 1;
+        }
+        fprintf(stderr, "Loaded %d frames from '%s'\n", replay.GetFramesCount(), replay_filename);
+        warmup_frames = ImMin(warmup_frames, replay.GetFramesCount() / 2);
+        frames = replay.GetFramesCount() - warmup_frames;
+    }
+
+    ImGuiDrawGolden golden;
+    ImGuiDrawGolden golden_reference;
+    const bool golden_capture = (golden_save_filename != nullptr || golden_compare_filename != nullptr);
+    if (golden_compare_filename != nullptr)
+    {
+        if (!golden_reference.LoadFromFile(golden_compare_filename))
+        {
+            fprintf(stderr, "Could not load draw data from '%s'\n", golden_compare_filename);
+            return 1;
+        }
+        fprintf(stderr, "Loaded %d frames of draw data from '%s'\n", golden_reference.GetFramesCount(), golden_compare_filename);
+    }
+
+    // Run everything first, so writing output doesn't affect measurements
+    ImVector<const BenchScenario*> scenarios;
+    ImVector<const BenchMicro*> micros;
+    if (micro_mode)
+    {
+        for (const BenchMicro& micro : g_Micros)
+            if (scenario_filter == nullptr || strcmp(scenario_filter, micro.Name) == 0)
+                micros.push_back(&micro);
+    }
+    else
+    {
+        for (const BenchScenario& scenario : g_Scenarios)
+            if (scenario_filter == nullptr || strcmp(scenario_filter, scenario.Name) == 0)
+                scenarios.push_back(&scenario);
+    }
+    if (scenarios.empty() && micros.empty())
+    {
+        fprintf(stderr, "Unknown scenario '%s'\n", scenario_filter);
+        return 1;
+    }
+    if (golden_compare_filename != nullptr && !CheckGoldenReference(&golden_reference, golden_compare_filename, scenarios, warmup_frames, frames))
+        return 1;
+    ImVector<BenchResult> results;
+    results.resize(scenarios.Size, BenchResult());
+    for (int n = 0; n < scenarios.Size; n++)
+    {
+        fprintf(stderr, "Running '%s' (%d + %d frames)...\n", scenarios[n]->Name, warmup_frames, frames);
+        RunScenario(scenarios[n], warmup_frames, frames, profile, replay_mode, &replay, golden_capture ? &golden : nullptr, &results[n]);
+    }
+    if (replay_mode == BenchReplayMode_Record)
+    {
+        if (!replay.SaveToFile(record_filename))
+        {
+            fprintf(stderr, "Could not write '%s'\n", record_filename);
+            return 1;
+        }
+        fprintf(stderr, "Recorded %d frames (%d bytes) to '%s'\n", replay.GetFramesCount(), replay.Data.Size, record_filename);
+    }
+    if (golden_save_filename != nullptr)
+    {
+        if (!golden.SaveToFile(golden_save_filename))
+        {
+            fprintf(stderr, "Could not write '%s'\n", golden_save_filename);
+            return 1;
+        }
+        fprintf(stderr, "Saved %d frames of draw data (%d bytes) to '%s'\n", golden.GetFramesCount(), golden.Data.Size, golden_save_filename);
+    }
+    ImVector<ImVector<ImU64>> micro_times;
+    micro_times.resize(micros.Size, ImVector<ImU64>());
+    if (!micros.empty())
+    {
+        // All microbenchmarks share one context, in the middle of a frame
+        ImGui::CreateContext();
+        ImGuiIO& io = ImGui::GetIO();
+        io.IniFilename = nullptr;
+        io.DisplaySize = ImVec2(1920, 1080);
+        io.DeltaTime = 1.0f / 60.0f;
+        io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;
+        unsigned char* tex_pixels = nullptr;
+        int tex_w, tex_h;
+        io.Fonts->GetTexDataAsRGBA32(&tex_pixels, &tex_w, &tex_h);
+        ImGui::NewFrame();
+        MicroSetup();
+        for (int n = 0; n < micros.Size; n++)
+        {
+            fprintf(stderr, "Running '%s' (%d + %d repetitions of %d ops)...\n", micros[n]->Name, warmup_frames, frames, micros[n]->OpsPerRep);
+            RunMicro(micros[n], warmup_frames, frames, &micro_times[n]);
+        }
+        MicroShutdown();
+        ImGui::EndFrame();
+        ImGui::DestroyContext();
+    }
+
+    FILE* f = output_filename ? fopen(output_filename, "wt") : stdout;
+    if (f == nullptr)
+    {
+        fprintf(stderr, "Could not open '%s'\n", output_filename);
+        return 1;
+    }
+    fprintf(f, "{\n");
+    fprintf(f, "  \"imgui_version\": \"%s\",\n", IMGUI_VERSION);
+    fprintf(f, "  \"imgui_version_num\": %d,\n", IMGUI_VERSION_NUM);
+    fprintf(f, "  \"warmup_frames\": %d,\n", warmup_frames);
+    if (micro_mode)
+    {
+        fprintf(f, "  \"micro\":\n  [\n");
+        for (int n = 0; n < micros.Size; n++)
+            WriteMicroResultJson(f, micros[n], micro_times[n], n == micros.Size - 1);
+    }
+    else
+    {
+        fprintf(f, "  \"scenarios\":\n  [\n");
+        for (int n = 0; n < scenarios.Size; n++)
+            WriteResultJson(f, scenarios[n], &results[n], n == scenarios.Size - 1);
+    }
+    fprintf(f, "  ]\n}\n");
+    if (f != stdout)
+        fclose(f);
+
+    // Compare medians with baseline
+    int regressions_count = 0;
+    if (baseline_filename != nullptr)
+    {
+        fprintf(stderr, "Comparing with '%s' (default threshold: %+.1f%%):\n", baseline_filename, thresholds[0].Percent);
+        for (int n = 0; n < scenarios.Size; n++)
+            if (CompareWithBaseline(baseline, thresholds, scenarios[n]->Name, "ns/frame", GetMedian(results[n].TimeTotalPerFrame)))
+                regressions_count++;
+        for (int n = 0; n < micros.Size; n++)
+            if (CompareWithBaseline(baseline, thresholds, micros[n]->Name, "ns/op", GetMedian(micro_times[n]) / micros[n]->OpsPerRep))
+                regressions_count++;
+        fprintf(stderr, "%d regression(s).\n", regressions_count);
+    }
+
+    // Replayed frames should be identical to recorded ones
+    int replay_mismatches_count = 0;
+    if (replay_mode == BenchReplayMode_Replay)
+    {
+        for (const BenchResult& result : results)
+            replay_mismatches_count += result.HashMismatchCount;
+        if (replay_mismatches_count > 0)
+            fprintf(stderr, "Replay: %d frame(s) differ from recording, first one: %d.\n", replay_mismatches_count, results[0].FirstHashMismatchFrame);
+        else
+            fprintf(stderr, "Replay: all frames identical to recording.\n");
+    }
+
+    // Draw data should be identical to reference (within tolerance)
+    bool golden_diverged = false;
+    if (golden_compare_filename != nullptr)
+    {
+        ImGuiDrawGoldenDiff diff;
+        golden_diverged = !golden.Compare(golden_reference, golden_tolerance, &diff);
+        if (golden_diverged)
+            fprintf(stderr, "Draw data differs from '%s' (tolerance: %g):\n  %s\n", golden_compare_filename, golden_tolerance, diff.Desc);
+        else
+            fprintf(stderr, "Draw data identical to '%s' (%d frames, tolerance: %g).\n", golden_compare_filename, golden.GetFramesCount(), golden_tolerance);
+    }
+
+    for (BenchResult& result : results)
+    {
+        result.TimeTotalPerFrame.clear();
+        result.Zones.clear();
+        result.SlowestFrames.clear();
+    }
+    replay.Clear();
+    golden.Clear();
+    golden_reference.Clear();
+    for (ImVector<ImU64>& times : micro_times)
+        times.clear();
+    return (regressions_count > 0) ? 2 : (replay_mismatches_count > 0) ? 3 : golden_diverged ? 4 : 0;
+}
@@ -95,6 +95,7 @@ CODE
 // [SECTION] METRICS/DEBUGGER WINDOW
 // [SECTION] DEBUG LOG WINDOW
 // [SECTION] OTHER DEBUG TOOLS (ITEM PICKER, ID STACK TOOL)
+// [SECTION] PROFILER
 
 */
 
@@ -1105,6 +1106,12 @@ CODE
 #include <TargetConditionals.h>
 #endif
 
+// [Profiler] Clock used by ProfilerGetTime() when QueryPerformanceCounter() is not available
+// (after the Windows section, which may define IMGUI_DISABLE_WIN32_FUNCTIONS)
+#if !defined(IMGUI_DISABLE_PROFILER) && (!defined(_WIN32) || defined(IMGUI_DISABLE_WIN32_FUNCTIONS))
+#include <time.h>       // clock_gettime, clock
+#endif
+
 // Visual Studio warnings
 #ifdef _MSC_VER
 #pragma warning (disable: 4127)             // condition expression is constant
@@ -1227,6 +1234,10 @@ static void             UpdateDebugToolItemPicker();
 static void             UpdateDebugToolStackQueries();
 static void             UpdateDebugToolFlashStyleColor();
 #endif
+#ifndef IMGUI_DISABLE_PROFILER
+static void             ProfilerNewFrame();
+static void             ProfilerTraceAddInstantEvent(const char* name, const char* name_end);
+#endif
 
 // Inputs
 static void             UpdateKeyboardInputs();
@@ -1429,12 +1440,15 @@ ImGuiIO::ImGuiIO()
     ConfigInputTrickleEventQueue = true;
     ConfigInputTextCursorBlink = true;
     ConfigInputTextEnterKeepActive = false;
+    ConfigInputTextUndoMemoryBudget = 1024 * 1024;
     ConfigDragClickToInputText = false;
     ConfigWindowsResizeFromEdges = true;
     ConfigWindowsMoveFromTitleBarOnly = false;
     ConfigWindowsCopyContentsWithCtrlC = false;
     ConfigScrollbarScrollByPage = true;
     ConfigMemoryCompactTimer = 60.0f;
+    ConfigMemoryCompactBudget = 0;
+    ConfigMemoryShrinkDrawListFrames = 0;
     ConfigDebugIsDebuggerPresent = false;
     ConfigDebugHighlightIdConflicts = true;
     ConfigDebugBeginReturnValueOnce = false;
@@ -2736,7 +2750,7 @@ IM_MSVC_RUNTIME_CHECKS_RESTORE
 // Helper: Parse and apply text filters. In format "aaaaa[,bbbb][,ccccc]"
 ImGuiTextFilter::ImGuiTextFilter(const char* default_filter) //-V1077
 {
-    InputBuf[0] = 0;
+    InputBuf[0] = InputBufUpper[0] = 0;
     CountGrep = 0;
     if (default_filter)
     {
@@ -2775,17 +2789,24 @@ void ImGuiTextFilter::ImGuiTextRange::split(char separator, ImVector<ImGuiTextRa
 
 void ImGuiTextFilter::Build()
 {
+    const int input_len = (int)strlen(InputBuf);
+    for (int n = 0; n <= input_len; n++)
+        InputBufUpper[n] = ImToUpper(InputBuf[n]);
+
     Filters.resize(0);
-    ImGuiTextRange input_range(InputBuf, InputBuf + strlen(InputBuf));
+    ImGuiTextRange input_range(InputBuf, InputBuf + input_len);
     input_range.split(',', &Filters);
 
     CountGrep = 0;
-    for (ImGuiTextRange& f : Filters)
+    FiltersUpper.resize(Filters.Size);
+    for (int filter_n = 0; filter_n < Filters.Size; filter_n++)
     {
+        ImGuiTextRange& f = Filters[filter_n];
         while (f.b < f.e && ImCharIsBlankA(f.b[0]))
             f.b++;
         while (f.e > f.b && ImCharIsBlankA(f.e[-1]))
             f.e--;
+        FiltersUpper[filter_n] = ImGuiTextRange(InputBufUpper + (f.b - InputBuf), InputBufUpper + (f.e - InputBuf));
         if (f.empty())
             continue;
         if (f.b[0] != '-')
@@ -2793,6 +2814,65 @@ void ImGuiTextFilter::Build()
     }
 }
 
+static inline bool ImGuiTextFilter_MatchAt(const char* text, const char* needle_upper, const char* needle_upper_end)
+{
+    for (; needle_upper < needle_upper_end; text++, needle_upper++)
+        if (ImToUpper(*text) != *needle_upper)
+            return false;
+    return true;
+}
+
+// Case-insensitive search, same as ImStristr() but 'needle_upper' is already converted with ImToUpper().
+// With SSE2, we look for the first two characters (in both cases) at 16 positions at a time, and only compare the rest of the needle on candidates.
+static const char* ImGuiTextFilter_FindNeedle(const char* text, const char* text_end, const char* needle_upper, const char* needle_upper_end)
+{
+    const int needle_len = (int)(needle_upper_end - needle_upper);
+    if (needle_len == 0 || text_end - text < needle_len)
+        return NULL;
+    const char* text_last = text_end - needle_len; // Last position where the needle may start
+    const char* p = text;
+#ifdef IMGUI_ENABLE_SSE2
+    // Letters are compared with bit 5 cleared, which maps 'a'-'z' to 'A'-'Z' and nothing else to them.
+    // With a single character needle, compare it twice so all loads stay inside [text, text_end).
+    const int c1_offset = (needle_len > 1) ? 1 : 0;
+    const char c0 = needle_upper[0];
+    const char c1 = needle_upper[c1_offset];
+    const __m128i c0_mask = _mm_set1_epi8((c0 >= 'A' && c0 <= 'Z') ? (char)~0x20 : (char)~0);
+    const __m128i c1_mask = _mm_set1_epi8((c1 >= 'A' && c1 <= 'Z') ? (char)~0x20 : (char)~0);
+    const __m128i c0_v = _mm_set1_epi8(c0);
+    const __m128i c1_v = _mm_set1_epi8(c1);
+    for (bool last_block = false; !last_block; p += 16)
+    {
+        // Last block may overlap previous one: ignore positions we already checked
+        unsigned int candidates_mask = ~0u;
+        if (text_last - p < 15)
+        {
+            if (p > text_last || text_last - text < 15)
+                break;
+            candidates_mask <<= (int)(p - (text_last - 15));
+            p = text_last - 15;
+            last_block = true;
+        }
+        const __m128i v0 = _mm_and_si128(_mm_loadu_si128((const __m128i*)(const void*)p), c0_mask);
+        const __m128i v1 = _mm_and_si128(_mm_loadu_si128((const __m128i*)(const void*)(p + c1_offset)), c1_mask);
+        unsigned int candidates = (unsigned int)_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(v0, c0_v), _mm_cmpeq_epi8(v1, c1_v))) & candidates_mask;
+        while (candidates != 0)
+        {
+            const char* candidate = p + ImCountTrailingZeros(candidates);
+            if (ImGuiTextFilter_MatchAt(candidate + 1, needle_upper + 1, needle_upper_end))
+                return candidate;
+            candidates &= candidates - 1;
+        }
+    }
+    if (p > text_last)
+        return NULL;
+#endif
+    for (; p <= text_last; p++)
+        if (ImToUpper(*p) == needle_upper[0] && ImGuiTextFilter_MatchAt(p + 1, needle_upper + 1, needle_upper_end))
+            return p;
+    return NULL;
+}
+
 bool ImGuiTextFilter::PassFilter(const char* text, const char* text_end) const
 {
     if (Filters.Size == 0)
@@ -2800,21 +2880,23 @@ bool ImGuiTextFilter::PassFilter(const char* text, const char* text_end) const
 
     if (text == NULL)
         text = text_end = "";
+    else if (text_end == NULL)
+        text_end = text + strlen(text);
 
-    for (const ImGuiTextRange& f : Filters)
+    for (const ImGuiTextRange& f : FiltersUpper)
     {
         if (f.b == f.e)
             continue;
         if (f.b[0] == '-')
         {
             // Subtract
-            if (ImStristr(text, text_end, f.b + 1, f.e) != NULL)
+            if (ImGuiTextFilter_FindNeedle(text, text_end, f.b + 1, f.e) != NULL)
                 return false;
         }
         else
         {
             // Grep
-            if (ImStristr(text, text_end, f.b, f.e) != NULL)
+            if (ImGuiTextFilter_FindNeedle(text, text_end, f.b, f.e) != NULL)
                 return true;
         }
     }
@@ -2826,6 +2908,78 @@ bool ImGuiTextFilter::PassFilter(const char* text, const char* text_end) const
     return false;
 }
 
+// Return true if all texts passing the 'new_filter' also pass 'old_filter', when we can tell easily:
+// - New filter adds characters to the last term of the old one, without adding a new term (','). Other terms are unchanged.
+// - Last term is a grep term (so it becomes more restrictive), or an empty exclusion term "-" (which didn't exclude anything).
+static bool ImGuiTextFilterCache_IsNarrowing(const char* old_filter, const char* new_filter)
+{
+    if (old_filter[0] == 0)
+        return true; // Old filter was not active: everything passed
+    const size_t old_len = strlen(old_filter);
+    if (strncmp(old_filter, new_filter, old_len) != 0 || strchr(new_filter + old_len, ',') != NULL)
+        return false;
+    const char* last_term = strrchr(old_filter, ',');
+    last_term = last_term ? last_term + 1 : old_filter;
+    while (ImCharIsBlankA(*last_term))
+        last_term++;
+    if (*last_term == 0)
+        return false;
+    if (*last_term != '-')
+        return true;
+    for (last_term++; ImCharIsBlankA(*last_term); last_term++) {}
+    return *last_term == 0;
+}
+
+void ImGuiTextFilterCache::Update(const ImGuiTextFilter& filter, const char* buf, const char* buf_end, const int* line_offsets, int lines_count)
+{
+    IM_ASSERT(lines_count >= 0 && (lines_count == 0 || line_offsets != NULL));
+
+    // Buffer was cleared
+    if (lines_count < LinesProcessed)
+        Clear();
+
+    // Last line we tested may have been appended to: test it again
+    if (LinesProcessed > 0)
+    {
+        if (Lines.Size > 0 && Lines.back() == LinesProcessed - 1)
+            Lines.pop_back();
+        LinesProcessed--;
+    }
+
+    // Filter changed: test lines which passed previous filter again if new filter is narrowing, otherwise start over
+    if (strcmp(FilterBuf, filter.InputBuf) != 0)
+    {
+        if (ImGuiTextFilterCache_IsNarrowing(FilterBuf, filter.InputBuf))
+        {
+            int lines_kept = 0;
+            for (int line_n : Lines)
+            {
+                const char* line_end = (line_n + 1 < lines_count) ? buf + line_offsets[line_n + 1] - 1 : buf_end;
+                if (filter.PassFilter(buf + line_offsets[line_n], line_end))
+                    Lines.Data[lines_kept++] = line_n;
+            }
+            Lines.resize(lines_kept);
+        }
+        else
+        {
+            Lines.resize(0);
+            LinesProcessed = 0;
+        }
+        IM_STATIC_ASSERT(sizeof(FilterBuf) == sizeof(filter.InputBuf));
+        memcpy(FilterBuf, filter.InputBuf, sizeof(FilterBuf));
+        FilterBuf[IM_ARRAYSIZE(FilterBuf) - 1] = 0;
+    }
+
+    // Test new lines
+    for (int line_n = LinesProcessed; line_n < lines_count; line_n++)
+    {
+        const char* line_end = (line_n + 1 < lines_count) ? buf + line_offsets[line_n + 1] - 1 : buf_end;
+        if (filter.PassFilter(buf + line_offsets[line_n], line_end))
+            Lines.push_back(line_n);
+    }
+    LinesProcessed = lines_count;
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] ImGuiTextBuffer, ImGuiTextIndex
 //-----------------------------------------------------------------------------
@@ -3517,6 +3671,7 @@ void ImGui::RenderText(ImVec2 pos, const char* text, const char* text_end, bool
 {
     ImGuiContext& g = *GImGui;
     ImGuiWindow* window = g.CurrentWindow;
+    IMGUI_PROFILER_SCOPE("RenderText", window->ID);
 
     // Hide anything after a '##' string
     const char* text_display_end;
@@ -3543,6 +3698,7 @@ void ImGui::RenderTextWrapped(ImVec2 pos, const char* text, const char* text_end
 {
     ImGuiContext& g = *GImGui;
     ImGuiWindow* window = g.CurrentWindow;
+    IMGUI_PROFILER_SCOPE("RenderText", window->ID);
 
     if (!text_end)
         text_end = text + strlen(text); // FIXME-OPT
@@ -3562,6 +3718,8 @@ void ImGui::RenderTextWrapped(ImVec2 pos, const char* text, const char* text_end
 // better advantage of the render function taking size into account for coarse clipping.
 void ImGui::RenderTextClippedEx(ImDrawList* draw_list, const ImVec2& pos_min, const ImVec2& pos_max, const char* text, const char* text_display_end, const ImVec2* text_size_if_known, const ImVec2& align, const ImRect* clip_rect)
 {
+    IMGUI_PROFILER_SCOPE("RenderText", GImGui->CurrentWindow ? GImGui->CurrentWindow->ID : 0);
+
     // Perform CPU side clipping for single clipped element to avoid using scissor state
     ImVec2 pos = pos_min;
     const ImVec2 text_size = text_size_if_known ? *text_size_if_known : CalcTextSize(text, text_display_end, false, 0.0f);
@@ -3998,6 +4156,8 @@ ImGuiContext::ImGuiContext(ImFontAtlas* shared_font_atlas)
     LogWindow = NULL;
     LogNextPrefix = LogNextSuffix = NULL;
     LogFile = NULL;
+    LogCallback = NULL;
+    LogCallbackUserData = NULL;
     LogLinePosY = FLT_MAX;
     LogLineFirstItem = false;
     LogDepthRef = 0;
@@ -4149,23 +4309,37 @@ void ImGui::Shutdown()
 
     g.ClipboardHandlerData.clear();
     g.MenusIdSubmittedThisFrame.clear();
+    g.PlotColumnsMinMax.clear();
     g.InputTextState.ClearFreeMemory();
     g.InputTextDeactivatedState.ClearFreeMemory();
+    g.InputTextLineCaches.Clear();
+    g.InputTextColorSpans.clear();
 
     g.SettingsWindows.clear();
     g.SettingsHandlers.clear();
+    g.SettingsWindowsWriteCache.Clear();
+    g.SettingsTablesWriteCache.Clear();
 
     if (g.LogFile)
     {
 #ifndef IMGUI_DISABLE_TTY_FUNCTIONS
         if (g.LogFile != stdout)
 #endif
+        {
+            if (!g.LogBuffer.empty())
+                ImFileWrite(g.LogBuffer.c_str(), sizeof(char), (ImU64)g.LogBuffer.size(), g.LogFile);
             ImFileClose(g.LogFile);
+        }
         g.LogFile = NULL;
     }
+    if (g.LogCallback)
+        g.LogCallback(g.LogBuffer.c_str(), g.LogBuffer.size(), true, g.LogCallbackUserData);
+    g.LogCallback = NULL;
     g.LogBuffer.clear();
     g.DebugLogBuf.clear();
     g.DebugLogIndex.clear();
+    ProfilerTraceStop();
+    g.Profiler.ClearFrames();
 
     g.Initialized = false;
 }
@@ -4260,6 +4434,7 @@ void ImGui::GcCompactTransientMiscBuffers()
     g.GroupStack.clear();
     g.MultiSelectTempDataStacked = 0;
     g.MultiSelectTempData.clear_destruct();
+    g.InputTextColorSpans.clear();
     TableGcCompactSettings();
 }
 
@@ -4269,7 +4444,10 @@ void ImGui::GcCompactTransientMiscBuffers()
 // This should have no noticeable visual effect. When the window reappear however, expect new allocation/buffer growth/copy cost.
 void ImGui::GcCompactTransientWindowBuffers(ImGuiWindow* window)
 {
+    ImGuiContext& g = *GImGui;
+    g.GcStats.WindowsCompactedCount++;
     window->MemoryCompacted = true;
+    window->MemoryDrawListOversizedFrames = 0;
     window->MemoryDrawListIdxCapacity = window->DrawList->IdxBuffer.Capacity;
     window->MemoryDrawListVtxCapacity = window->DrawList->VtxBuffer.Capacity;
     window->IDStack.clear();
@@ -4289,6 +4467,156 @@ void ImGui::GcAwakeTransientWindowBuffers(ImGuiWindow* window)
     window->MemoryDrawListIdxCapacity = window->MemoryDrawListVtxCapacity = 0;
 }
 
+// Bytes freed by GcCompactTransientWindowBuffers()
+size_t ImGui::GcCalcTransientWindowBytes(ImGuiWindow* window)
+{
+    const ImDrawList* draw_list = window->DrawList;
+    size_t bytes = 0;
+    bytes += (size_t)draw_list->CmdBuffer.Capacity * sizeof(ImDrawCmd);
+    bytes += (size_t)draw_list->IdxBuffer.Capacity * sizeof(ImDrawIdx);
+    bytes += (size_t)draw_list->VtxBuffer.Capacity * sizeof(ImDrawVert);
+    bytes += (size_t)draw_list->_Path.Capacity * sizeof(ImVec2);
+    bytes += (size_t)draw_list->_ClipRectStack.Capacity * sizeof(ImVec4);
+    bytes += (size_t)draw_list->_TextureIdStack.Capacity * sizeof(ImTextureID);
+    bytes += (size_t)draw_list->_CallbacksDataBuf.Capacity;
+    bytes += (size_t)draw_list->_Splitter._Channels.Capacity * sizeof(ImDrawChannel);
+    for (int n = 0; n < draw_list->_Splitter._Channels.Size; n++)
+        if (n != draw_list->_Splitter._Current) // Current channel is a copy of the draw list buffers
+            bytes += (size_t)draw_list->_Splitter._Channels[n]._CmdBuffer.Capacity * sizeof(ImDrawCmd) + (size_t)draw_list->_Splitter._Channels[n]._IdxBuffer.Capacity * sizeof(ImDrawIdx);
+    bytes += (size_t)window->IDStack.Capacity * sizeof(ImGuiID);
+    bytes += (size_t)window->DC.ChildWindows.Capacity * sizeof(ImGuiWindow*);
+    bytes += (size_t)window->DC.ItemWidthStack.Capacity * sizeof(float);
+    bytes += (size_t)window->DC.TextWrapPosStack.Capacity * sizeof(float);
+    return bytes;
+}
+
+// Free transient buffers of windows/tables which were not used during last frame, least recently active first, until
+// the transient buffers of all windows/tables fit in io.ConfigMemoryCompactBudget. Called by NewFrame() when budget > 0.
+void ImGui::GcCompactTransientBuffersToBudget()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiGcStats* stats = &g.GcStats;
+    ImVector<ImGuiGcCandidate>& candidates = stats->Candidates;
+    candidates.resize(0);
+
+    // Measure. Windows/tables used during last frame are counted but can't be compacted.
+    size_t total_bytes = 0;
+    for (int n = 0; n < g.Windows.Size; n++)
+    {
+        ImGuiWindow* window = g.Windows[n];
+        if (window->MemoryCompacted)
+            continue;
+        const size_t bytes = GcCalcTransientWindowBytes(window);
+        total_bytes += bytes;
+        if (!window->WasActive && bytes > 0)
+        {
+            ImGuiGcCandidate candidate = { ImGuiGcCandidateType_Window, n, window->LastTimeActive, bytes };
+            candidates.push_back(candidate);
+        }
+    }
+    for (int n = 0; n < g.TablesLastTimeActive.Size; n++)
+    {
+        if (g.TablesLastTimeActive[n] < 0.0f) // Compacted or removed
+            continue;
+        ImGuiTable* table = g.Tables.GetByIndex(n);
+        const size_t bytes = TableGcCalcTransientBytes(table);
+        total_bytes += bytes;
+        if (table->LastFrameActive < g.FrameCount - 1 && bytes > 0)
+        {
+            ImGuiGcCandidate candidate = { ImGuiGcCandidateType_Table, n, g.TablesLastTimeActive[n], bytes };
+            candidates.push_back(candidate);
+        }
+    }
+    for (int n = 0; n < g.TablesTempData.Size; n++)
+    {
+        ImGuiTableTempData* temp_data = &g.TablesTempData[n];
+        if (temp_data->LastTimeActive < 0.0f)
+            continue;
+        const size_t bytes = TableGcCalcTransientBytes(temp_data);
+        total_bytes += bytes;
+        if (temp_data->LastFrameActive < g.FrameCount - 1 && bytes > 0)
+        {
+            ImGuiGcCandidate candidate = { ImGuiGcCandidateType_TableTempData, n, temp_data->LastTimeActive, bytes };
+            candidates.push_back(candidate);
+        }
+    }
+
+    // Compact least recently active first
+    const size_t budget = (size_t)g.IO.ConfigMemoryCompactBudget;
+    if (total_bytes > budget && candidates.Size > 0)
+    {
+        struct Func
+        {
+            static int IMGUI_CDECL CompareByLastTimeActive(const void* lhs, const void* rhs)
+            {
+                const ImGuiGcCandidate* a = (const ImGuiGcCandidate*)lhs;
+                const ImGuiGcCandidate* b = (const ImGuiGcCandidate*)rhs;
+                if (a->LastTimeActive != b->LastTimeActive)
+                    return (a->LastTimeActive < b->LastTimeActive) ? -1 : +1;
+                return (a->Bytes > b->Bytes) ? -1 : (a->Bytes < b->Bytes) ? +1 : 0; // Larger first
+            }
+        };
+        ImQsort(candidates.Data, (size_t)candidates.Size, sizeof(ImGuiGcCandidate), Func::CompareByLastTimeActive);
+        for (const ImGuiGcCandidate& candidate : candidates)
+        {
+            if (total_bytes <= budget)
+                break;
+            if (candidate.Type == ImGuiGcCandidateType_Window)
+                GcCompactTransientWindowBuffers(g.Windows[candidate.Index]);
+            else if (candidate.Type == ImGuiGcCandidateType_Table)
+                TableGcCompactTransientBuffers(g.Tables.GetByIndex(candidate.Index));
+            else
+                TableGcCompactTransientBuffers(&g.TablesTempData[candidate.Index]);
+            total_bytes -= candidate.Bytes;
+            stats->BudgetCompactedCount++;
+        }
+    }
+    stats->TransientBytes = total_bytes;
+}
+
+template<typename T>
+static size_t GcShrinkVector(ImVector<T>* v)
+{
+    // Keep contents (last frame ImDrawData may still be inspected until Begin() resets the draw list) + some room to grow.
+    const int new_capacity = ImMax(v->Size + v->Size / 2, 8);
+    if (new_capacity >= v->Capacity)
+        return 0;
+    const size_t freed_bytes = (size_t)(v->Capacity - new_capacity) * sizeof(T);
+    ImVector<T> new_v;
+    new_v.reserve(new_capacity);
+    new_v.resize(v->Size);
+    if (v->Size > 0)
+        memcpy(new_v.Data, v->Data, (size_t)v->Size * sizeof(T));
+    v->swap(new_v);
+    return freed_bytes;
+}
+
+static bool GcIsDrawListOversized(const ImDrawList* draw_list)
+{
+    const int min_capacity = 1024; // Don't bother with small buffers
+    if (draw_list->VtxBuffer.Capacity >= min_capacity && draw_list->VtxBuffer.Size < draw_list->VtxBuffer.Capacity / 2)
+        return true;
+    if (draw_list->IdxBuffer.Capacity >= min_capacity && draw_list->IdxBuffer.Size < draw_list->IdxBuffer.Capacity / 2)
+        return true;
+    return false;
+}
+
+// Reallocate draw list vertex/index buffers to fit their current contents.
+// Called by NewFrame() for windows whose draw list has been oversized for io.ConfigMemoryShrinkDrawListFrames frames.
+void ImGui::GcShrinkDrawListBuffers(ImGuiWindow* window)
+{
+    ImGuiContext& g = *GImGui;
+    ImDrawList* draw_list = window->DrawList;
+    size_t freed_bytes = GcShrinkVector(&draw_list->VtxBuffer) + GcShrinkVector(&draw_list->IdxBuffer);
+    draw_list->_VtxWritePtr = draw_list->VtxBuffer.Data + draw_list->VtxBuffer.Size;
+    draw_list->_IdxWritePtr = draw_list->IdxBuffer.Data + draw_list->IdxBuffer.Size;
+    window->MemoryDrawListOversizedFrames = 0;
+    if (freed_bytes == 0)
+        return;
+    g.GcStats.DrawListsShrunkCount++;
+    g.GcStats.DrawListsShrunkBytes += freed_bytes;
+}
+
 void ImGui::SetActiveID(ImGuiID id, ImGuiWindow* window)
 {
     ImGuiContext& g = *GImGui;
@@ -4703,15 +5031,107 @@ void ImGui::DebugAllocHook(ImGuiDebugAllocInfo* info, int frame_count, void* ptr
         entry->AllocCount++;
         info->TotalAllocCount++;
         //printf("[%05d] MemAlloc(%d) -> 0x%p\n", frame_count, size, ptr);
+
+        // Deduce owner from current state. Allocations are only counted in DebugAllocResolveFrame(), so we can identify draw lists buffers.
+        ImGuiDebugAllocOwner owner = info->OwnerOverride;
+        ImGuiContext* ctx = GImGui;
+        if (owner == ImGuiDebugAllocOwner_None && ctx != NULL && ctx->WithinFrameScope)
+            owner = ctx->CurrentTable ? ImGuiDebugAllocOwner_Table : ctx->CurrentWindow ? ImGuiDebugAllocOwner_Window : ImGuiDebugAllocOwner_None;
+        if (info->PendingCount < IM_ARRAYSIZE(info->PendingBuf))
+        {
+            ImGuiDebugAllocPending* pending = &info->PendingBuf[info->PendingCount++];
+            pending->Ptr = ptr;
+            pending->Size = (int)size;
+            pending->MovedTo = -1;
+            pending->Owner = (ImS8)owner;
+        }
+        else
+        {
+            info->CurrFrame.AllocCount[owner]++;
+            info->CurrFrame.AllocBytes[owner] += (int)size;
+        }
+        info->LastHookWasAlloc = true;
     }
     else
     {
         entry->FreeCount++;
         info->TotalFreeCount++;
         //printf("[%05d] MemFree(0x%p)\n", frame_count, ptr);
+
+        // Freeing an allocation of current frame. If it immediately follows another allocation, consider it was moved there (e.g. ImVector<> growing).
+        for (int n = info->PendingCount - 1; n >= 0; n--)
+            if (info->PendingBuf[n].Ptr == ptr)
+            {
+                info->PendingBuf[n].Ptr = NULL;
+                if (info->LastHookWasAlloc && n < info->PendingCount - 1)
+                    info->PendingBuf[n].MovedTo = (ImS16)(info->PendingCount - 1);
+                break;
+            }
+        info->LastHookWasAlloc = false;
     }
 }
 
+static bool DebugAllocIsDrawListBuffer(ImDrawList* draw_list, void* ptr)
+{
+    if (ptr == draw_list->CmdBuffer.Data || ptr == draw_list->IdxBuffer.Data || ptr == draw_list->VtxBuffer.Data || ptr == draw_list->_Path.Data)
+        return true;
+    if (ptr == draw_list->_ClipRectStack.Data || ptr == draw_list->_TextureIdStack.Data || ptr == draw_list->_CallbacksDataBuf.Data || ptr == draw_list->_Splitter._Channels.Data)
+        return true;
+    for (ImDrawChannel& channel : draw_list->_Splitter._Channels)
+        if (ptr == channel._CmdBuffer.Data || ptr == channel._IdxBuffer.Data)
+            return true;
+    return false;
+}
+
+// Attribute allocations of last frame to their owners, and push them to history.
+// Allocations which are still alive are compared to buffers of draw lists. Allocations which were moved by a reallocation use the owner of their last location.
+void ImGui::DebugAllocResolveFrame(ImGuiDebugAllocInfo* info)
+{
+    ImGuiContext& g = *GImGui;
+    for (int n = info->PendingCount - 1; n >= 0; n--)
+    {
+        ImGuiDebugAllocPending* pending = &info->PendingBuf[n];
+        if (pending->MovedTo != -1)
+        {
+            pending->Owner = info->PendingBuf[pending->MovedTo].Owner;
+        }
+        else if (pending->Ptr != NULL)
+        {
+            bool is_draw_list = false;
+            for (int window_n = 0; window_n < g.Windows.Size && !is_draw_list; window_n++)
+                is_draw_list = DebugAllocIsDrawListBuffer(g.Windows[window_n]->DrawList, pending->Ptr);
+            for (int viewport_n = 0; viewport_n < g.Viewports.Size && !is_draw_list; viewport_n++)
+                for (ImDrawList* draw_list : g.Viewports[viewport_n]->BgFgDrawLists)
+                    if (draw_list != NULL && !is_draw_list)
+                        is_draw_list = DebugAllocIsDrawListBuffer(draw_list, pending->Ptr);
+            if (is_draw_list)
+                pending->Owner = ImGuiDebugAllocOwner_DrawList;
+        }
+        info->CurrFrame.AllocCount[pending->Owner]++;
+        info->CurrFrame.AllocBytes[pending->Owner] += pending->Size;
+    }
+    info->PendingCount = 0;
+    info->LastHookWasAlloc = false;
+
+    for (int owner = 0; owner < ImGuiDebugAllocOwner_COUNT; owner++)
+    {
+        info->OwnerTotalCount[owner] += info->CurrFrame.AllocCount[owner];
+        info->OwnerTotalBytes[owner] += (ImU64)info->CurrFrame.AllocBytes[owner];
+    }
+    info->History[info->HistoryIdx] = info->CurrFrame;
+    info->HistoryIdx = (info->HistoryIdx + 1) % IM_ARRAYSIZE(info->History);
+    info->HistoryCount = ImMin(info->HistoryCount + 1, IM_ARRAYSIZE(info->History));
+    memset(&info->CurrFrame, 0, sizeof(info->CurrFrame));
+}
+
+const char* ImGui::DebugAllocGetOwnerName(ImGuiDebugAllocOwner owner)
+{
+    const char* names[] = { "None", "Window", "DrawList", "DrawData", "Table", "InputText", "Font", "Settings", "TextLog" };
+    IM_STATIC_ASSERT(ImGuiDebugAllocOwner_COUNT == IM_ARRAYSIZE(names));
+    IM_ASSERT(owner >= 0 && owner < ImGuiDebugAllocOwner_COUNT);
+    return names[owner];
+}
+
 const char* ImGui::GetClipboardText()
 {
     ImGuiContext& g = *GImGui;
@@ -5051,6 +5471,17 @@ void ImGui::NewFrame()
     IM_ASSERT(GImGui != NULL && "No current context. Did you call ImGui::CreateContext() and ImGui::SetCurrentContext() ?");
     ImGuiContext& g = *GImGui;
 
+    // [DEBUG] Attribute allocations of last frame to their owners (see Metrics->Memory allocations)
+#ifndef IMGUI_DISABLE_DEBUG_TOOLS
+    DebugAllocResolveFrame(&g.DebugAllocInfo);
+#endif
+
+    // [DEBUG] Complete profiler frame and start recording a new one
+#ifndef IMGUI_DISABLE_PROFILER
+    ProfilerNewFrame();
+#endif
+    IMGUI_PROFILER_SCOPE("NewFrame", 0);
+
     // Remove pending delete hooks before frame start.
     // This deferred removal avoid issues of removal while iterating the hook vector
     for (int n = g.Hooks.Size - 1; n >= 0; n--)
@@ -5219,6 +5650,15 @@ void ImGui::NewFrame()
         // Garbage collect transient buffers of recently unused windows
         if (!window->WasActive && !window->MemoryCompacted && window->LastTimeActive < memory_compact_start_time)
             GcCompactTransientWindowBuffers(window);
+
+        // Shrink draw list buffers which have been oversized for a while
+        if (window->WasActive && g.IO.ConfigMemoryShrinkDrawListFrames > 0)
+        {
+            if (!GcIsDrawListOversized(window->DrawList))
+                window->MemoryDrawListOversizedFrames = 0;
+            else if (++window->MemoryDrawListOversizedFrames >= g.IO.ConfigMemoryShrinkDrawListFrames)
+                GcShrinkDrawListBuffers(window);
+        }
     }
 
     // Find hovered window
@@ -5252,6 +5692,19 @@ void ImGui::NewFrame()
     for (ImGuiTableTempData& table_temp_data : g.TablesTempData)
         if (table_temp_data.LastTimeActive >= 0.0f && table_temp_data.LastTimeActive < memory_compact_start_time)
             TableGcCompactTransientBuffers(&table_temp_data);
+
+    // Garbage collect render caches of recently unused InputTextMultiline()
+    // (caches used during last frame are kept, like windows with WasActive. A disabled timer never frees them.)
+    if (g.GcCompactAll || g.IO.ConfigMemoryCompactTimer >= 0.0f)
+        for (int i = 0; i < g.InputTextLineCaches.GetMapSize(); i++)
+            if (ImGuiInputTextLineCache* line_cache = g.InputTextLineCaches.TryGetMapData(i))
+                if (line_cache->LastFrameActive < g.FrameCount - 1 && line_cache->LastTimeActive < memory_compact_start_time)
+                    g.InputTextLineCaches.Remove(line_cache->ID, line_cache);
+
+    // Garbage collect transient buffers of least recently used windows/tables when over budget
+    if (g.IO.ConfigMemoryCompactBudget > 0)
+        GcCompactTransientBuffersToBudget();
+
     if (g.GcCompactAll)
         GcCompactTransientMiscBuffers();
     g.GcCompactAll = false;
@@ -5342,6 +5795,7 @@ static void AddWindowToSortBuffer(ImVector<ImGuiWindow*>* out_sorted_windows, Im
 static void AddWindowToDrawData(ImGuiWindow* window, int layer)
 {
     ImGuiContext& g = *GImGui;
+    IMGUI_PROFILER_SCOPE("AddWindowToDrawData", window->ID);
     ImGuiViewportP* viewport = g.Viewports[0];
     g.IO.MetricsRenderWindows++;
     if (window->DrawList->_Splitter._Count > 1)
@@ -5514,6 +5968,7 @@ void ImGui::EndFrame()
     if (g.FrameCountEnded == g.FrameCount)
         return;
     IM_ASSERT(g.WithinFrameScope && "Forgot to call ImGui::NewFrame()?");
+    IMGUI_PROFILER_SCOPE("EndFrame", 0);
 
     CallContextHooks(&g, ImGuiContextHookType_EndFramePre);
 
@@ -5610,9 +6065,13 @@ void ImGui::Render()
     if (g.FrameCountRendered == g.FrameCount)
         return;
     g.FrameCountRendered = g.FrameCount;
+    IMGUI_PROFILER_SCOPE("Render", 0);
+    IMGUI_DEBUG_ALLOC_OWNER_SCOPE(ImGuiDebugAllocOwner_DrawData);
 
     g.IO.MetricsRenderWindows = 0;
     CallContextHooks(&g, ImGuiContextHookType_RenderPre);
+    if (g.DrawStats.Enabled)
+        DebugDrawStatsBeginFrame();
 
     // Add background ImDrawList (for each active viewport)
     for (ImGuiViewportP* viewport : g.Viewports)
@@ -5659,9 +6118,16 @@ void ImGui::Render()
         for (ImDrawList* draw_list : draw_data->CmdLists)
             draw_list->_PopUnusedDrawCmd();
 
+        // Collect draw-call statistics for Metrics/Debugger
+        if (g.DrawStats.Recording)
+            for (ImDrawList* draw_list : draw_data->CmdLists)
+                DebugDrawStatsAddDrawList(draw_list);
+
         g.IO.MetricsRenderVertices += draw_data->TotalVtxCount;
         g.IO.MetricsRenderIndices += draw_data->TotalIdxCount;
     }
+    if (g.DrawStats.Recording)
+        DebugDrawStatsEndFrame();
 
     CallContextHooks(&g, ImGuiContextHookType_RenderPost);
 }
@@ -6953,6 +7419,7 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
     IM_ASSERT(name != NULL && name[0] != '\0');     // Window name required
     IM_ASSERT(g.WithinFrameScope);                  // Forgot to call ImGui::NewFrame()
     IM_ASSERT(g.FrameCountEnded != g.FrameCount);   // Called ImGui::Render() or ImGui::EndFrame() and haven't called ImGui::NewFrame() again yet
+    IMGUI_DEBUG_ALLOC_OWNER_SCOPE(ImGuiDebugAllocOwner_Window);
 
     // Find or create
     ImGuiWindow* window = FindWindowByName(name);
@@ -6960,6 +7427,10 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
     if (window_just_created)
         window = CreateNewWindow(name, flags);
 
+    // [DEBUG] Profiler: "Window" zone is ended by End()
+    const int profiler_zone_idx = IMGUI_PROFILER_BEGIN("Window", window->ID);
+    IMGUI_PROFILER_SCOPE("Begin", window->ID);
+
     // [DEBUG] Debug break requested by user
     if (g.DebugBreakInWindow == window->ID)
         IM_DEBUG_BREAK();
@@ -7016,6 +7487,7 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
     window_stack_data.Window = window;
     window_stack_data.ParentLastItemDataBackup = g.LastItemData;
     window_stack_data.DisabledOverrideReenable = (flags & ImGuiWindowFlags_Tooltip) && (g.CurrentItemFlags & ImGuiItemFlags_Disabled);
+    window_stack_data.ProfilerZoneIdx = profiler_zone_idx;
     ErrorRecoveryStoreState(&window_stack_data.StackSizesInBegin);
     g.StackSizesInBeginForCurrentWindow = &window_stack_data.StackSizesInBegin;
     if (flags & ImGuiWindowFlags_ChildMenu)
@@ -7712,6 +8184,7 @@ void ImGui::End()
         return;
     }
     ImGuiWindowStackData& window_stack_data = g.CurrentWindowStack.back();
+    IMGUI_PROFILER_SCOPE("End", window->ID);
 
     // Error checking: verify that user doesn't directly call End() on a child window.
     if (window->Flags & ImGuiWindowFlags_ChildWindow)
@@ -7750,6 +8223,9 @@ void ImGui::End()
     if (g.IO.ConfigErrorRecovery)
         ErrorRecoveryTryToRecoverWindowState(&window_stack_data.StackSizesInBegin);
 
+    // [DEBUG] Profiler: end "Window" zone (also ends "End" zone)
+    IMGUI_PROFILER_END(window_stack_data.ProfilerZoneIdx);
+
     g.CurrentWindowStack.pop_back();
     SetCurrentWindow(g.CurrentWindowStack.Size == 0 ? NULL : g.CurrentWindowStack.back().Window);
 }
@@ -9916,6 +10392,7 @@ void ImGui::UpdateInputEvents(bool trickle_fast_inputs)
 {
     ImGuiContext& g = *GImGui;
     ImGuiIO& io = g.IO;
+    IMGUI_PROFILER_SCOPE("UpdateInputEvents", 0);
 
     // Only trickle chars<>key when working with InputText()
     // FIXME: InputText() could parse event trail?
@@ -12758,6 +13235,7 @@ static void ImGui::NavUpdate()
 {
     ImGuiContext& g = *GImGui;
     ImGuiIO& io = g.IO;
+    IMGUI_PROFILER_SCOPE("NavUpdate", 0);
 
     io.WantSetMousePos = false;
     //if (g.NavScoringDebugCount > 0) IMGUI_DEBUG_LOG_NAV("[nav] NavScoringDebugCount %d for '%s' layer %d (Init:%d, Move:%d)\n", g.NavScoringDebugCount, g.NavWindow ? g.NavWindow->Name : "NULL", g.NavLayer, g.NavInitRequest || g.NavInitResultId != 0, g.NavMoveRequest);
@@ -14099,10 +14577,28 @@ void ImGui::EndDragDropTarget()
 // By default, tree nodes are automatically opened during logging.
 //-----------------------------------------------------------------------------
 
+#define IMGUI_LOG_FLUSH_SIZE    (64 * 1024)     // When logging to file or callback, accumulate text and write it in chunks of this size
+
+// Write text accumulated in g.LogBuffer to file or callback
+static void LogFlush(ImGuiContext& g, bool finish)
+{
+    if (g.LogFlags & ImGuiLogFlags_OutputFile)
+    {
+        if (!g.LogBuffer.empty())
+            ImFileWrite(g.LogBuffer.c_str(), sizeof(char), (ImU64)g.LogBuffer.size(), g.LogFile);
+    }
+    else if (g.LogFlags & ImGuiLogFlags_OutputCallback)
+    {
+        if (!g.LogBuffer.empty() || finish)
+            g.LogCallback(g.LogBuffer.c_str(), g.LogBuffer.size(), finish, g.LogCallbackUserData);
+    }
+    g.LogBuffer.Buf.resize(0);
+}
+
 // Pass text data straight to log (without being displayed)
 static inline void LogTextV(ImGuiContext& g, const char* fmt, va_list args)
 {
-    if (g.LogFile)
+    if (g.LogFlags & ImGuiLogFlags_OutputTTY)
     {
         g.LogBuffer.Buf.resize(0);
         g.LogBuffer.appendfv(fmt, args);
@@ -14110,7 +14606,10 @@ static inline void LogTextV(ImGuiContext& g, const char* fmt, va_list args)
     }
     else
     {
+        // Writes to file/callback are batched as they may be slow (e.g. file on a network share)
         g.LogBuffer.appendfv(fmt, args);
+        if ((g.LogFlags & (ImGuiLogFlags_OutputFile | ImGuiLogFlags_OutputCallback)) && g.LogBuffer.size() >= IMGUI_LOG_FLUSH_SIZE)
+            LogFlush(g, false);
     }
 }
 
@@ -14141,6 +14640,7 @@ void ImGui::LogTextV(const char* fmt, va_list args)
 void ImGui::LogRenderedText(const ImVec2* ref_pos, const char* text, const char* text_end)
 {
     ImGuiContext& g = *GImGui;
+    IMGUI_DEBUG_ALLOC_OWNER_SCOPE(ImGuiDebugAllocOwner_TextLog);
     ImGuiWindow* window = g.CurrentWindow;
 
     const char* prefix = g.LogNextPrefix;
@@ -14202,7 +14702,7 @@ void ImGui::LogBegin(ImGuiLogFlags flags, int auto_open_depth)
     ImGuiContext& g = *GImGui;
     ImGuiWindow* window = g.CurrentWindow;
     IM_ASSERT(g.LogEnabled == false);
-    IM_ASSERT(g.LogFile == NULL && g.LogBuffer.empty());
+    IM_ASSERT(g.LogFile == NULL && g.LogCallback == NULL && g.LogBuffer.empty());
     IM_ASSERT(ImIsPowerOfTwo(flags & ImGuiLogFlags_OutputMask_)); // Check that only 1 type flag is used
 
     g.LogEnabled = g.ItemUnclipByLog = true;
@@ -14277,6 +14777,18 @@ void ImGui::LogToBuffer(int auto_open_depth)
     LogBegin(ImGuiLogFlags_OutputBuffer, auto_open_depth);
 }
 
+// Start logging/capturing text output to a callback. LogFinish() calls it a last time with 'finish' = true.
+void ImGui::LogToCallback(ImGuiLogCallback callback, void* user_data, int auto_open_depth)
+{
+    ImGuiContext& g = *GImGui;
+    if (g.LogEnabled)
+        return;
+    IM_ASSERT(callback != NULL);
+    LogBegin(ImGuiLogFlags_OutputCallback, auto_open_depth);
+    g.LogCallback = callback;
+    g.LogCallbackUserData = user_data;
+}
+
 void ImGui::LogFinish()
 {
     ImGuiContext& g = *GImGui;
@@ -14292,8 +14804,12 @@ void ImGui::LogFinish()
 #endif
         break;
     case ImGuiLogFlags_OutputFile:
+        LogFlush(g, true);
         ImFileClose(g.LogFile);
         break;
+    case ImGuiLogFlags_OutputCallback:
+        LogFlush(g, true);
+        break;
     case ImGuiLogFlags_OutputBuffer:
         break;
     case ImGuiLogFlags_OutputClipboard:
@@ -14308,6 +14824,7 @@ void ImGui::LogFinish()
     g.LogEnabled = g.ItemUnclipByLog = false;
     g.LogFlags = ImGuiLogFlags_None;
     g.LogFile = NULL;
+    g.LogCallback = NULL;
     g.LogBuffer.clear();
 }
 
@@ -14365,6 +14882,7 @@ void ImGui::UpdateSettings()
 {
     // Load settings on first frame (if not explicitly loaded manually before)
     ImGuiContext& g = *GImGui;
+    IMGUI_PROFILER_SCOPE("UpdateSettings", 0);
     if (!g.SettingsLoaded)
     {
         IM_ASSERT(g.SettingsWindows.empty());
@@ -14454,6 +14972,7 @@ void ImGui::LoadIniSettingsFromMemory(const char* ini_data, size_t ini_size)
 {
     ImGuiContext& g = *GImGui;
     IM_ASSERT(g.Initialized);
+    IMGUI_DEBUG_ALLOC_OWNER_SCOPE(ImGuiDebugAllocOwner_Settings);
     //IM_ASSERT(!g.WithinFrameScope && "Cannot be called between NewFrame() and EndFrame()");
     //IM_ASSERT(g.SettingsLoaded == false && g.FrameCount == 0);
 
@@ -14540,6 +15059,7 @@ void ImGui::SaveIniSettingsToDisk(const char* ini_filename)
 const char* ImGui::SaveIniSettingsToMemory(size_t* out_size)
 {
     ImGuiContext& g = *GImGui;
+    IMGUI_DEBUG_ALLOC_OWNER_SCOPE(ImGuiDebugAllocOwner_Settings);
     g.SettingsDirtyTimer = 0.0f;
     g.SettingsIniData.Buf.resize(0);
     g.SettingsIniData.Buf.push_back(0);
@@ -14553,6 +15073,7 @@ const char* ImGui::SaveIniSettingsToMemory(size_t* out_size)
 ImGuiWindowSettings* ImGui::CreateNewWindowSettings(const char* name)
 {
     ImGuiContext& g = *GImGui;
+    IMGUI_DEBUG_ALLOC_OWNER_SCOPE(ImGuiDebugAllocOwner_Settings);
 
     if (g.IO.ConfigDebugIniSettings == false)
     {
@@ -14669,35 +15190,52 @@ static void WindowSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandl
             window->SettingsOffset = g.SettingsWindows.offset_from_ptr(settings);
         }
         IM_ASSERT(settings->ID == window->ID);
-        settings->Pos = ImVec2ih(window->Pos);
-        settings->Size = ImVec2ih(window->SizeFull);
-        settings->IsChild = (window->Flags & ImGuiWindowFlags_ChildWindow) != 0;
+        const ImVec2ih pos = ImVec2ih(window->Pos);
+        const ImVec2ih size = ImVec2ih(window->SizeFull);
+        const bool is_child = (window->Flags & ImGuiWindowFlags_ChildWindow) != 0;
+        if (settings->Pos.x != pos.x || settings->Pos.y != pos.y || settings->Size.x != size.x || settings->Size.y != size.y || settings->IsChild != is_child || settings->Collapsed != window->Collapsed)
+            settings->IniTextSize = 0; // Modified
+        settings->Pos = pos;
+        settings->Size = size;
+        settings->IsChild = is_child;
         settings->Collapsed = window->Collapsed;
         settings->WantDelete = false;
     }
 
-    // Write to text buffer
-    buf->reserve(buf->size() + g.SettingsWindows.size() * 6); // ballpark reserve
+    // Write to text buffer. Copy text of entries which didn't change since last save.
+    ImGuiSettingsWriteCache* cache = &g.SettingsWindowsWriteCache;
+    cache->Begin();
+    cache->Curr.reserve(cache->Prev.size() + 1);
     for (ImGuiWindowSettings* settings = g.SettingsWindows.begin(); settings != NULL; settings = g.SettingsWindows.next_chunk(settings))
     {
         if (settings->WantDelete)
+        {
+            settings->IniTextSize = 0;
+            continue;
+        }
+        if (cache->CopyEntry(&settings->IniTextOffset, &settings->IniTextSize))
             continue;
+        ImGuiTextBuffer* out = &cache->Curr;
+        const int entry_offset = out->size();
         const char* settings_name = settings->GetName();
-        buf->appendf("[%s][%s]\n", handler->TypeName, settings_name);
+        out->appendf("[%s][%s]\n", handler->TypeName, settings_name);
         if (settings->IsChild)
         {
-            buf->appendf("IsChild=1\n");
-            buf->appendf("Size=%d,%d\n", settings->Size.x, settings->Size.y);
+            out->appendf("IsChild=1\n");
+            out->appendf("Size=%d,%d\n", settings->Size.x, settings->Size.y);
         }
         else
         {
-            buf->appendf("Pos=%d,%d\n", settings->Pos.x, settings->Pos.y);
-            buf->appendf("Size=%d,%d\n", settings->Size.x, settings->Size.y);
+            out->appendf("Pos=%d,%d\n", settings->Pos.x, settings->Pos.y);
+            out->appendf("Size=%d,%d\n", settings->Size.x, settings->Size.y);
             if (settings->Collapsed)
-                buf->appendf("Collapsed=1\n");
+                out->appendf("Collapsed=1\n");
         }
-        buf->append("\n");
+        out->append("\n");
+        cache->EndEntry(entry_offset, &settings->IniTextOffset, &settings->IniTextSize);
     }
+    if (!cache->Curr.empty())
+        buf->append(cache->Curr.begin(), cache->Curr.end());
 }
 
 
@@ -15011,6 +15549,14 @@ static void Platform_SetImeDataFn_DefaultImpl(ImGuiContext*, ImGuiViewport*, ImG
 // - DebugNodeWindowSettings() [Internal]
 // - DebugNodeWindowsList() [Internal]
 // - DebugNodeWindowsListByBeginStackParent() [Internal]
+// - GetMemoryReport() [Internal]
+// - DebugNodeMemoryReport() [Internal]
+// - DebugNodeGcStats() [Internal]
+// - DebugDrawStatsBeginFrame() [Internal]
+// - DebugDrawStatsAddDrawList() [Internal]
+// - DebugDrawStatsEndFrame() [Internal]
+// - DebugDrawStatsGetFrame() [Internal]
+// - DebugNodeDrawStats() [Internal]
 //-----------------------------------------------------------------------------
 
 #ifndef IMGUI_DISABLE_DEBUG_TOOLS
@@ -15590,6 +16136,34 @@ void ImGui::ShowMetricsWindow(bool* p_open)
         TreePop();
     }
 
+    // Profiler
+    if (TreeNode("Profiler"))
+    {
+        DebugNodeProfiler(&g.Profiler);
+        TreePop();
+    }
+
+    // Draw statistics
+    if (TreeNode("Draw statistics"))
+    {
+        DebugNodeDrawStats(&g.DrawStats);
+        TreePop();
+    }
+
+    // Memory usage
+    if (TreeNode("Memory usage"))
+    {
+        DebugNodeMemoryReport();
+        TreePop();
+    }
+
+    // Memory compaction
+    if (TreeNode("Memory compaction"))
+    {
+        DebugNodeGcStats(&g.GcStats);
+        TreePop();
+    }
+
     // Settings
     if (TreeNode("Memory allocations"))
     {
@@ -15608,6 +16182,46 @@ void ImGui::ShowMetricsWindow(bool* p_open)
                 Text("<- %d frames ago", g.FrameCount - entry->FrameCount);
             }
         }
+
+        // Per owner
+        ImGuiDebugAllocFrameStats recent = {};
+        for (int n = 0; n < info->HistoryCount; n++)
+            for (int owner = 0; owner < ImGuiDebugAllocOwner_COUNT; owner++)
+            {
+                recent.AllocCount[owner] += info->History[n].AllocCount[owner];
+                recent.AllocBytes[owner] += info->History[n].AllocBytes[owner];
+            }
+        int recent_count = 0, recent_bytes = 0;
+        for (int owner = 0; owner < ImGuiDebugAllocOwner_COUNT; owner++)
+        {
+            recent_count += recent.AllocCount[owner];
+            recent_bytes += recent.AllocBytes[owner];
+        }
+        const float history_frames = (float)ImMax(info->HistoryCount, 1);
+        Text("Steady-state: %.2f allocations per frame (%.0f bytes), over last %d frames.", recent_count / history_frames, recent_bytes / history_frames, info->HistoryCount);
+        SameLine();
+        MetricsHelpMarker("Allocations made between two NewFrame() calls, including your code.\nOwner is deduced from current window/table or subsystem (see ImGuiDebugAllocOwner). Buffers of draw lists are identified by comparing pointers.\nAim for zero on repeating frames.");
+        if (BeginTable("##owners", 5, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit))
+        {
+            TableSetupColumn("Owner");
+            TableSetupColumn("Allocs/frame");
+            TableSetupColumn("Bytes/frame");
+            TableSetupColumn("Total allocs");
+            TableSetupColumn("Total bytes");
+            TableHeadersRow();
+            for (int owner = 0; owner < ImGuiDebugAllocOwner_COUNT; owner++)
+            {
+                TableNextRow();
+                if (recent.AllocCount[owner] > 0)
+                    TableSetBgColor(ImGuiTableBgTarget_RowBg1, GetColorU32(ImVec4(1.0f, 0.4f, 0.4f, 0.25f)));
+                TableNextColumn(); TextUnformatted(DebugAllocGetOwnerName((ImGuiDebugAllocOwner)owner));
+                TableNextColumn(); Text("%.2f", recent.AllocCount[owner] / history_frames);
+                TableNextColumn(); Text("%.0f", recent.AllocBytes[owner] / history_frames);
+                TableNextColumn(); Text("%d", info->OwnerTotalCount[owner]);
+                TableNextColumn(); Text("%llu", (unsigned long long)info->OwnerTotalBytes[owner]);
+            }
+            EndTable();
+        }
         TreePop();
     }
 
@@ -16292,6 +16906,509 @@ void ImGui::DebugNodeWindowsListByBeginStackParent(ImGuiWindow** windows, int wi
     }
 }
 
+static void MemoryReportAdd(ImGuiMemoryReport* report, ImGuiMemoryReportType type, ImGuiID owner_id, const char* owner_name, const char* part, size_t used_bytes, size_t capacity_bytes)
+{
+    if (capacity_bytes == 0)
+        return;
+    ImGuiMemoryReportEntry entry = { type, owner_id, owner_name, part, used_bytes, capacity_bytes };
+    report->Entries.push_back(entry);
+    report->TotalUsedBytes[type] += used_bytes;
+    report->TotalCapacityBytes[type] += capacity_bytes;
+}
+
+template<typename T>
+static void MemoryReportAddVector(ImGuiMemoryReport* report, ImGuiMemoryReportType type, ImGuiID owner_id, const char* owner_name, const char* part, const ImVector<T>& v)
+{
+    MemoryReportAdd(report, type, owner_id, owner_name, part, (size_t)v.Size * sizeof(T), (size_t)v.Capacity * sizeof(T));
+}
+
+static void MemoryReportAddSplitter(ImGuiMemoryReport* report, ImGuiMemoryReportType type, ImGuiID owner_id, const char* owner_name, const char* part, const ImDrawListSplitter& splitter)
+{
+    size_t used_bytes = (size_t)splitter._Channels.Size * sizeof(ImDrawChannel);
+    size_t capacity_bytes = (size_t)splitter._Channels.Capacity * sizeof(ImDrawChannel);
+    for (const ImDrawChannel& channel : splitter._Channels)
+    {
+        used_bytes += (size_t)channel._CmdBuffer.size_in_bytes() + (size_t)channel._IdxBuffer.size_in_bytes();
+        capacity_bytes += (size_t)channel._CmdBuffer.Capacity * sizeof(ImDrawCmd) + (size_t)channel._IdxBuffer.Capacity * sizeof(ImDrawIdx);
+    }
+    MemoryReportAdd(report, type, owner_id, owner_name, part, used_bytes, capacity_bytes);
+}
+
+static void MemoryReportAddDrawList(ImGuiMemoryReport* report, ImGuiMemoryReportType type, ImGuiID owner_id, const char* owner_name, const ImDrawList* draw_list)
+{
+    MemoryReportAddVector(report, type, owner_id, owner_name, "DrawList.CmdBuffer", draw_list->CmdBuffer);
+    MemoryReportAddVector(report, type, owner_id, owner_name, "DrawList.IdxBuffer", draw_list->IdxBuffer);
+    MemoryReportAddVector(report, type, owner_id, owner_name, "DrawList.VtxBuffer", draw_list->VtxBuffer);
+    MemoryReportAddVector(report, type, owner_id, owner_name, "DrawList._Path", draw_list->_Path);
+    MemoryReportAddVector(report, type, owner_id, owner_name, "DrawList._ClipRectStack", draw_list->_ClipRectStack);
+    MemoryReportAddVector(report, type, owner_id, owner_name, "DrawList._TextureIdStack", draw_list->_TextureIdStack);
+    MemoryReportAddVector(report, type, owner_id, owner_name, "DrawList._CallbacksDataBuf", draw_list->_CallbacksDataBuf);
+    MemoryReportAddSplitter(report, type, owner_id, owner_name, "DrawList._Splitter", draw_list->_Splitter);
+}
+
+// Enumerate heap buffers we know about. Sizes are computed from ImVector<> Size/Capacity, so they don't include allocator overhead.
+// This is O(number of windows + tables + fonts), it is fine to call every frame while inspecting.
+void ImGui::GetMemoryReport(ImGuiMemoryReport* out_report)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiMemoryReport* report = out_report;
+    report->Clear();
+
+    // Windows
+    const ImGuiMemoryReportType type_window = ImGuiMemoryReportType_Window;
+    for (ImGuiWindow* window : g.Windows)
+    {
+        MemoryReportAdd(report, type_window, window->ID, window->Name, "ImGuiWindow", sizeof(ImGuiWindow), sizeof(ImGuiWindow));
+        MemoryReportAdd(report, type_window, window->ID, window->Name, "Name", strlen(window->Name) + 1, strlen(window->Name) + 1);
+        MemoryReportAddDrawList(report, type_window, window->ID, window->Name, window->DrawList);
+        MemoryReportAddVector(report, type_window, window->ID, window->Name, "IDStack", window->IDStack);
+        MemoryReportAddVector(report, type_window, window->ID, window->Name, "StateStorage", window->StateStorage.Data);
+        MemoryReportAddVector(report, type_window, window->ID, window->Name, "DC.ChildWindows", window->DC.ChildWindows);
+        MemoryReportAddVector(report, type_window, window->ID, window->Name, "DC.ItemWidthStack", window->DC.ItemWidthStack);
+        MemoryReportAddVector(report, type_window, window->ID, window->Name, "DC.TextWrapPosStack", window->DC.TextWrapPosStack);
+        MemoryReportAddVector(report, type_window, window->ID, window->Name, "ColumnsStorage", window->ColumnsStorage);
+        for (ImGuiOldColumns& columns : window->ColumnsStorage)
+        {
+            MemoryReportAddVector(report, type_window, window->ID, window->Name, "ColumnsStorage[].Columns", columns.Columns);
+            MemoryReportAddSplitter(report, type_window, window->ID, window->Name, "ColumnsStorage[].Splitter", columns.Splitter);
+        }
+    }
+
+    // Tables
+    const ImGuiMemoryReportType type_table = ImGuiMemoryReportType_Table;
+    for (int n = 0; n < g.Tables.GetMapSize(); n++)
+        if (ImGuiTable* table = g.Tables.TryGetMapData(n))
+        {
+            const char* name = table->OuterWindow ? table->OuterWindow->Name : "";
+            const size_t raw_data_bytes = (size_t)table->Columns.size_in_bytes() + (size_t)table->DisplayOrderToIndex.size_in_bytes() + (size_t)table->RowCellData.size_in_bytes();
+            MemoryReportAdd(report, type_table, table->ID, name, "RawData", raw_data_bytes, raw_data_bytes);
+            MemoryReportAddVector(report, type_table, table->ID, name, "ColumnsNames", table->ColumnsNames.Buf);
+            MemoryReportAddVector(report, type_table, table->ID, name, "InstanceDataExtra", table->InstanceDataExtra);
+            MemoryReportAddVector(report, type_table, table->ID, name, "SortSpecsMulti", table->SortSpecsMulti);
+        }
+    MemoryReportAddVector(report, type_table, 0, "(pool)", "Tables", g.Tables.Buf);
+    MemoryReportAddVector(report, type_table, 0, "(pool)", "TablesTempData", g.TablesTempData);
+    for (ImGuiTableTempData& temp_data : g.TablesTempData)
+    {
+        MemoryReportAddSplitter(report, type_table, 0, "(temp data)", "DrawSplitter", temp_data.DrawSplitter);
+        MemoryReportAddVector(report, type_table, 0, "(temp data)", "AngledHeadersRequests", temp_data.AngledHeadersRequests);
+    }
+
+    // Fonts
+    const ImGuiMemoryReportType type_font = ImGuiMemoryReportType_Font;
+    ImFontAtlas* atlas = g.IO.Fonts;
+    const size_t tex_pixels_count = (size_t)atlas->TexWidth * (size_t)atlas->TexHeight;
+    MemoryReportAdd(report, type_font, 0, "(atlas)", "TexPixelsAlpha8", atlas->TexPixelsAlpha8 ? tex_pixels_count : 0, atlas->TexPixelsAlpha8 ? tex_pixels_count : 0);
+    MemoryReportAdd(report, type_font, 0, "(atlas)", "TexPixelsRGBA32", atlas->TexPixelsRGBA32 ? tex_pixels_count * 4 : 0, atlas->TexPixelsRGBA32 ? tex_pixels_count * 4 : 0);
+    MemoryReportAddVector(report, type_font, 0, "(atlas)", "ConfigData", atlas->ConfigData);
+    MemoryReportAddVector(report, type_font, 0, "(atlas)", "CustomRects", atlas->CustomRects);
+    for (ImFontConfig& font_cfg : atlas->ConfigData)
+        if (font_cfg.FontDataOwnedByAtlas)
+            MemoryReportAdd(report, type_font, 0, font_cfg.Name, "FontData", (size_t)font_cfg.FontDataSize, (size_t)font_cfg.FontDataSize);
+    for (ImFont* font : atlas->Fonts)
+    {
+        const char* name = font->GetDebugName();
+        MemoryReportAdd(report, type_font, 0, name, "ImFont", sizeof(ImFont), sizeof(ImFont));
+        MemoryReportAddVector(report, type_font, 0, name, "Glyphs", font->Glyphs);
+        MemoryReportAddVector(report, type_font, 0, name, "IndexAdvanceX", font->IndexAdvanceX);
+        MemoryReportAddVector(report, type_font, 0, name, "IndexLookup", font->IndexLookup);
+    }
+
+    // Settings
+    const ImGuiMemoryReportType type_settings = ImGuiMemoryReportType_Settings;
+    MemoryReportAddVector(report, type_settings, 0, "", "SettingsIniData", g.SettingsIniData.Buf);
+    MemoryReportAddVector(report, type_settings, 0, "", "SettingsHandlers", g.SettingsHandlers);
+    MemoryReportAddVector(report, type_settings, 0, "", "SettingsWindows", g.SettingsWindows.Buf);
+    MemoryReportAddVector(report, type_settings, 0, "", "SettingsTables", g.SettingsTables.Buf);
+    MemoryReportAddVector(report, type_settings, 0, "", "SettingsWindowsWriteCache.Prev", g.SettingsWindowsWriteCache.Prev.Buf);
+    MemoryReportAddVector(report, type_settings, 0, "", "SettingsWindowsWriteCache.Curr", g.SettingsWindowsWriteCache.Curr.Buf);
+    MemoryReportAddVector(report, type_settings, 0, "", "SettingsTablesWriteCache.Prev", g.SettingsTablesWriteCache.Prev.Buf);
+    MemoryReportAddVector(report, type_settings, 0, "", "SettingsTablesWriteCache.Curr", g.SettingsTablesWriteCache.Curr.Buf);
+
+    // Clipper
+    const ImGuiMemoryReportType type_clipper = ImGuiMemoryReportType_Clipper;
+    MemoryReportAddVector(report, type_clipper, 0, "", "ClipperTempData", g.ClipperTempData);
+    for (ImGuiListClipperData& clipper_data : g.ClipperTempData)
+        MemoryReportAddVector(report, type_clipper, 0, "", "ClipperTempData[].Ranges", clipper_data.Ranges);
+
+    // Context
+    const ImGuiMemoryReportType type_context = ImGuiMemoryReportType_Context;
+    MemoryReportAddVector(report, type_context, 0, "", "Windows", g.Windows);
+    MemoryReportAddVector(report, type_context, 0, "", "WindowsFocusOrder", g.WindowsFocusOrder);
+    MemoryReportAddVector(report, type_context, 0, "", "WindowsTempSortBuffer", g.WindowsTempSortBuffer);
+    MemoryReportAddVector(report, type_context, 0, "", "WindowsById", g.WindowsById.Data);
+    MemoryReportAddVector(report, type_context, 0, "", "CurrentWindowStack", g.CurrentWindowStack);
+    for (ImGuiViewportP* viewport : g.Viewports)
+    {
+        MemoryReportAddVector(report, type_context, 0, "Viewport", "DrawDataP.CmdLists", viewport->DrawDataP.CmdLists);
+        MemoryReportAddVector(report, type_context, 0, "Viewport", "DrawDataBuilder.LayerData1", viewport->DrawDataBuilder.LayerData1);
+        if (viewport->BgFgDrawLists[0] != NULL)
+            MemoryReportAddDrawList(report, type_context, 0, "Viewport Background", viewport->BgFgDrawLists[0]);
+        if (viewport->BgFgDrawLists[1] != NULL)
+            MemoryReportAddDrawList(report, type_context, 0, "Viewport Foreground", viewport->BgFgDrawLists[1]);
+    }
+    MemoryReportAddVector(report, type_context, 0, "InputText", "TextA", g.InputTextState.TextA);
+    MemoryReportAddVector(report, type_context, 0, "InputText", "TextToRevertTo", g.InputTextState.TextToRevertTo);
+    MemoryReportAddVector(report, type_context, 0, "InputText", "CallbackTextBackup", g.InputTextState.CallbackTextBackup);
+    MemoryReportAddVector(report, type_context, 0, "InputText", "LineStarts", g.InputTextState.LineStarts);
+    MemoryReportAddVector(report, type_context, 0, "InputText", "DeactivatedState.TextA", g.InputTextDeactivatedState.TextA);
+    MemoryReportAddVector(report, type_context, 0, "", "DebugLogBuf", g.DebugLogBuf.Buf);
+    MemoryReportAddVector(report, type_context, 0, "", "DebugLogIndex", g.DebugLogIndex.LineOffsets);
+    MemoryReportAddVector(report, type_context, 0, "", "LogBuffer", g.LogBuffer.Buf);
+    MemoryReportAddVector(report, type_context, 0, "", "TempBuffer", g.TempBuffer);
+    MemoryReportAddVector(report, type_context, 0, "Profiler", "Frames", g.Profiler.Frames);
+    size_t profiler_zones_used = 0, profiler_zones_capacity = 0;
+    for (ImGuiProfilerFrame& frame : g.Profiler.Frames)
+    {
+        profiler_zones_used += (size_t)frame.Zones.size_in_bytes();
+        profiler_zones_capacity += (size_t)frame.Zones.Capacity * sizeof(ImGuiProfilerZone);
+    }
+    MemoryReportAdd(report, type_context, 0, "Profiler", "Frames[].Zones", profiler_zones_used, profiler_zones_capacity);
+}
+
+static const char* MetricsFormatBytes(char* buf, int buf_size, size_t bytes)
+{
+    if (bytes < 1024)
+        ImFormatString(buf, (size_t)buf_size, "%d B", (int)bytes);
+    else if (bytes < 1024 * 1024)
+        ImFormatString(buf, (size_t)buf_size, "%.1f KB", (double)bytes / 1024.0);
+    else
+        ImFormatString(buf, (size_t)buf_size, "%.2f MB", (double)bytes / (1024.0 * 1024.0));
+    return buf;
+}
+
+void ImGui::DebugNodeMemoryReport()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiMetricsConfig* cfg = &g.DebugMetricsConfig;
+    static const char* type_names[] = { "Context", "Window", "Table", "Font", "Settings", "Clipper" };
+    IM_STATIC_ASSERT(IM_ARRAYSIZE(type_names) == ImGuiMemoryReportType_COUNT);
+
+    ImGuiMemoryReport report;
+    GetMemoryReport(&report);
+
+    // Totals per type
+    char buf_used[32], buf_capacity[32];
+    size_t total_used = 0, total_capacity = 0;
+    for (int type = 0; type < ImGuiMemoryReportType_COUNT; type++)
+    {
+        total_used += report.TotalUsedBytes[type];
+        total_capacity += report.TotalCapacityBytes[type];
+    }
+    Text("Total: %s used, %s allocated", MetricsFormatBytes(buf_used, IM_ARRAYSIZE(buf_used), total_used), MetricsFormatBytes(buf_capacity, IM_ARRAYSIZE(buf_capacity), total_capacity));
+    SameLine();
+    MetricsHelpMarker("Heap buffers known to Dear ImGui, computed from Size/Capacity of containers. Does not include allocator overhead.\nWindows and tables which are not used release most of their buffers after io.ConfigMemoryCompactTimer seconds.");
+    for (int type = 0; type < ImGuiMemoryReportType_COUNT; type++)
+        BulletText("%s: %s used, %s allocated", type_names[type], MetricsFormatBytes(buf_used, IM_ARRAYSIZE(buf_used), report.TotalUsedBytes[type]), MetricsFormatBytes(buf_capacity, IM_ARRAYSIZE(buf_capacity), report.TotalCapacityBytes[type]));
+    Checkbox("Group by owner", &cfg->MemoryReportGroupByOwner);
+
+    // Group by owner: merge consecutive entries of a same owner (entries are added owner by owner)
+    ImVector<ImGuiMemoryReportEntry>& entries = report.Entries;
+    if (cfg->MemoryReportGroupByOwner)
+    {
+        int dst_n = 0;
+        for (int src_n = 0; src_n < entries.Size; src_n++)
+        {
+            const ImGuiMemoryReportEntry& src = entries[src_n];
+            ImGuiMemoryReportEntry* dst = (dst_n > 0) ? &entries[dst_n - 1] : NULL;
+            if (dst != NULL && dst->Type == src.Type && dst->OwnerID == src.OwnerID && strcmp(dst->OwnerName, src.OwnerName) == 0)
+            {
+                dst->UsedBytes += src.UsedBytes;
+                dst->CapacityBytes += src.CapacityBytes;
+                dst->Part = "(all)";
+                continue;
+            }
+            entries[dst_n++] = src;
+        }
+        entries.resize(dst_n);
+    }
+
+    const ImGuiTableFlags flags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_Sortable | ImGuiTableFlags_SizingFixedFit | ImGuiTableFlags_ScrollY | ImGuiTableFlags_Resizable;
+    if (!BeginTable("##memory_report", 5, flags, ImVec2(0.0f, GetTextLineHeightWithSpacing() * 20)))
+        return;
+    TableSetupScrollFreeze(0, 1);
+    TableSetupColumn("Type");
+    TableSetupColumn("Owner");
+    TableSetupColumn("Part");
+    TableSetupColumn("Used", ImGuiTableColumnFlags_PreferSortDescending);
+    TableSetupColumn("Allocated", ImGuiTableColumnFlags_DefaultSort | ImGuiTableColumnFlags_PreferSortDescending);
+    TableHeadersRow();
+
+    // Sort (we rebuild report every frame, so we sort every frame)
+    if (ImGuiTableSortSpecs* sort_specs = TableGetSortSpecs())
+        if (sort_specs->SpecsCount > 0)
+        {
+            struct Func
+            {
+                static int IMGUI_CDECL CompareType(const void* lhs, const void* rhs)        { return (int)((const ImGuiMemoryReportEntry*)lhs)->Type - (int)((const ImGuiMemoryReportEntry*)rhs)->Type; }
+                static int IMGUI_CDECL CompareOwner(const void* lhs, const void* rhs)       { return strcmp(((const ImGuiMemoryReportEntry*)lhs)->OwnerName, ((const ImGuiMemoryReportEntry*)rhs)->OwnerName); }
+                static int IMGUI_CDECL ComparePart(const void* lhs, const void* rhs)        { return strcmp(((const ImGuiMemoryReportEntry*)lhs)->Part, ((const ImGuiMemoryReportEntry*)rhs)->Part); }
+                static int IMGUI_CDECL CompareUsed(const void* lhs, const void* rhs)        { size_t a = ((const ImGuiMemoryReportEntry*)lhs)->UsedBytes, b = ((const ImGuiMemoryReportEntry*)rhs)->UsedBytes; return (a < b) ? -1 : (a > b) ? +1 : 0; }
+                static int IMGUI_CDECL CompareCapacity(const void* lhs, const void* rhs)    { size_t a = ((const ImGuiMemoryReportEntry*)lhs)->CapacityBytes, b = ((const ImGuiMemoryReportEntry*)rhs)->CapacityBytes; return (a < b) ? -1 : (a > b) ? +1 : 0; }
+            };
+            typedef int (IMGUI_CDECL *CompareFunc)(const void*, const void*);
+            const CompareFunc compare_funcs[] = { Func::CompareType, Func::CompareOwner, Func::ComparePart, Func::CompareUsed, Func::CompareCapacity };
+            const ImGuiTableColumnSortSpecs* spec = &sort_specs->Specs[0];
+            ImQsort(entries.Data, (size_t)entries.Size, sizeof(ImGuiMemoryReportEntry), compare_funcs[spec->ColumnIndex]);
+            if (spec->SortDirection == ImGuiSortDirection_Descending)
+                for (int n = 0; n < entries.Size / 2; n++)
+                    ImSwap(entries[n], entries[entries.Size - 1 - n]);
+        }
+
+    ImGuiListClipper clipper;
+    clipper.Begin(entries.Size);
+    while (clipper.Step())
+        for (int n = clipper.DisplayStart; n < clipper.DisplayEnd; n++)
+        {
+            const ImGuiMemoryReportEntry& entry = entries[n];
+            TableNextRow();
+            TableNextColumn(); TextUnformatted(type_names[entry.Type]);
+            TableNextColumn(); TextUnformatted(entry.OwnerName, FindRenderedTextEnd(entry.OwnerName));
+            TableNextColumn(); TextUnformatted(entry.Part);
+            TableNextColumn(); TextUnformatted(MetricsFormatBytes(buf_used, IM_ARRAYSIZE(buf_used), entry.UsedBytes));
+            TableNextColumn(); TextUnformatted(MetricsFormatBytes(buf_capacity, IM_ARRAYSIZE(buf_capacity), entry.CapacityBytes));
+        }
+    EndTable();
+}
+
+void ImGui::DebugNodeGcStats(ImGuiGcStats* stats)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiIO& io = g.IO;
+    char buf_a[32], buf_b[32];
+    if (io.ConfigMemoryCompactTimer >= 0.0f)
+        Text("io.ConfigMemoryCompactTimer: %.1f sec", io.ConfigMemoryCompactTimer);
+    else
+        Text("io.ConfigMemoryCompactTimer: disabled");
+    Text("io.ConfigMemoryCompactBudget: %s", io.ConfigMemoryCompactBudget > 0 ? MetricsFormatBytes(buf_a, IM_ARRAYSIZE(buf_a), (size_t)io.ConfigMemoryCompactBudget) : "disabled");
+    if (io.ConfigMemoryShrinkDrawListFrames > 0)
+        Text("io.ConfigMemoryShrinkDrawListFrames: %d frames", io.ConfigMemoryShrinkDrawListFrames);
+    else
+        Text("io.ConfigMemoryShrinkDrawListFrames: disabled");
+    SameLine();
+    MetricsHelpMarker(
+        "Transient buffers of windows and tables (draw lists, ID stacks, tables draw channels...) are freed:\n"
+        "- after not being used for io.ConfigMemoryCompactTimer seconds.\n"
+        "- least recently used first, when their total exceeds io.ConfigMemoryCompactBudget bytes.\n"
+        "Draw list buffers of active windows are reallocated to fit after using less than half of their capacity for io.ConfigMemoryShrinkDrawListFrames frames.");
+
+    if (io.ConfigMemoryCompactBudget > 0)
+    {
+        ImFormatString(buf_b, IM_ARRAYSIZE(buf_b), "%s / ", MetricsFormatBytes(buf_a, IM_ARRAYSIZE(buf_a), stats->TransientBytes));
+        char overlay[64];
+        ImFormatString(overlay, IM_ARRAYSIZE(overlay), "%s%s", buf_b, MetricsFormatBytes(buf_a, IM_ARRAYSIZE(buf_a), (size_t)io.ConfigMemoryCompactBudget));
+        ProgressBar((float)((double)stats->TransientBytes / (double)io.ConfigMemoryCompactBudget), ImVec2(-FLT_MIN, 0.0f), overlay);
+    }
+    else
+    {
+        TextDisabled("Transient buffers are measured when io.ConfigMemoryCompactBudget > 0.");
+    }
+
+    int windows_compacted = 0;
+    for (ImGuiWindow* window : g.Windows)
+        if (window->MemoryCompacted)
+            windows_compacted++;
+    BulletText("Windows currently compacted: %d/%d", windows_compacted, g.Windows.Size);
+    BulletText("Windows compacted: %d, Tables compacted: %d (%d to fit budget)", stats->WindowsCompactedCount, stats->TablesCompactedCount, stats->BudgetCompactedCount);
+    BulletText("Draw lists shrunk: %d (%s released)", stats->DrawListsShrunkCount, MetricsFormatBytes(buf_a, IM_ARRAYSIZE(buf_a), stats->DrawListsShrunkBytes));
+}
+
+void ImGui::DebugDrawStatsBeginFrame()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiDrawStats* stats = &g.DrawStats;
+    stats->Recording = true;
+    stats->CurrFrame = ImGuiDrawStatsFrame();
+    stats->CurrFrame.FrameCount = g.FrameCount;
+    for (ImGuiViewportP* viewport : g.Viewports)
+        stats->CurrFrame.DisplayArea += viewport->Size.x * viewport->Size.y;
+    stats->CurrLists.resize(0);
+}
+
+// Estimate pixels covered by the triangles of a draw command.
+// Triangles partially outside of the clipping rectangle are scaled by the visible fraction of their bounding box.
+static float DebugDrawStatsCalcPixelsDrawn(const ImDrawList* draw_list, const ImDrawCmd* cmd)
+{
+    const ImDrawVert* vtx_buffer = draw_list->VtxBuffer.Data + cmd->VtxOffset;
+    const ImDrawIdx* idx_buffer = draw_list->IdxBuffer.Data + cmd->IdxOffset;
+    const ImRect clip_rect(cmd->ClipRect);
+    float pixels = 0.0f;
+    for (unsigned int idx_n = 0; idx_n + 2 < cmd->ElemCount; idx_n += 3)
+    {
+        const ImVec2 a = vtx_buffer[idx_buffer[idx_n]].pos;
+        const ImVec2 b = vtx_buffer[idx_buffer[idx_n + 1]].pos;
+        const ImVec2 c = vtx_buffer[idx_buffer[idx_n + 2]].pos;
+        const float area = ImTriangleArea(a, b, c);
+        if (area <= 0.0f)
+            continue;
+        ImRect tri_bb(ImMin(ImMin(a, b), c), ImMax(ImMax(a, b), c));
+        if (clip_rect.Contains(tri_bb))
+        {
+            pixels += area;
+            continue;
+        }
+        const float tri_bb_area = tri_bb.GetArea();
+        tri_bb.ClipWithFull(clip_rect);
+        if (tri_bb.Min.x < tri_bb.Max.x && tri_bb.Min.y < tri_bb.Max.y)
+            pixels += area * (tri_bb.GetArea() / tri_bb_area);
+    }
+    return pixels;
+}
+
+void ImGui::DebugDrawStatsAddDrawList(const ImDrawList* draw_list)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiDrawStats* stats = &g.DrawStats;
+    stats->CurrLists.push_back(ImGuiDrawStatsList());
+    ImGuiDrawStatsList* list_stats = &stats->CurrLists.back();
+    list_stats->OwnerName = draw_list->_OwnerName;
+    list_stats->CmdMergedCount = draw_list->_CmdMergedCount;
+    list_stats->VtxCount = draw_list->VtxBuffer.Size;
+    list_stats->IdxCount = draw_list->IdxBuffer.Size;
+
+    const ImDrawCmd* prev_cmd = NULL;
+    for (const ImDrawCmd& cmd : draw_list->CmdBuffer)
+    {
+        if (cmd.UserCallback != NULL)
+        {
+            list_stats->CallbackCount++;
+            continue;
+        }
+        if (cmd.ElemCount == 0)
+            continue;
+        list_stats->CmdCount++;
+        if (prev_cmd != NULL && prev_cmd->GetTexID() != cmd.GetTexID())
+            list_stats->TextureChanges++;
+        if (prev_cmd != NULL && memcmp(&prev_cmd->ClipRect, &cmd.ClipRect, sizeof(ImVec4)) != 0)
+            list_stats->ClipRectChanges++;
+        list_stats->PixelsDrawn += DebugDrawStatsCalcPixelsDrawn(draw_list, &cmd);
+        prev_cmd = &cmd;
+    }
+
+    ImGuiDrawStatsList* totals = &stats->CurrFrame.Totals;
+    totals->CmdCount += list_stats->CmdCount;
+    totals->CmdMergedCount += list_stats->CmdMergedCount;
+    totals->CallbackCount += list_stats->CallbackCount;
+    totals->TextureChanges += list_stats->TextureChanges;
+    totals->ClipRectChanges += list_stats->ClipRectChanges;
+    totals->VtxCount += list_stats->VtxCount;
+    totals->IdxCount += list_stats->IdxCount;
+    totals->PixelsDrawn += list_stats->PixelsDrawn;
+    stats->CurrFrame.DrawListsCount++;
+}
+
+void ImGui::DebugDrawStatsEndFrame()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiDrawStats* stats = &g.DrawStats;
+    IM_ASSERT(stats->Recording);
+    stats->Recording = false;
+    if (stats->Frames.Size != stats->FramesMax)
+    {
+        stats->Frames.resize(stats->FramesMax);
+        stats->FramesIdx = stats->FramesCount = 0;
+    }
+    stats->Frames[stats->FramesIdx] = stats->CurrFrame;
+    stats->FramesIdx = (stats->FramesIdx + 1) % stats->FramesMax;
+    stats->FramesCount = ImMin(stats->FramesCount + 1, stats->FramesMax);
+    stats->Lists.swap(stats->CurrLists);
+}
+
+const ImGuiDrawStatsFrame* ImGui::DebugDrawStatsGetFrame(int frame_offset)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiDrawStats* stats = &g.DrawStats;
+    if (frame_offset < 0 || frame_offset >= stats->FramesCount)
+        return NULL;
+    int frame_idx = stats->FramesIdx - 1 - frame_offset;
+    if (frame_idx < 0)
+        frame_idx += stats->Frames.Size;
+    return &stats->Frames[frame_idx];
+}
+
+void ImGui::DebugNodeDrawStats(ImGuiDrawStats* stats)
+{
+    Checkbox("Enabled", &stats->Enabled);
+    SameLine();
+    if (SmallButton("Clear"))
+        stats->ClearFrames();
+    SameLine();
+    MetricsHelpMarker(
+        "Collected when adding draw lists to ImDrawData in Render().\n"
+        "- Merged: new draw commands folded back into previous one because their state matched.\n"
+        "- Texture/clip changes: draw calls which couldn't be batched with previous one because of a different texture/clipping rectangle.\n"
+        "- Overdraw: estimated pixels drawn divided by display area. Walks every triangle: keep disabled when not needed.");
+
+    const ImGuiDrawStatsFrame* last_frame = DebugDrawStatsGetFrame(0);
+    if (last_frame == NULL)
+    {
+        TextDisabled("No frame recorded.");
+        return;
+    }
+
+    // History, oldest on the left
+    struct Funcs
+    {
+        static const ImGuiDrawStatsFrame* GetFrame(void* data, int idx) { return DebugDrawStatsGetFrame((int)(intptr_t)data - 1 - idx); }
+        static float GetCmdCount(void* data, int idx)           { return (float)GetFrame(data, idx)->Totals.CmdCount; }
+        static float GetCmdMergedCount(void* data, int idx)     { return (float)GetFrame(data, idx)->Totals.CmdMergedCount; }
+        static float GetTextureChanges(void* data, int idx)     { return (float)GetFrame(data, idx)->Totals.TextureChanges; }
+        static float GetClipRectChanges(void* data, int idx)    { return (float)GetFrame(data, idx)->Totals.ClipRectChanges; }
+        static float GetVtxCount(void* data, int idx)           { return (float)GetFrame(data, idx)->Totals.VtxCount; }
+        static float GetOverdraw(void* data, int idx)           { return GetFrame(data, idx)->GetOverdraw(); }
+    };
+    const int frames_count = stats->FramesCount;
+    void* frames_data = (void*)(intptr_t)frames_count;
+    const ImVec2 plot_size(0.0f, GetTextLineHeight() * 3.0f);
+    char overlay[64];
+    ImFormatString(overlay, IM_ARRAYSIZE(overlay), "%d draw calls", last_frame->Totals.CmdCount);
+    PlotLines("Draw calls", Funcs::GetCmdCount, frames_data, frames_count, 0, overlay, 0.0f, FLT_MAX, plot_size);
+    ImFormatString(overlay, IM_ARRAYSIZE(overlay), "%d merged", last_frame->Totals.CmdMergedCount);
+    PlotLines("Merged", Funcs::GetCmdMergedCount, frames_data, frames_count, 0, overlay, 0.0f, FLT_MAX, plot_size);
+    ImFormatString(overlay, IM_ARRAYSIZE(overlay), "%d texture changes", last_frame->Totals.TextureChanges);
+    PlotLines("Texture changes", Funcs::GetTextureChanges, frames_data, frames_count, 0, overlay, 0.0f, FLT_MAX, plot_size);
+    ImFormatString(overlay, IM_ARRAYSIZE(overlay), "%d clip rect changes", last_frame->Totals.ClipRectChanges);
+    PlotLines("Clip rect changes", Funcs::GetClipRectChanges, frames_data, frames_count, 0, overlay, 0.0f, FLT_MAX, plot_size);
+    ImFormatString(overlay, IM_ARRAYSIZE(overlay), "%d vertices", last_frame->Totals.VtxCount);
+    PlotLines("Vertices", Funcs::GetVtxCount, frames_data, frames_count, 0, overlay, 0.0f, FLT_MAX, plot_size);
+    ImFormatString(overlay, IM_ARRAYSIZE(overlay), "%.2fx", last_frame->GetOverdraw());
+    PlotLines("Overdraw", Funcs::GetOverdraw, frames_data, frames_count, 0, overlay, 0.0f, FLT_MAX, plot_size);
+
+    // Per draw list breakdown of last frame
+    if (!TreeNode("DrawLists", "Last frame: %d draw lists", stats->Lists.Size))
+        return;
+    const ImGuiTableFlags table_flags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit | ImGuiTableFlags_ScrollY;
+    if (BeginTable("##drawstats", 8, table_flags, ImVec2(0.0f, GetTextLineHeightWithSpacing() * 12)))
+    {
+        TableSetupScrollFreeze(0, 1);
+        TableSetupColumn("Owner", ImGuiTableColumnFlags_WidthStretch);
+        TableSetupColumn("Draw calls");
+        TableSetupColumn("Merged");
+        TableSetupColumn("Callbacks");
+        TableSetupColumn("Tex chg");
+        TableSetupColumn("Clip chg");
+        TableSetupColumn("Vtx");
+        TableSetupColumn("Overdraw");
+        TableHeadersRow();
+        const float display_area = last_frame->DisplayArea;
+        for (const ImGuiDrawStatsList& list_stats : stats->Lists)
+        {
+            const char* owner_name = list_stats.OwnerName ? list_stats.OwnerName : "NULL";
+            TableNextRow();
+            TableNextColumn(); TextUnformatted(owner_name, FindRenderedTextEnd(owner_name));
+            TableNextColumn(); Text("%d", list_stats.CmdCount);
+            TableNextColumn(); Text("%d", list_stats.CmdMergedCount);
+            TableNextColumn(); Text("%d", list_stats.CallbackCount);
+            TableNextColumn(); Text("%d", list_stats.TextureChanges);
+            TableNextColumn(); Text("%d", list_stats.ClipRectChanges);
+            TableNextColumn(); Text("%d", list_stats.VtxCount);
+            TableNextColumn(); Text("%.3fx", display_area > 0.0f ? list_stats.PixelsDrawn / display_area : 0.0f);
+        }
+        EndTable();
+    }
+    TreePop();
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] DEBUG LOG WINDOW
 //-----------------------------------------------------------------------------
@@ -16307,6 +17424,7 @@ void ImGui::DebugLog(const char* fmt, ...)
 void ImGui::DebugLogV(const char* fmt, va_list args)
 {
     ImGuiContext& g = *GImGui;
+    IMGUI_DEBUG_ALLOC_OWNER_SCOPE(ImGuiDebugAllocOwner_TextLog);
     const int old_size = g.DebugLogBuf.size();
     if (g.ContextName[0] != 0)
         g.DebugLogBuf.appendf("[%s] [%05d] ", g.ContextName, g.FrameCount);
@@ -16316,6 +17434,16 @@ void ImGui::DebugLogV(const char* fmt, va_list args)
     g.DebugLogIndex.append(g.DebugLogBuf.c_str(), old_size, g.DebugLogBuf.size());
     if (g.DebugLogFlags & ImGuiDebugLogFlags_OutputToTTY)
         IMGUI_DEBUG_PRINTF("%s", g.DebugLogBuf.begin() + old_size);
+#ifndef IMGUI_DISABLE_PROFILER
+    if ((g.DebugLogFlags & ImGuiDebugLogFlags_OutputToTrace) && g.Profiler.TraceFile != NULL)
+    {
+        const char* line_begin = g.DebugLogBuf.begin() + old_size;
+        const char* line_end = g.DebugLogBuf.end();
+        if (line_end > line_begin && line_end[-1] == '\n')
+            line_end--;
+        ProfilerTraceAddInstantEvent(line_begin, line_end);
+    }
+#endif
 #ifdef IMGUI_ENABLE_TEST_ENGINE
     // IMGUI_TEST_ENGINE_LOG() adds a trailing \n automatically
     const int new_size = g.DebugLogBuf.size();
@@ -16401,6 +17529,8 @@ void ImGui::ShowDebugLogWindow(bool* p_open)
     if (BeginPopup("Outputs"))
     {
         CheckboxFlags("OutputToTTY", &g.DebugLogFlags, ImGuiDebugLogFlags_OutputToTTY);
+        CheckboxFlags("OutputToTrace", &g.DebugLogFlags, ImGuiDebugLogFlags_OutputToTrace);
+        SetItemTooltip("Send to trace file when recording a trace (see Metrics->Profiler)");
 #ifndef IMGUI_ENABLE_TEST_ENGINE
         BeginDisabled();
 #endif
@@ -16770,6 +17900,14 @@ void ImGui::DebugNodeWindow(ImGuiWindow*, const char*) {}
 void ImGui::DebugNodeWindowSettings(ImGuiWindowSettings*) {}
 void ImGui::DebugNodeWindowsList(ImVector<ImGuiWindow*>*, const char*) {}
 void ImGui::DebugNodeViewport(ImGuiViewportP*) {}
+void ImGui::GetMemoryReport(ImGuiMemoryReport* out_report) { out_report->Clear(); }
+void ImGui::DebugNodeMemoryReport() {}
+void ImGui::DebugNodeGcStats(ImGuiGcStats*) {}
+void ImGui::DebugDrawStatsBeginFrame() {}
+void ImGui::DebugDrawStatsAddDrawList(const ImDrawList*) {}
+void ImGui::DebugDrawStatsEndFrame() {}
+const ImGuiDrawStatsFrame* ImGui::DebugDrawStatsGetFrame(int) { return NULL; }
+void ImGui::DebugNodeDrawStats(ImGuiDrawStats*) {}
 
 void ImGui::ShowDebugLogWindow(bool*) {}
 void ImGui::ShowIDStackToolWindow(bool*) {}
@@ -16778,6 +17916,483 @@ void ImGui::DebugHookIdInfo(ImGuiID, ImGuiDataType, const void*, const void*) {}
 
 #endif // #ifndef IMGUI_DISABLE_DEBUG_TOOLS
 
+//-----------------------------------------------------------------------------
+// [SECTION] PROFILER
+//-----------------------------------------------------------------------------
+// - ProfilerGetTime() [Internal]
+// - ProfilerNewFrame() [Internal]
+// - ProfilerBeginZone() [Internal]
+// - ProfilerEndZone() [Internal]
+// - ProfilerGetFrame() [Internal]
+// - ProfilerTraceStart() [Internal]
+// - ProfilerTraceStop() [Internal]
+// - DebugNodeProfiler() [Internal]
+//-----------------------------------------------------------------------------
+
+#ifndef IMGUI_DISABLE_PROFILER
+
+ImU64 ImGui::ProfilerGetTime()
+{
+#if defined(_WIN32) && !defined(IMGUI_DISABLE_WIN32_FUNCTIONS)
+    static LARGE_INTEGER frequency; // Constant, benign race on first call
+    if (frequency.QuadPart == 0)
+        ::QueryPerformanceFrequency(&frequency);
+    LARGE_INTEGER counter;
+    ::QueryPerformanceCounter(&counter);
+    return (ImU64)(counter.QuadPart / frequency.QuadPart) * 1000000000 + (ImU64)(counter.QuadPart % frequency.QuadPart) * 1000000000 / (ImU64)frequency.QuadPart;
+#elif defined(CLOCK_MONOTONIC)
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (ImU64)ts.tv_sec * 1000000000 + (ImU64)ts.tv_nsec;
+#else
+    return (ImU64)clock() * 1000000000 / CLOCKS_PER_SEC;
+#endif
+}
+
+// "Window" zones are labelled with window name
+static const char* ProfilerGetZoneLabel(const ImGuiProfilerZone* zone)
+{
+    if (zone->WindowID != 0 && strcmp(zone->Name, "Window") == 0)
+        if (ImGuiWindow* window = ImGui::FindWindowByID(zone->WindowID))
+            return window->Name;
+    return zone->Name;
+}
+
+// Chrome Trace Event Format, "JSON Array Format": a file truncated by a crash can still be loaded.
+// https://docs.google.com/document/d/1CvAClvFfyA5R-PhYUmn5OOQtYMH4h6I0nSsKchNAySU
+#define IMGUI_PROFILER_TRACE_FLUSH_SIZE     (64 * 1024)     // Accumulate trace output and write it in chunks of this size
+
+static void ProfilerTraceFlush(ImGuiProfiler* profiler, bool finish)
+{
+    if (profiler->TraceBuf.size() < IMGUI_PROFILER_TRACE_FLUSH_SIZE && !finish)
+        return;
+    if (!profiler->TraceBuf.empty())
+        ImFileWrite(profiler->TraceBuf.c_str(), sizeof(char), (ImU64)profiler->TraceBuf.size(), profiler->TraceFile);
+    profiler->TraceSize += (ImU64)profiler->TraceBuf.size();
+    profiler->TraceBuf.Buf.resize(0);
+}
+
+static void ProfilerTraceAppendString(ImGuiTextBuffer* buf, const char* str, const char* str_end)
+{
+    // Escape quotes, backslashes and control characters
+    buf->append("\"");
+    const char* run = str;
+    for (const char* p = str; p < str_end; p++)
+    {
+        const unsigned char c = (unsigned char)*p;
+        if (c >= 0x20 && c != '"' && c != '\\')
+            continue;
+        buf->append(run, p);
+        buf->appendf("\\u%04x", c);
+        run = p + 1;
+    }
+    buf->append(run, str_end);
+    buf->append("\"");
+}
+
+// Append event up to timestamp. Caller appends other fields and closing brace.
+static void ProfilerTraceAppendEvent(ImGuiProfiler* profiler, const char* name, const char* name_end, char phase, ImU64 time)
+{
+    ImGuiTextBuffer* buf = &profiler->TraceBuf;
+    buf->append(profiler->TraceEventsCount++ > 0 ? ",\n{\"name\":" : "{\"name\":");
+    ProfilerTraceAppendString(buf, name, name_end ? name_end : name + strlen(name));
+    buf->appendf(",\"cat\":\"imgui\",\"ph\":\"%c\",\"pid\":1,\"tid\":1,\"ts\":%.3f", phase, (double)(time - profiler->TraceTimeBase) / 1000.0);
+}
+
+static void ProfilerTraceAddFrame(ImGuiProfiler* profiler, const ImGuiProfilerFrame* frame)
+{
+    if (frame->TimeBegin < profiler->TraceTimeBase)
+        return; // Frame started before trace
+    ImGuiTextBuffer* buf = &profiler->TraceBuf;
+    ProfilerTraceAppendEvent(profiler, "Frame", NULL, 'X', frame->TimeBegin);
+    buf->appendf(",\"dur\":%.3f,\"args\":{\"frame\":%d,\"zones_dropped\":%d}}", (double)(frame->TimeEnd - frame->TimeBegin) / 1000.0, frame->FrameCount, frame->ZonesDropped);
+    for (const ImGuiProfilerZone& zone : frame->Zones)
+    {
+        // Merged zones span from begin of first call to end of last call
+        ProfilerTraceAppendEvent(profiler, ProfilerGetZoneLabel(&zone), NULL, 'X', zone.TimeBegin);
+        buf->appendf(",\"dur\":%.3f,\"args\":{\"calls\":%d,\"total_us\":%.3f", (double)(zone.TimeEnd - zone.TimeBegin) / 1000.0, zone.Count, (double)zone.TimeTotal / 1000.0);
+        if (ImGuiWindow* window = zone.WindowID ? ImGui::FindWindowByID(zone.WindowID) : NULL)
+        {
+            buf->append(",\"window\":");
+            ProfilerTraceAppendString(buf, window->Name, window->Name + strlen(window->Name));
+        }
+        buf->append("}}");
+    }
+    ProfilerTraceFlush(profiler, false);
+}
+
+void ImGui::ProfilerTraceAddInstantEvent(const char* name, const char* name_end)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiProfiler* profiler = &g.Profiler;
+    ProfilerTraceAppendEvent(profiler, name, name_end, 'i', ProfilerGetTime());
+    profiler->TraceBuf.append(",\"s\":\"g\"}");
+    ProfilerTraceFlush(profiler, false);
+}
+
+bool ImGui::ProfilerTraceStart(const char* filename)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiProfiler* profiler = &g.Profiler;
+    if (profiler->TraceFile != NULL)
+        return false;
+    ImFileHandle f = ImFileOpen(filename, "wb");
+    if (!f)
+        return false;
+    profiler->TraceFile = f;
+    profiler->TraceTimeBase = ProfilerGetTime();
+    profiler->TraceSize = 0;
+    profiler->TraceEventsCount = 0;
+    profiler->TraceBuf.Buf.resize(0);
+    profiler->TraceBuf.append("[\n");
+    const char* process_name = g.ContextName[0] ? g.ContextName : "Dear ImGui";
+    ProfilerTraceAppendEvent(profiler, "process_name", NULL, 'M', profiler->TraceTimeBase);
+    profiler->TraceBuf.append(",\"args\":{\"name\":");
+    ProfilerTraceAppendString(&profiler->TraceBuf, process_name, process_name + strlen(process_name));
+    profiler->TraceBuf.append("}}");
+    profiler->TraceBackupEnabled = profiler->Enabled;
+    profiler->TraceBackupDebugLogToTrace = (g.DebugLogFlags & ImGuiDebugLogFlags_OutputToTrace) != 0;
+    profiler->Enabled = true;
+    g.DebugLogFlags |= ImGuiDebugLogFlags_OutputToTrace;
+    return true;
+}
+
+void ImGui::ProfilerTraceStop()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiProfiler* profiler = &g.Profiler;
+    if (profiler->TraceFile == NULL)
+        return;
+    profiler->TraceBuf.append("\n]\n");
+    ProfilerTraceFlush(profiler, true);
+    ImFileClose(profiler->TraceFile);
+    profiler->TraceFile = NULL;
+    profiler->TraceBuf.clear();
+    profiler->Enabled = profiler->TraceBackupEnabled;
+    if (!profiler->TraceBackupDebugLogToTrace)
+        g.DebugLogFlags &= ~ImGuiDebugLogFlags_OutputToTrace;
+}
+
+// Called at the very beginning of NewFrame(): complete frame being recorded, start recording next one.
+void ImGui::ProfilerNewFrame()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiProfiler* profiler = &g.Profiler;
+    if (profiler->CurrFrameIdx != -1)
+    {
+        // End zones left open (e.g. missing End() call) and add frame to history
+        if (profiler->Stack.Size > 0)
+            ProfilerEndZone(profiler->Stack[0].ZoneIdx);
+        if (profiler->TraceFile != NULL)
+            ProfilerTraceAddFrame(profiler, &profiler->Frames[profiler->CurrFrameIdx]);
+        profiler->FramesIdx = (profiler->CurrFrameIdx + 1) % profiler->Frames.Size;
+        profiler->FramesCount = ImMin(profiler->FramesCount + 1, profiler->Frames.Size);
+        profiler->CurrFrameIdx = -1;
+    }
+    if (!profiler->Enabled || profiler->Paused)
+        return;
+
+    IM_ASSERT(profiler->FramesMax > 1 && profiler->ZonesPerFrameMax > 0);
+    if (profiler->Frames.Size != profiler->FramesMax)
+    {
+        profiler->ClearFrames();
+        profiler->Frames.resize(profiler->FramesMax, ImGuiProfilerFrame());
+    }
+    ImGuiProfilerFrame* frame = &profiler->Frames[profiler->FramesIdx];
+    frame->FrameCount = g.FrameCount + 1; // NewFrame() increments g.FrameCount after this
+    frame->ZonesDropped = 0;
+    frame->TimeBegin = frame->TimeEnd = ProfilerGetTime();
+    frame->Zones.resize(0);
+    profiler->CurrFrameIdx = profiler->FramesIdx;
+}
+
+int ImGui::ProfilerBeginZone(const char* name, ImGuiID window_id)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiProfiler* profiler = &g.Profiler;
+    if (profiler->CurrFrameIdx == -1)
+        return -1;
+    ImGuiProfilerFrame* frame = &profiler->Frames[profiler->CurrFrameIdx];
+    const int depth = profiler->Stack.Size;
+
+    // Merge with last zone when it is another call to the same zone (last zone at same depth is ended and has no child)
+    int zone_idx = frame->Zones.Size - 1;
+    ImGuiProfilerZone* zone = (zone_idx >= 0) ? &frame->Zones.Data[zone_idx] : NULL;
+    if (zone != NULL && zone->Name == name && zone->WindowID == window_id && zone->Depth == depth)
+    {
+        zone->Count++;
+    }
+    else
+    {
+        if (frame->Zones.Size >= profiler->ZonesPerFrameMax)
+        {
+            frame->ZonesDropped++;
+            return -1;
+        }
+        zone_idx = frame->Zones.Size;
+        frame->Zones.resize(zone_idx + 1);
+        zone = &frame->Zones.Data[zone_idx];
+        zone->Name = name;
+        zone->WindowID = window_id;
+        zone->Depth = depth;
+        zone->Count = 1;
+        zone->TimeTotal = 0;
+    }
+
+    ImGuiProfilerStackEntry entry;
+    entry.ZoneIdx = zone_idx;
+    entry.TimeBegin = ProfilerGetTime();
+    if (zone->Count == 1)
+        zone->TimeBegin = entry.TimeBegin;
+    zone->TimeEnd = entry.TimeBegin;
+    profiler->Stack.push_back(entry);
+    return zone_idx;
+}
+
+// Zones begun after this one and still open are ended as well.
+void ImGui::ProfilerEndZone(int zone_idx)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiProfiler* profiler = &g.Profiler;
+    if (zone_idx < 0 || profiler->CurrFrameIdx == -1)
+        return;
+    int stack_n = profiler->Stack.Size - 1;
+    while (stack_n >= 0 && profiler->Stack[stack_n].ZoneIdx != zone_idx)
+        stack_n--;
+    if (stack_n < 0)
+        return; // Already ended with a parent zone
+
+    ImGuiProfilerFrame* frame = &profiler->Frames[profiler->CurrFrameIdx];
+    const ImU64 time = ProfilerGetTime();
+    for (int n = profiler->Stack.Size - 1; n >= stack_n; n--)
+    {
+        ImGuiProfilerZone* zone = &frame->Zones.Data[profiler->Stack[n].ZoneIdx];
+        zone->TimeTotal += time - profiler->Stack[n].TimeBegin;
+        zone->TimeEnd = time;
+    }
+    profiler->Stack.resize(stack_n);
+    if (stack_n == 0)
+        frame->TimeEnd = time;
+}
+
+const ImGuiProfilerFrame* ImGui::ProfilerGetFrame(int frame_offset)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiProfiler* profiler = &g.Profiler;
+    const int frames_available = ImMin(profiler->FramesCount, profiler->Frames.Size - (profiler->CurrFrameIdx != -1 ? 1 : 0)); // Oldest frame is being overwritten while recording
+    if (frame_offset < 0 || frame_offset >= frames_available)
+        return NULL;
+    int frame_idx = profiler->FramesIdx - 1 - frame_offset;
+    if (frame_idx < 0)
+        frame_idx += profiler->Frames.Size;
+    return &profiler->Frames[frame_idx];
+}
+
+// Per-window breakdown in DebugNodeProfiler()
+struct ImGuiProfilerWindowTimes
+{
+    ImGuiID     WindowID;
+    ImU64       TimeWindow;     // "Window" zones: Begin() to End(), including contents
+    ImU64       TimeBegin;
+    ImU64       TimeEnd;
+    ImU64       TimeText;
+    ImU64       TimeTables;
+    ImU64       TimeRender;
+};
+
+static int IMGUI_CDECL ProfilerWindowTimesComparerByTimeWindow(const void* lhs, const void* rhs)
+{
+    const ImU64 a = ((const ImGuiProfilerWindowTimes*)lhs)->TimeWindow;
+    const ImU64 b = ((const ImGuiProfilerWindowTimes*)rhs)->TimeWindow;
+    return (a < b) ? +1 : (a > b) ? -1 : 0;
+}
+
+void ImGui::DebugNodeProfiler(ImGuiProfiler* profiler)
+{
+    ImGuiContext& g = *GImGui;
+    Checkbox("Enabled", &profiler->Enabled);
+    SameLine();
+    Checkbox("Paused", &profiler->Paused);
+    SameLine();
+    if (SmallButton("Clear"))
+        profiler->ClearFrames();
+    SameLine();
+    if (profiler->TraceFile == NULL)
+    {
+        if (SmallButton("Start trace"))
+            ProfilerTraceStart("imgui_trace.json");
+        SetItemTooltip("Write zones and debug log entries to 'imgui_trace.json'.\nOpen with chrome://tracing or https://ui.perfetto.dev");
+    }
+    else
+    {
+        if (SmallButton("Stop trace"))
+            ProfilerTraceStop();
+        SameLine();
+        Text("%d events, %d KB", profiler->TraceEventsCount, (int)((profiler->TraceSize + (ImU64)profiler->TraceBuf.size()) / 1024));
+    }
+
+    int frames_count = 0;
+    while (ProfilerGetFrame(frames_count) != NULL)
+        frames_count++;
+    if (frames_count == 0)
+    {
+        TextDisabled("No frame recorded.");
+        return;
+    }
+    profiler->ViewFrameOffset = ImClamp(profiler->ViewFrameOffset, 0, frames_count - 1);
+
+    // Frame durations, oldest on the left. Click to view a frame.
+    struct Funcs
+    {
+        static float GetFrameDurationMs(void* data, int idx)
+        {
+            const ImGuiProfilerFrame* frame = ProfilerGetFrame((int)(intptr_t)data - 1 - idx);
+            return (float)(frame->TimeEnd - frame->TimeBegin) / 1000000.0f;
+        }
+    };
+    SetNextItemWidth(-FLT_MIN);
+    const int hovered_idx = PlotEx(ImGuiPlotType_Histogram, "##FrameDurations", Funcs::GetFrameDurationMs, (void*)(intptr_t)frames_count, frames_count, 0, "Frame duration (ms)", 0.0f, FLT_MAX, ImVec2(0.0f, GetTextLineHeight() * 4));
+    if (hovered_idx >= 0 && IsItemClicked())
+        profiler->ViewFrameOffset = frames_count - 1 - hovered_idx;
+    SetNextItemWidth(GetFontSize() * 12);
+    SliderInt("Frame", &profiler->ViewFrameOffset, 0, frames_count - 1, "%d frames ago");
+    SameLine();
+    SetNextItemWidth(GetFontSize() * 8);
+    SliderFloat("Zoom", &profiler->ViewZoom, 1.0f, 100.0f, "%.1fx", ImGuiSliderFlags_Logarithmic);
+
+    const ImGuiProfilerFrame* frame = ProfilerGetFrame(profiler->ViewFrameOffset);
+    Text("Frame %d: %.3f ms, %d zones", frame->FrameCount, (double)(frame->TimeEnd - frame->TimeBegin) / 1000000.0, frame->Zones.Size);
+    if (frame->ZonesDropped > 0)
+    {
+        SameLine();
+        TextColored(ImVec4(1.0f, 0.4f, 0.4f, 1.0f), "(%d zones dropped, increase ZonesPerFrameMax)", frame->ZonesDropped);
+    }
+
+    // Timeline: one row per depth
+    int depth_max = 0;
+    for (const ImGuiProfilerZone& zone : frame->Zones)
+        depth_max = ImMax(depth_max, zone.Depth);
+    const float row_height = GetTextLineHeight() + 2.0f;
+    const float timeline_height = row_height * (depth_max + 1);
+    const ImGuiProfilerZone* hovered_zone = NULL;
+    if (BeginChild("##Timeline", ImVec2(-FLT_MIN, timeline_height + g.Style.ScrollbarSize + g.Style.WindowPadding.y * 2.0f), ImGuiChildFlags_Borders, ImGuiWindowFlags_HorizontalScrollbar))
+    {
+        ImGuiWindow* window = g.CurrentWindow;
+        ImDrawList* draw_list = window->DrawList;
+        const float timeline_width = GetContentRegionAvail().x * profiler->ViewZoom;
+        const ImVec2 timeline_pos = GetCursorScreenPos();
+        const float scale = timeline_width / (float)ImMax(frame->TimeEnd - frame->TimeBegin, (ImU64)1);
+        char buf[128];
+        for (const ImGuiProfilerZone& zone : frame->Zones)
+        {
+            ImRect bb;
+            bb.Min.x = timeline_pos.x + (float)(zone.TimeBegin - frame->TimeBegin) * scale;
+            bb.Max.x = ImMax(timeline_pos.x + (float)(zone.TimeEnd - frame->TimeBegin) * scale, bb.Min.x + 1.0f);
+            bb.Min.y = timeline_pos.y + zone.Depth * row_height;
+            bb.Max.y = bb.Min.y + row_height - 1.0f;
+            if (bb.Max.x < window->ClipRect.Min.x || bb.Min.x > window->ClipRect.Max.x)
+                continue;
+            draw_list->AddRectFilled(bb.Min, bb.Max, ImColor::HSV((ImHashStr(zone.Name) & 0xFF) / 255.0f, 0.5f, 0.6f));
+            if (bb.GetWidth() > GetFontSize() * 2.0f)
+            {
+                if (zone.Count > 1)
+                    ImFormatString(buf, IM_ARRAYSIZE(buf), "%s x%d", ProfilerGetZoneLabel(&zone), zone.Count);
+                else
+                    ImStrncpy(buf, ProfilerGetZoneLabel(&zone), IM_ARRAYSIZE(buf));
+                RenderTextClipped(bb.Min + ImVec2(2.0f, 1.0f), bb.Max - ImVec2(2.0f, 0.0f), buf, NULL, NULL, ImVec2(0.0f, 0.0f), &bb);
+            }
+            if (IsWindowHovered() && bb.Contains(g.IO.MousePos))
+                hovered_zone = &zone;
+        }
+        Dummy(ImVec2(timeline_width, timeline_height));
+    }
+    EndChild();
+    if (hovered_zone != NULL)
+    {
+        ImGuiWindow* zone_window = hovered_zone->WindowID ? FindWindowByID(hovered_zone->WindowID) : NULL;
+        BeginTooltip();
+        Text("%s", hovered_zone->Name);
+        if (zone_window != NULL)
+            Text("Window: '%s'", zone_window->Name);
+        Text("Time: %.3f ms (%d calls)", (double)hovered_zone->TimeTotal / 1000000.0, hovered_zone->Count);
+        Text("Span: %.3f ms .. %.3f ms", (double)(hovered_zone->TimeBegin - frame->TimeBegin) / 1000000.0, (double)(hovered_zone->TimeEnd - frame->TimeBegin) / 1000000.0);
+        EndTooltip();
+        if (zone_window != NULL)
+            GetForegroundDrawList()->AddRect(zone_window->Pos, zone_window->Pos + zone_window->Size, IM_COL32(255, 255, 0, 255));
+    }
+
+    // Per-window breakdown. Columns are sums of zones of a given name: they may overlap (e.g. Begin() renders title bar text).
+    ImVector<ImGuiProfilerWindowTimes> windows_times;
+    ImGuiStorage windows_idx;
+    for (const ImGuiProfilerZone& zone : frame->Zones)
+    {
+        if (zone.WindowID == 0)
+            continue;
+        int* p_idx = windows_idx.GetIntRef(zone.WindowID, -1);
+        if (*p_idx == -1)
+        {
+            *p_idx = windows_times.Size;
+            windows_times.resize(windows_times.Size + 1);
+            memset(&windows_times.back(), 0, sizeof(ImGuiProfilerWindowTimes));
+            windows_times.back().WindowID = zone.WindowID;
+        }
+        ImGuiProfilerWindowTimes* times = &windows_times[*p_idx];
+        if (strcmp(zone.Name, "Window") == 0)                   times->TimeWindow += zone.TimeTotal;
+        else if (strcmp(zone.Name, "Begin") == 0)               times->TimeBegin += zone.TimeTotal;
+        else if (strcmp(zone.Name, "End") == 0)                 times->TimeEnd += zone.TimeTotal;
+        else if (strcmp(zone.Name, "RenderText") == 0)          times->TimeText += zone.TimeTotal;
+        else if (strcmp(zone.Name, "TableUpdateLayout") == 0)   times->TimeTables += zone.TimeTotal;
+        else if (strcmp(zone.Name, "AddWindowToDrawData") == 0) times->TimeRender += zone.TimeTotal;
+    }
+    if (windows_times.Size > 1)
+        ImQsort(windows_times.Data, (size_t)windows_times.Size, sizeof(ImGuiProfilerWindowTimes), ProfilerWindowTimesComparerByTimeWindow);
+
+    const ImGuiTableFlags table_flags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit | ImGuiTableFlags_ScrollY;
+    if (BeginTable("##Windows", 7, table_flags, ImVec2(0.0f, GetTextLineHeightWithSpacing() * 12)))
+    {
+        TableSetupScrollFreeze(0, 1);
+        TableSetupColumn("Window", ImGuiTableColumnFlags_WidthStretch);
+        TableSetupColumn("Total ms");
+        TableSetupColumn("Begin ms");
+        TableSetupColumn("End ms");
+        TableSetupColumn("Text ms");
+        TableSetupColumn("Tables ms");
+        TableSetupColumn("Render ms");
+        TableHeadersRow();
+        for (const ImGuiProfilerWindowTimes& times : windows_times)
+        {
+            ImGuiWindow* window = FindWindowByID(times.WindowID);
+            TableNextRow();
+            TableNextColumn();
+            if (window != NULL)
+                TextUnformatted(window->Name);
+            else
+                Text("0x%08X", times.WindowID);
+            if (window != NULL && IsItemHovered())
+                GetForegroundDrawList()->AddRect(window->Pos, window->Pos + window->Size, IM_COL32(255, 255, 0, 255));
+            const ImU64 values[] = { times.TimeWindow, times.TimeBegin, times.TimeEnd, times.TimeText, times.TimeTables, times.TimeRender };
+            for (ImU64 value : values)
+            {
+                TableNextColumn();
+                Text("%.3f", (double)value / 1000000.0);
+            }
+        }
+        EndTable();
+    }
+}
+
+#else
+
+ImU64 ImGui::ProfilerGetTime() { return 0; }
+int ImGui::ProfilerBeginZone(const char*, ImGuiID) { return -1; }
+void ImGui::ProfilerEndZone(int) {}
+const ImGuiProfilerFrame* ImGui::ProfilerGetFrame(int) { return NULL; }
+bool ImGui::ProfilerTraceStart(const char*) { return false; }
+void ImGui::ProfilerTraceStop() {}
+void ImGui::DebugNodeProfiler(ImGuiProfiler*) { TextDisabled("Profiler is disabled (IMGUI_DISABLE_PROFILER)."); }
+
+#endif // #ifndef IMGUI_DISABLE_PROFILER
+
 //-----------------------------------------------------------------------------
 
 // Include imgui_user.inl at the end of imgui.cpp to access private data/functions that aren't exposed.
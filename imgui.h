@@ -44,7 +44,7 @@ Index of this file:
 // [SECTION] ImGuiStyle
 // [SECTION] ImGuiIO
 // [SECTION] Misc data structures (ImGuiInputTextCallbackData, ImGuiSizeCallbackData, ImGuiPayload)
-// [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, Math Operators, ImColor)
+// [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextFilterCache, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, ImGuiPlotLod, Math Operators, ImColor)
 // [SECTION] Multi-Select API flags and structures (ImGuiMultiSelectFlags, ImGuiMultiSelectIO, ImGuiSelectionRequest, ImGuiSelectionBasicStorage, ImGuiSelectionExternalStorage)
 // [SECTION] Drawing API (ImDrawCallback, ImDrawCmd, ImDrawIdx, ImDrawVert, ImDrawChannel, ImDrawListSplitter, ImDrawFlags, ImDrawListFlags, ImDrawList, ImDrawData)
 // [SECTION] Font API (ImFontConfig, ImFontGlyph, ImFontGlyphRangesBuilder, ImFontAtlasFlags, ImFontAtlas, ImFont)
@@ -180,10 +180,13 @@ struct ImGuiListClipper;            // Helper to manually clip large list of ite
 struct ImGuiMultiSelectIO;          // Structure to interact with a BeginMultiSelect()/EndMultiSelect() block
 struct ImGuiOnceUponAFrame;         // Helper for running a block of code not more than once a frame
 struct ImGuiPayload;                // User data payload for drag and drop operations
+struct ImGuiPlotLod;                // Helper to plot very large arrays with PlotLines()/PlotHistogram() (min/max pyramid)
 struct ImGuiPlatformIO;             // Interface between platform/renderer backends and ImGui (e.g. Clipboard, IME hooks). Extends ImGuiIO. In docking branch, this gets extended to support multi-viewports.
 struct ImGuiPlatformImeData;        // Platform IME data for io.PlatformSetImeDataFn() function.
 struct ImGuiSelectionBasicStorage;  // Optional helper to store multi-selection state + apply multi-selection requests.
+struct ImGuiSelectionBitsetStorage; // Optional helper to store multi-selection state as a bitset of item indices (for very large lists).
 struct ImGuiSelectionExternalStorage;//Optional helper to apply multi-selection requests to existing randomly accessible storage.
+struct ImGuiSelectionHashStorage;   // Optional helper to store multi-selection state as a hash set of item ids (for very large lists).
 struct ImGuiSelectionRequest;       // A selection request (stored in ImGuiMultiSelectIO)
 struct ImGuiSizeCallbackData;       // Callback data when using SetNextWindowSizeConstraints() (rare/advanced use)
 struct ImGuiStorage;                // Helper for key->value storage (container sorted by key)
@@ -193,6 +196,7 @@ struct ImGuiTableSortSpecs;         // Sorting specifications for a table (often
 struct ImGuiTableColumnSortSpecs;   // Sorting specification for one column of a table
 struct ImGuiTextBuffer;             // Helper to hold and append into a text buffer (~string builder)
 struct ImGuiTextFilter;             // Helper to parse and apply text filters (e.g. "aaaaa[,bbbbb][,ccccc]")
+struct ImGuiTextFilterCache;        // Helper to cache lines of a text buffer passing a ImGuiTextFilter, updated incrementally
 struct ImGuiViewport;               // A Platform Window (always only one in 'master' branch), in the future may represent Platform Monitor
 
 // Enumerations
@@ -702,10 +706,13 @@ namespace ImGui
 
     // Widgets: Data Plotting
     // - Consider using ImPlot (https://github.com/epezent/implot) which is much better!
+    // - When there are more values than pixels, each pixel column displays the min and max of the values it covers.
     IMGUI_API void          PlotLines(const char* label, const float* values, int values_count, int values_offset = 0, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0), int stride = sizeof(float));
     IMGUI_API void          PlotLines(const char* label, float(*values_getter)(void* data, int idx), void* data, int values_count, int values_offset = 0, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0));
     IMGUI_API void          PlotHistogram(const char* label, const float* values, int values_count, int values_offset = 0, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0), int stride = sizeof(float));
     IMGUI_API void          PlotHistogram(const char* label, float (*values_getter)(void* data, int idx), void* data, int values_count, int values_offset = 0, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0));
+    IMGUI_API void          PlotLines(const char* label, const ImGuiPlotLod* lod, int values_offset = 0, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0));     // for very large arrays, see ImGuiPlotLod.
+    IMGUI_API void          PlotHistogram(const char* label, const ImGuiPlotLod* lod, int values_offset = 0, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0)); // for very large arrays, see ImGuiPlotLod.
 
     // Widgets: Value() Helpers.
     // - Those are merely shortcut to calling Text() with a format string. Output single value in "name: value" format (tip: freely declare more in your code to handle your types. you can add functions to the ImGui namespace)
@@ -1169,6 +1176,7 @@ enum ImGuiInputTextFlags_
     ImGuiInputTextFlags_DisplayEmptyRefVal  = 1 << 14,  // InputFloat(), InputInt(), InputScalar() etc. only: when value is zero, do not display it. Generally used with ImGuiInputTextFlags_ParseEmptyRefVal.
     ImGuiInputTextFlags_NoHorizontalScroll  = 1 << 15,  // Disable following the cursor horizontally
     ImGuiInputTextFlags_NoUndoRedo          = 1 << 16,  // Disable undo/redo. Note that input text owns the text data while active, if you want to provide your own undo/redo stack you need e.g. to call ClearActiveID().
+    ImGuiInputTextFlags_NoLiveEdit          = 1 << 23,  // Don't write to your buffer while editing: it is updated when the item is deactivated (return true on that frame) or after a callback was called. Recommended for very large InputTextMultiline() buffers: edits can use a gap buffer and don't need to copy the whole text every frame.
 
     // Callback features
     ImGuiInputTextFlags_CallbackCompletion  = 1 << 17,  // Callback on pressing TAB (for completion handling)
@@ -1177,6 +1185,7 @@ enum ImGuiInputTextFlags_
     ImGuiInputTextFlags_CallbackCharFilter  = 1 << 20,  // Callback on character inputs to replace or discard them. Modify 'EventChar' to replace or discard, or return 1 in callback to discard.
     ImGuiInputTextFlags_CallbackResize      = 1 << 21,  // Callback on buffer capacity changes request (beyond 'buf_size' parameter value), allowing the string to grow. Notify when the string wants to be resized (for string types which hold a cache of their Size). You will be provided a new BufSize in the callback and NEED to honor it. (see misc/cpp/imgui_stdlib.h for an example of using this)
     ImGuiInputTextFlags_CallbackEdit        = 1 << 22,  // Callback on any edit (note that InputText() already returns true on edit, the callback is useful mainly to manipulate the underlying buffer while focus is active)
+    ImGuiInputTextFlags_CallbackTextColor   = 1 << 24,  // InputTextMultiline() only: callback on each visible line which isn't in the render cache, to color parts of it with SetTextColor() (for syntax highlighting). Rendered lines are cached by contents, so colors must only depend on the line contents.
 
     // Obsolete names
     //ImGuiInputTextFlags_AlwaysInsertMode  = ImGuiInputTextFlags_AlwaysOverwrite   // [renamed in 1.82] name was not matching behavior
@@ -2239,12 +2248,15 @@ struct ImGuiIO
     bool        ConfigInputTrickleEventQueue;   // = true           // Enable input queue trickling: some types of events submitted during the same frame (e.g. button down + up) will be spread over multiple frames, improving interactions with low framerates.
     bool        ConfigInputTextCursorBlink;     // = true           // Enable blinking cursor (optional as some users consider it to be distracting).
     bool        ConfigInputTextEnterKeepActive; // = false          // [BETA] Pressing Enter will keep item active and select contents (single-line only).
+    int         ConfigInputTextUndoMemoryBudget;// = 1024*1024      // Maximum memory used by InputText() undo/redo history, in bytes. Oldest records are discarded first. Set to 0 to disable undo.
     bool        ConfigDragClickToInputText;     // = false          // [BETA] Enable turning DragXXX widgets into text input with a simple mouse click-release (without moving). Not desirable on devices without a keyboard.
     bool        ConfigWindowsResizeFromEdges;   // = true           // Enable resizing of windows from their edges and from the lower-left corner. This requires ImGuiBackendFlags_HasMouseCursors for better mouse cursor feedback. (This used to be a per-window ImGuiWindowFlags_ResizeFromAnySide flag)
     bool        ConfigWindowsMoveFromTitleBarOnly;  // = false      // Enable allowing to move windows only when clicking on their title bar. Does not apply to windows without a title bar.
     bool        ConfigWindowsCopyContentsWithCtrlC; // = false      // [EXPERIMENTAL] CTRL+C copy the contents of focused window into the clipboard. Experimental because: (1) has known issues with nested Begin/End pairs (2) text output quality varies (3) text output is in submission order rather than spatial order.
     bool        ConfigScrollbarScrollByPage;    // = true           // Enable scrolling page by page when clicking outside the scrollbar grab. When disabled, always scroll to clicked location. When enabled, Shift+Click scrolls to clicked location.
     float       ConfigMemoryCompactTimer;       // = 60.0f          // Timer (in seconds) to free transient windows/tables memory buffers when unused. Set to -1.0f to disable.
+    int         ConfigMemoryCompactBudget;      // = 0              // Budget (in bytes) for transient windows/tables memory buffers (draw lists, ID stacks, tables draw channels...). When exceeded, buffers of least recently active windows/tables are freed first. Set to 0 to disable.
+    int         ConfigMemoryShrinkDrawListFrames;// = 0             // Shrink draw list buffers of a window after they used less than half of their capacity for this number of consecutive frames. Set to 0 to disable.
 
     // Inputs Behaviors
     // (other variables, ones which are expected to be tweaked within UI code, are exposed in ImGuiStyle)
@@ -2440,6 +2452,7 @@ struct ImGuiIO
 // - ImGuiInputTextFlags_CallbackHistory:     Callback on pressing Up/Down arrows
 // - ImGuiInputTextFlags_CallbackCharFilter:  Callback on character inputs to replace or discard them. Modify 'EventChar' to replace or discard, or return 1 in callback to discard.
 // - ImGuiInputTextFlags_CallbackResize:      Callback on buffer capacity changes request (beyond 'buf_size' parameter value), allowing the string to grow.
+// - ImGuiInputTextFlags_CallbackTextColor:   Callback on rendering a line which isn't cached. Call SetTextColor() to color parts of the line.
 struct ImGuiInputTextCallbackData
 {
     ImGuiContext*       Ctx;            // Parent UI context
@@ -2452,6 +2465,7 @@ struct ImGuiInputTextCallbackData
     // - However, during Completion/History/Always callback, Buf always points to our own internal data (it is not the same as your buffer)! Changes to it will be reflected into your own buffer shortly after the callback.
     // - To modify the text buffer in a callback, prefer using the InsertChars() / DeleteChars() function. InsertChars() will take care of calling the resize callback if necessary.
     // - If you know your edits are not going to resize the underlying buffer allocation, you may modify the contents of 'Buf[]' directly. You need to update 'BufTextLen' accordingly (0 <= BufTextLen < BufSize) and set 'BufDirty'' to true so InputText can update its internal state.
+    // - During TextColor callback, Buf points to the beginning of the line being rendered (not zero-terminated, read-only) and BufTextLen is the length of the line.
     ImWchar             EventChar;      // Character input                      // Read-write   // [CharFilter] Replace character with another one, or set to zero to drop. return 1 is equivalent to setting EventChar=0;
     ImGuiKey            EventKey;       // Key pressed (Up/Down/TAB)            // Read-only    // [Completion,History]
     char*               Buf;            // Text buffer                          // Read-write   // [Resize] Can replace pointer / [Completion,History,Always] Only write to pointed data, don't replace the actual pointer!
@@ -2470,6 +2484,9 @@ struct ImGuiInputTextCallbackData
     void                SelectAll()             { SelectionStart = 0; SelectionEnd = BufTextLen; }
     void                ClearSelection()        { SelectionStart = SelectionEnd = BufTextLen; }
     bool                HasSelection() const    { return SelectionStart != SelectionEnd; }
+
+    // Helper function for ImGuiInputTextFlags_CallbackTextColor: color 'bytes_count' bytes of the line starting at 'pos'. Uncolored parts use ImGuiCol_Text.
+    IMGUI_API void      SetTextColor(int pos, int bytes_count, ImU32 col);
 };
 
 // Resizing callback data to apply custom constraint. As enabled by SetNextWindowSizeConstraints(). Callback is called during the next Begin().
@@ -2505,7 +2522,7 @@ struct ImGuiPayload
 };
 
 //-----------------------------------------------------------------------------
-// [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, Math Operators, ImColor)
+// [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextFilterCache, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, ImGuiPlotLod, Math Operators, ImColor)
 //-----------------------------------------------------------------------------
 
 // Helper: Unicode defines
@@ -2547,10 +2564,30 @@ struct ImGuiTextFilter
         IMGUI_API void  split(char separator, ImVector<ImGuiTextRange>* out) const;
     };
     char                    InputBuf[256];
+    char                    InputBufUpper[256]; // InputBuf converted to upper case by Build(), so PassFilter() doesn't need to convert filters for each text
     ImVector<ImGuiTextRange>Filters;
+    ImVector<ImGuiTextRange>FiltersUpper;       // Same as Filters, pointing into InputBufUpper
     int                     CountGrep;
 };
 
+// Helper: Cache indices of lines passing a ImGuiTextFilter, for a text buffer which is only appended to (e.g. a log).
+// - Call Update() every frame: only lines added since last call are tested (+ last line, which may have been appended to).
+// - When the filter is modified by adding characters to its last term (e.g. "err" -> "error"), only lines which passed the previous filter are tested.
+// - Lines are described by the offset of their beginning in the buffer, each line ends one character before the next one starts
+//   (on the '\n' separator), last line ends at buf_end. This is the layout of ImGuiTextIndex and of the demo's ExampleAppLog.
+// - Call Clear() if the text buffer is modified in other ways than appending to it.
+// - Use with ImGuiListClipper: clipper.Begin(cache.Lines.Size), then display lines cache.Lines[DisplayStart] to cache.Lines[DisplayEnd - 1].
+struct ImGuiTextFilterCache
+{
+    ImVector<int>       Lines;              // Indices of lines passing the filter (all lines if the filter is not active)
+    int                 LinesProcessed;     // Number of lines tested
+    char                FilterBuf[256];     // Copy of ImGuiTextFilter::InputBuf used for Lines[]
+
+    ImGuiTextFilterCache()  { Clear(); }
+    void                Clear()             { Lines.resize(0); LinesProcessed = 0; FilterBuf[0] = 0; }
+    IMGUI_API void      Update(const ImGuiTextFilter& filter, const char* buf, const char* buf_end, const int* line_offsets, int lines_count);
+};
+
 // Helper: Growable text buffer for logging/accumulating text
 // (this could be called 'ImGuiTextBuilder' / 'ImGuiStringBuilder')
 struct ImGuiTextBuffer
@@ -2683,6 +2720,27 @@ struct ImGuiListClipper
 #endif
 };
 
+// Helper: Min/max pyramid over a large array of values, to use PlotLines()/PlotHistogram() with millions of values.
+// - Call Build() after modifying your values, or UpdateRange() after modifying some of them (e.g. writing into a ring buffer).
+// - Plotting then reads O(width * log(values_count)) data instead of all values, and preserves peaks: each pixel column displays the min and max of values it covers.
+// - Your values are not copied: the array must stay valid, and be unmodified unless you call UpdateRange().
+// - NaN values are ignored.
+struct ImGuiPlotLod
+{
+    const float*        Values;         // [Internal] Values passed to Build()
+    int                 ValuesCount;    // [Internal]
+    int                 Stride;         // [Internal]
+    ImVector<float>     Blocks;         // [Internal] Min and max of each block of values, for each level. Level 0 has one block every IMGUI_PLOT_LOD_BLOCK_SIZE values, level N+1 has one block every two blocks of level N.
+    ImVector<int>       LevelOffsets;   // [Internal] Index of first block of each level + end of last level
+
+    IMGUI_API ImGuiPlotLod();
+    IMGUI_API void      Build(const float* values, int values_count, int stride = sizeof(float));   // O(n)
+    IMGUI_API void      UpdateRange(int idx_begin, int idx_end);                                    // Call after modifying values [idx_begin, idx_end). O(idx_end - idx_begin + log(n))
+    IMGUI_API void      Clear();
+    IMGUI_API bool      GetMinMax(int idx_begin, int idx_end, float* out_min, float* out_max) const; // Min/max of values [idx_begin, idx_end). O(log(n)). Return false if there are no values (or only NaN).
+    float               GetValue(int idx) const { return *(const float*)(const void*)((const unsigned char*)Values + (size_t)idx * Stride); }
+};
+
 // Helpers: ImVec2/ImVec4 operators
 // - It is important that we are keeping those disabled by default so they don't leak in user space.
 // - This is in order to allow user enabling implicit cast operators between ImVec2/ImVec4 and their own types (using IM_VEC2_CLASS_EXTRA in imconfig.h)
@@ -2891,6 +2949,56 @@ struct ImGuiSelectionBasicStorage
     inline ImGuiID  GetStorageIdFromIndex(int idx)              { return AdapterIndexToStorageId(this, idx); }  // Convert index to item id based on provided adapter.
 };
 
+// Optional helper to store multi-selection state as a dense bitset: 1 bit per item index.
+// - Alternative to ImGuiSelectionBasicStorage when your selection ids are item indices (no adapter) and lists are very large (1M+ items).
+// - SetItemSelected() and Contains() are O(1). SetAll/SetRange requests are applied in O(range/64).
+// - Memory usage is 1 bit per item up to the largest selected index (~1.2 MB for 10M items).
+// - Iterate selection with 'void* it = NULL; ImGuiID id; while (selection.GetNextSelectedItem(&it, &id)) { ... }', in ascending index order.
+struct ImGuiSelectionBitsetStorage
+{
+    // Members
+    int             Size;           //          // Number of selected items, maintained by this helper.
+    ImVector<ImU64> _Bits;          // [Internal] Selection set, bit N is set when item index N is selected. Prefer not accessing directly: iterate with GetNextSelectedItem().
+
+    // Methods
+    IMGUI_API ImGuiSelectionBitsetStorage();
+    IMGUI_API void  ApplyRequests(ImGuiMultiSelectIO* ms_io);   // Apply selection requests coming from BeginMultiSelect() and EndMultiSelect() functions. It uses 'items_count' passed to BeginMultiSelect()
+    IMGUI_API bool  Contains(ImGuiID idx) const;                // Query if an item index is in selection.
+    IMGUI_API void  Clear();                                    // Clear selection
+    IMGUI_API void  Swap(ImGuiSelectionBitsetStorage& r);       // Swap two selections
+    IMGUI_API void  SetItemSelected(ImGuiID idx, bool selected);// Add/remove an item from selection
+    IMGUI_API void  SetRangeSelected(ImGuiID idx_first, ImGuiID idx_last, bool selected); // Add/remove an inclusive range of items from selection, 64 items at a time.
+    IMGUI_API bool  GetNextSelectedItem(void** opaque_it, ImGuiID* out_idx); // Iterate selection with 'void* it = NULL; ImGuiId id; while (selection.GetNextSelectedItem(&it, &id)) { ... }'
+};
+
+// Optional helper to store multi-selection state as an open-addressing hash set of ids.
+// - Alternative to ImGuiSelectionBasicStorage when using sparse ids (e.g. AdapterIndexToStorageId() returns object ids) with very large lists.
+// - SetItemSelected() and Contains() are O(1) on average, instead of O(log N) lookup + O(N) insertion in a sorted ImGuiStorage.
+//   SetAll/SetRange requests are applied in O(range), without any sorting. Clear() is O(1).
+// - GetNextSelectedItem() iterates in ascending id order, using a sorted copy of the selection which is only rebuilt after it changed.
+struct ImGuiSelectionHashStorage
+{
+    // Members
+    int             Size;           //          // Number of selected items, maintained by this helper.
+    void*           UserData;       // = NULL   // User data for use by adapter function        // e.g. selection.UserData = (void*)my_items;
+    ImGuiID         (*AdapterIndexToStorageId)(ImGuiSelectionHashStorage* self, int idx);       // e.g. selection.AdapterIndexToStorageId = [](ImGuiSelectionHashStorage* self, int idx) { return ((MyItems**)self->UserData)[idx]->ID; };
+    ImVector<ImGuiID> _Keys;        // [Internal] Hash set using linear probing. Size is a power of two. 0 marks an empty slot.
+    ImVector<ImGuiID> _SortedKeys;  // [Internal] Sorted copy of selection used by GetNextSelectedItem()
+    bool            _HasZero;       // [Internal] Id 0 is stored here as it can't be stored in _Keys[]
+    bool            _SortedKeysDirty;//[Internal]
+
+    // Methods
+    IMGUI_API ImGuiSelectionHashStorage();
+    IMGUI_API void  ApplyRequests(ImGuiMultiSelectIO* ms_io);   // Apply selection requests coming from BeginMultiSelect() and EndMultiSelect() functions. It uses 'items_count' passed to BeginMultiSelect()
+    IMGUI_API bool  Contains(ImGuiID id) const;                 // Query if an item id is in selection.
+    IMGUI_API void  Clear();                                    // Clear selection
+    IMGUI_API void  Swap(ImGuiSelectionHashStorage& r);         // Swap two selections
+    IMGUI_API void  SetItemSelected(ImGuiID id, bool selected); // Add/remove an item from selection (generally done by ApplyRequests() function)
+    IMGUI_API void  Reserve(int items_count);                   // Grow hash table to hold 'items_count' items without rehashing.
+    IMGUI_API bool  GetNextSelectedItem(void** opaque_it, ImGuiID* out_id); // Iterate selection with 'void* it = NULL; ImGuiId id; while (selection.GetNextSelectedItem(&it, &id)) { ... }'
+    inline ImGuiID  GetStorageIdFromIndex(int idx)              { return AdapterIndexToStorageId(this, idx); }  // Convert index to item id based on provided adapter.
+};
+
 // Optional helper to apply multi-selection requests to existing randomly accessible storage.
 // Convenient if you want to quickly wire multi-select API on e.g. an array of bool or items storing their own selection state.
 struct ImGuiSelectionExternalStorage
@@ -3064,6 +3172,7 @@ struct ImDrawList
     ImVector<ImU8>          _CallbacksDataBuf;  // [Internal]
     float                   _FringeScale;       // [Internal] anti-alias fringe is scaled by this value, this helps to keep things sharp while zooming at vertex buffer content
     const char*             _OwnerName;         // Pointer to owner window's name for debugging
+    int                     _CmdMergedCount;    // [Internal] number of times a new draw command was merged back into previous one since last reset (for Metrics/Debugger)
 
     // If you want to create ImDrawList instances, pass them ImGui::GetDrawListSharedData().
     // (advanced: you may create and use your own ImDrawListSharedData so you can use ImDrawList without ImGui, but that's more involved)
@@ -1678,6 +1678,8 @@ static void ShowDemoWindowWidgets(ImGuiDemoWindowData* demo_data)
             ImGui::CheckboxFlags("ImGuiInputTextFlags_AllowTabInput", &flags, ImGuiInputTextFlags_AllowTabInput);
             ImGui::SameLine(); HelpMarker("When _AllowTabInput is set, passing through the widget with Tabbing doesn't automatically activate it, in order to also cycling through subsequent widgets.");
             ImGui::CheckboxFlags("ImGuiInputTextFlags_CtrlEnterForNewLine", &flags, ImGuiInputTextFlags_CtrlEnterForNewLine);
+            ImGui::CheckboxFlags("ImGuiInputTextFlags_NoLiveEdit", &flags, ImGuiInputTextFlags_NoLiveEdit);
+            ImGui::SameLine(); HelpMarker("When _NoLiveEdit is set, the buffer is only written to when the widget is deactivated. This is faster with very large text.");
             ImGui::InputTextMultiline("##source", text, IM_ARRAYSIZE(text), ImVec2(-FLT_MIN, ImGui::GetTextLineHeight() * 16), flags);
             ImGui::TreePop();
         }
@@ -1830,6 +1832,56 @@ static void ShowDemoWindowWidgets(ImGuiDemoWindowData* demo_data)
             ImGui::TreePop();
         }
 
+        IMGUI_DEMO_MARKER("Widgets/Text Input/Text Color Callback");
+        if (ImGui::TreeNode("Text Color Callback"))
+        {
+            HelpMarker(
+                "Using ImGuiInputTextFlags_CallbackTextColor to color parts of each line (e.g. syntax highlighting).\n\n"
+                "Rendered lines are cached by contents: the callback is only called for lines which changed or scrolled into view, "
+                "so colors must only depend on the line contents.");
+            struct Funcs
+            {
+                static bool IsIdentifierChar(char c) { return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_'; }
+                static int MyTextColorCallback(ImGuiInputTextCallbackData* data)
+                {
+                    if (data->EventFlag != ImGuiInputTextFlags_CallbackTextColor)
+                        return 0;
+                    const char* line = data->Buf; // Not zero-terminated!
+                    for (int i = 0; i < data->BufTextLen; )
+                    {
+                        if (line[i] == '/' && i + 1 < data->BufTextLen && line[i + 1] == '/')
+                        {
+                            data->SetTextColor(i, data->BufTextLen - i, IM_COL32(110, 190, 110, 255)); // Comment
+                            break;
+                        }
+                        int len = 0;
+                        while (i + len < data->BufTextLen && IsIdentifierChar(line[i + len]))
+                            len++;
+                        if (len == 0)
+                        {
+                            i++;
+                            continue;
+                        }
+                        if (line[i] >= '0' && line[i] <= '9')
+                            data->SetTextColor(i, len, IM_COL32(230, 170, 100, 255)); // Number
+                        else if ((len == 2 && strncmp(line + i, "if", 2) == 0) || (len == 3 && strncmp(line + i, "for", 3) == 0) || (len == 6 && strncmp(line + i, "return", 6) == 0))
+                            data->SetTextColor(i, len, IM_COL32(100, 150, 255, 255)); // Keyword
+                        i += len;
+                    }
+                    return 0;
+                }
+            };
+            static char text[1024 * 4] =
+                "// Compute sum of positive values\n"
+                "int sum = 0;\n"
+                "for (int n = 0; n < 100; n++)\n"
+                "    if (values[n] > 0)\n"
+                "        sum += values[n];\n"
+                "return sum; // Done\n";
+            ImGui::InputTextMultiline("##source", text, IM_ARRAYSIZE(text), ImVec2(-FLT_MIN, ImGui::GetTextLineHeight() * 8), ImGuiInputTextFlags_AllowTabInput | ImGuiInputTextFlags_CallbackTextColor, Funcs::MyTextColorCallback);
+            ImGui::TreePop();
+        }
+
         IMGUI_DEMO_MARKER("Widgets/Text Input/Miscellaneous");
         if (ImGui::TreeNode("Miscellaneous"))
         {
@@ -2053,6 +2105,33 @@ static void ShowDemoWindowWidgets(ImGuiDemoWindowData* demo_data)
         float (*func)(void*, int) = (func_type == 0) ? Funcs::Sin : Funcs::Saw;
         ImGui::PlotLines("Lines##2", func, NULL, display_count, 0, NULL, -1.0f, 1.0f, ImVec2(0, 80));
         ImGui::PlotHistogram("Histogram##2", func, NULL, display_count, 0, NULL, -1.0f, 1.0f, ImVec2(0, 80));
+
+        // Plot very large arrays using ImGuiPlotLod: a min/max pyramid built over your values.
+        // Plotting then doesn't need to read all values every frame. Here we use the array as a ring buffer
+        // and call UpdateRange() after writing new values.
+        ImGui::SeparatorText("Large arrays");
+        static ImVector<float> large_values;
+        static ImGuiPlotLod large_values_lod;
+        static int large_values_offset = 0;
+        if (large_values.empty())
+        {
+            large_values.resize(1000000);
+            for (int n = 0; n < large_values.Size; n++)
+                large_values[n] = sinf(n * 0.0001f) * 0.5f + ((n % 100003) == 0 ? 0.5f : 0.0f); // Add a few single-value peaks
+            large_values_lod.Build(large_values.Data, large_values.Size);
+        }
+        if (animate)
+        {
+            const int write_count = 500;
+            for (int n = 0; n < write_count; n++)
+                large_values[(large_values_offset + n) % large_values.Size] = sinf((float)ImGui::GetTime() * 5.0f + n * 0.01f) * 0.5f;
+            large_values_lod.UpdateRange(large_values_offset, IM_MIN(large_values_offset + write_count, large_values.Size));
+            if (large_values_offset + write_count > large_values.Size)
+                large_values_lod.UpdateRange(0, large_values_offset + write_count - large_values.Size);
+            large_values_offset = (large_values_offset + write_count) % large_values.Size;
+        }
+        ImGui::PlotLines("1M values", &large_values_lod, large_values_offset, NULL, -1.0f, 1.0f, ImVec2(0, 80));
+        ImGui::SameLine(); HelpMarker("Each pixel column displays the min/max of values it covers, so single-value peaks are always visible.");
         ImGui::Separator();
 
         ImGui::Text("Need better plotting and graphing? Consider using ImPlot:");
@@ -7781,6 +7860,8 @@ void ImGui::ShowAboutWindow(bool* p_open)
         if (io.ConfigWindowsResizeFromEdges)                            ImGui::Text("io.ConfigWindowsResizeFromEdges");
         if (io.ConfigWindowsMoveFromTitleBarOnly)                       ImGui::Text("io.ConfigWindowsMoveFromTitleBarOnly");
         if (io.ConfigMemoryCompactTimer >= 0.0f)                        ImGui::Text("io.ConfigMemoryCompactTimer = %.1f", io.ConfigMemoryCompactTimer);
+        if (io.ConfigMemoryCompactBudget > 0)                           ImGui::Text("io.ConfigMemoryCompactBudget = %d", io.ConfigMemoryCompactBudget);
+        if (io.ConfigMemoryShrinkDrawListFrames > 0)                    ImGui::Text("io.ConfigMemoryShrinkDrawListFrames = %d", io.ConfigMemoryShrinkDrawListFrames);
         ImGui::Text("io.BackendFlags: 0x%08X", io.BackendFlags);
         if (io.BackendFlags & ImGuiBackendFlags_HasGamepad)             ImGui::Text(" HasGamepad");
         if (io.BackendFlags & ImGuiBackendFlags_HasMouseCursors)        ImGui::Text(" HasMouseCursors");
@@ -8675,6 +8756,7 @@ struct ExampleAppLog
 {
     ImGuiTextBuffer     Buf;
     ImGuiTextFilter     Filter;
+    ImGuiTextFilterCache FilterCache; // Indices of lines passing the filter. Only new lines are tested every frame.
     ImVector<int>       LineOffsets; // Index to lines offset. We maintain this with AddLog() calls.
     bool                AutoScroll;  // Keep scrolling if already at the bottom.
 
@@ -8689,6 +8771,7 @@ struct ExampleAppLog
         Buf.clear();
         LineOffsets.clear();
         LineOffsets.push_back(0);
+        FilterCache.Clear();
     }
 
     void    AddLog(const char* fmt, ...) IM_FMTARGS(2)
@@ -8742,17 +8825,24 @@ struct ExampleAppLog
             const char* buf_end = Buf.end();
             if (Filter.IsActive())
             {
-                // In this example we don't use the clipper when Filter is enabled.
-                // This is because we don't have random access to the result of our filter.
-                // A real application processing logs with ten of thousands of entries may want to store the result of
-                // search/filter.. especially if the filtering function is not trivial (e.g. reg-exp).
-                for (int line_no = 0; line_no < LineOffsets.Size; line_no++)
+                // When Filter is enabled, we store indices of lines passing the filter in FilterCache.
+                // This gives us random access to the result of our filter, so we can use the clipper as below.
+                // FilterCache only tests lines added since last frame, and when the filter is made more restrictive
+                // by typing more characters, only lines which passed the previous filter.
+                FilterCache.Update(Filter, buf, buf_end, LineOffsets.Data, LineOffsets.Size);
+                ImGuiListClipper clipper;
+                clipper.Begin(FilterCache.Lines.Size);
+                while (clipper.Step())
                 {
-                    const char* line_start = buf + LineOffsets[line_no];
-                    const char* line_end = (line_no + 1 < LineOffsets.Size) ? (buf + LineOffsets[line_no + 1] - 1) : buf_end;
-                    if (Filter.PassFilter(line_start, line_end))
+                    for (int row_n = clipper.DisplayStart; row_n < clipper.DisplayEnd; row_n++)
+                    {
+                        const int line_no = FilterCache.Lines[row_n];
+                        const char* line_start = buf + LineOffsets[line_no];
+                        const char* line_end = (line_no + 1 < LineOffsets.Size) ? (buf + LineOffsets[line_no + 1] - 1) : buf_end;
                         ImGui::TextUnformatted(line_start, line_end);
+                    }
                 }
+                clipper.End();
             }
             else
             {
@@ -8766,9 +8856,8 @@ struct ExampleAppLog
                 // - A) random access into your data
                 // - B) items all being the  same height,
                 // both of which we can handle since we have an array pointing to the beginning of each line of text.
-                // When using the filter (in the block of code above) we don't have random access into the data to display
-                // anymore, which is why we don't use the clipper. Storing or skimming through the search result would make
-                // it possible (and would be recommended if you want to search through tens of thousands of entries).
+                // When using the filter (in the block of code above) we use the same approach with indices of lines
+                // passing the filter, which FilterCache stores for us.
                 ImGuiListClipper clipper;
                 clipper.Begin(LineOffsets.Size);
                 while (clipper.Step())
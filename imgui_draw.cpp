@@ -431,6 +431,7 @@ void ImDrawList::_ResetForNewFrame()
     _Splitter.Clear();
     CmdBuffer.push_back(ImDrawCmd());
     _FringeScale = 1.0f;
+    _CmdMergedCount = 0;
 }
 
 void ImDrawList::_ClearFreeMemory()
@@ -556,6 +557,7 @@ void ImDrawList::_OnChangedClipRect()
     if (curr_cmd->ElemCount == 0 && CmdBuffer.Size > 1 && ImDrawCmd_HeaderCompare(&_CmdHeader, prev_cmd) == 0 && ImDrawCmd_AreSequentialIdxOffset(prev_cmd, curr_cmd) && prev_cmd->UserCallback == NULL)
     {
         CmdBuffer.pop_back();
+        _CmdMergedCount++;
         return;
     }
     curr_cmd->ClipRect = _CmdHeader.ClipRect;
@@ -578,6 +580,7 @@ void ImDrawList::_OnChangedTextureID()
     if (curr_cmd->ElemCount == 0 && CmdBuffer.Size > 1 && ImDrawCmd_HeaderCompare(&_CmdHeader, prev_cmd) == 0 && ImDrawCmd_AreSequentialIdxOffset(prev_cmd, curr_cmd) && prev_cmd->UserCallback == NULL)
     {
         CmdBuffer.pop_back();
+        _CmdMergedCount++;
         return;
     }
     curr_cmd->TextureId = _CmdHeader.TextureId;
@@ -2143,6 +2146,7 @@ void ImDrawListSplitter::Merge(ImDrawList* draw_list)
                 last_cmd->ElemCount += next_cmd->ElemCount;
                 idx_offset += next_cmd->ElemCount;
                 ch._CmdBuffer.erase(ch._CmdBuffer.Data); // FIXME-OPT: Improve for multiple merges.
+                draw_list->_CmdMergedCount++;
             }
         }
         if (ch._CmdBuffer.Size > 0)
@@ -2511,6 +2515,8 @@ void    ImFontAtlas::GetTexDataAsAlpha8(unsigned char** out_pixels, int* out_wid
 
 void    ImFontAtlas::GetTexDataAsRGBA32(unsigned char** out_pixels, int* out_width, int* out_height, int* out_bytes_per_pixel)
 {
+    IMGUI_DEBUG_ALLOC_OWNER_SCOPE(ImGuiDebugAllocOwner_Font);
+
     // Convert to RGBA32 format on demand
     // Although it is likely to be the most commonly used format, our font rendering is 1 channel / 8 bpp
     if (!TexPixelsRGBA32)
@@ -2536,6 +2542,7 @@ void    ImFontAtlas::GetTexDataAsRGBA32(unsigned char** out_pixels, int* out_wid
 ImFont* ImFontAtlas::AddFont(const ImFontConfig* font_cfg)
 {
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+    IMGUI_DEBUG_ALLOC_OWNER_SCOPE(ImGuiDebugAllocOwner_Font);
     IM_ASSERT(font_cfg->FontData != NULL && font_cfg->FontDataSize > 0);
     IM_ASSERT(font_cfg->SizePixels > 0.0f && "Is ImFontConfig struct correctly initialized?");
     IM_ASSERT(font_cfg->OversampleH > 0 && font_cfg->OversampleV > 0 && "Is ImFontConfig struct correctly initialized?");
@@ -2744,6 +2751,7 @@ bool ImFontAtlas::GetMouseCursorTexData(ImGuiMouseCursor cursor_type, ImVec2* ou
 bool    ImFontAtlas::Build()
 {
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+    IMGUI_DEBUG_ALLOC_OWNER_SCOPE(ImGuiDebugAllocOwner_Font);
 
     // Default font is none are specified
     if (ConfigData.Size == 0)
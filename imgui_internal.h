@@ -62,6 +62,9 @@ Index of this file:
 #define IMGUI_ENABLE_SSE
 #include <immintrin.h>
 #endif
+#if defined(IMGUI_ENABLE_SSE) && (defined __SSE2__ || defined __x86_64__ || defined _M_X64 || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+#define IMGUI_ENABLE_SSE2
+#endif
 
 // Visual Studio warnings
 #ifdef _MSC_VER
@@ -131,10 +134,14 @@ struct ImGuiContext;                // Main Dear ImGui context
 struct ImGuiContextHook;            // Hook for extensions like ImGuiTestEngine
 struct ImGuiDataVarInfo;            // Variable information (e.g. to access style variables from an enum)
 struct ImGuiDataTypeInfo;           // Type information associated to a ImGuiDataType enum
+struct ImGuiDrawStats;              // Storage for draw-call statistics history (see ImGuiDrawStatsFrame)
+struct ImGuiDrawStatsList;          // Draw-call statistics of one ImDrawList for one frame
 struct ImGuiErrorRecoveryState;     // Storage of stack sizes for error handling and recovery
+struct ImGuiGcStats;                // Storage for memory compaction statistics
 struct ImGuiGroupData;              // Stacked storage data for BeginGroup()/EndGroup()
 struct ImGuiInputTextState;         // Internal state of the currently focused/edited text input box
 struct ImGuiInputTextDeactivateData;// Short term storage to backup text of a deactivating InputText() while another is stealing active id
+struct ImGuiInputTextLineCache;     // Render cache of a InputTextMultiline() using ImGuiInputTextFlags_CallbackTextColor
 struct ImGuiLastItemData;           // Status storage for last submitted items
 struct ImGuiLocEntry;               // A localization entry.
 struct ImGuiMenuColumns;            // Simple column measurement, currently used for MenuItem() only
@@ -147,6 +154,8 @@ struct ImGuiNextItemData;           // Storage for SetNextItem** functions
 struct ImGuiOldColumnData;          // Storage data for a single column for legacy Columns() api
 struct ImGuiOldColumns;             // Storage data for a columns set for legacy Columns() api
 struct ImGuiPopupData;              // Storage for current popup stack
+struct ImGuiProfiler;               // Storage for frame profiler (zones recorded by IMGUI_PROFILER_SCOPE() etc.)
+struct ImGuiProfilerFrame;          // Zones recorded for one frame
 struct ImGuiSettingsHandler;        // Storage for one type registered in the .ini file
 struct ImGuiStyleMod;               // Stacked style modifier, backup of modified data so we can restore it
 struct ImGuiTabBar;                 // Storage for a tab bar
@@ -223,6 +232,29 @@ extern IMGUI_API ImGuiContext* GImGui;  // Current implicit context pointer
 #define IMGUI_DEBUG_LOG_FONT(...)       do { if (g.DebugLogFlags & ImGuiDebugLogFlags_EventFont)        IMGUI_DEBUG_LOG(__VA_ARGS__); } while (0)
 #define IMGUI_DEBUG_LOG_INPUTROUTING(...) do{if (g.DebugLogFlags & ImGuiDebugLogFlags_EventInputRouting)IMGUI_DEBUG_LOG(__VA_ARGS__); } while (0)
 
+// Profiler zones for the Metrics window. See ImGuiProfiler. _NAME must be a static string (e.g. a literal).
+// - IMGUI_PROFILER_SCOPE(): time the rest of current C++ scope (one per scope).
+// - IMGUI_PROFILER_BEGIN()/IMGUI_PROFILER_END(): time across function boundaries, e.g. "Window" zone between Begin() and End().
+#if defined(IMGUI_DISABLE_DEBUG_TOOLS) && !defined(IMGUI_DISABLE_PROFILER)
+#define IMGUI_DISABLE_PROFILER
+#endif
+#ifndef IMGUI_DISABLE_PROFILER
+#define IMGUI_PROFILER_SCOPE(_NAME,_WINDOW_ID)  ImGuiProfilerScope im_profiler_scope(_NAME, _WINDOW_ID)
+#define IMGUI_PROFILER_BEGIN(_NAME,_WINDOW_ID)  ImGui::ProfilerBeginZone(_NAME, _WINDOW_ID)
+#define IMGUI_PROFILER_END(_ZONE_IDX)           ImGui::ProfilerEndZone(_ZONE_IDX)
+#else
+#define IMGUI_PROFILER_SCOPE(_NAME,_WINDOW_ID)  ((void)0)
+#define IMGUI_PROFILER_BEGIN(_NAME,_WINDOW_ID)  (-1)
+#define IMGUI_PROFILER_END(_ZONE_IDX)           ((void)0)
+#endif
+
+// Attribute allocations made in the rest of current C++ scope to a given owner, for Metrics->Memory allocations. See ImGuiDebugAllocOwner.
+#ifndef IMGUI_DISABLE_DEBUG_TOOLS
+#define IMGUI_DEBUG_ALLOC_OWNER_SCOPE(_OWNER)   ImGuiDebugAllocOwnerScope im_debug_alloc_owner_scope(_OWNER)
+#else
+#define IMGUI_DEBUG_ALLOC_OWNER_SCOPE(_OWNER)   ((void)0)
+#endif
+
 // Static Asserts
 #define IM_STATIC_ASSERT(_COND)         static_assert(_COND, "")
 
@@ -352,6 +384,8 @@ IMGUI_API ImU32         ImAlphaBlendColors(ImU32 col_a, ImU32 col_b);
 static inline bool      ImIsPowerOfTwo(int v)           { return v != 0 && (v & (v - 1)) == 0; }
 static inline bool      ImIsPowerOfTwo(ImU64 v)         { return v != 0 && (v & (v - 1)) == 0; }
 static inline int       ImUpperPowerOfTwo(int v)        { v--; v |= v >> 1; v |= v >> 2; v |= v >> 4; v |= v >> 8; v |= v >> 16; v++; return v; }
+static inline int       ImCountSetBits(ImU64 v)         { v = v - ((v >> 1) & 0x5555555555555555ULL); v = (v & 0x3333333333333333ULL) + ((v >> 2) & 0x3333333333333333ULL); return (int)((((v + (v >> 4)) & 0x0F0F0F0F0F0F0F0FULL) * 0x0101010101010101ULL) >> 56); }
+static inline int       ImCountTrailingZeros(ImU64 v)   { IM_ASSERT(v != 0); return ImCountSetBits((v & (~v + 1)) - 1); }
 
 // Helpers: String
 IMGUI_API int           ImStricmp(const char* str1, const char* str2);                      // Case insensitive compare.
@@ -1005,9 +1039,13 @@ enum ImGuiLogFlags_
     ImGuiLogFlags_OutputFile        = 1 << 1,
     ImGuiLogFlags_OutputBuffer      = 1 << 2,
     ImGuiLogFlags_OutputClipboard   = 1 << 3,
-    ImGuiLogFlags_OutputMask_       = ImGuiLogFlags_OutputTTY | ImGuiLogFlags_OutputFile | ImGuiLogFlags_OutputBuffer | ImGuiLogFlags_OutputClipboard,
+    ImGuiLogFlags_OutputCallback    = 1 << 4,
+    ImGuiLogFlags_OutputMask_       = ImGuiLogFlags_OutputTTY | ImGuiLogFlags_OutputFile | ImGuiLogFlags_OutputBuffer | ImGuiLogFlags_OutputClipboard | ImGuiLogFlags_OutputCallback,
 };
 
+// Function signature for LogToCallback(). Called with chunks of text of IMGUI_LOG_FLUSH_SIZE bytes or more, and with 'finish' = true by LogFinish() with the remaining text.
+typedef void (*ImGuiLogCallback)(const char* data, int data_size, bool finish, void* user_data);
+
 // X/Y enums are fixed to 0/1 so they may be used to index ImVec2
 enum ImGuiAxis
 {
@@ -1022,6 +1060,8 @@ enum ImGuiPlotType
     ImGuiPlotType_Histogram,
 };
 
+#define IMGUI_PLOT_LOD_BLOCK_SIZE   32  // Number of values per block in level 0 of ImGuiPlotLod
+
 // Stacked color modifier, backup of modified data so we can restore it
 struct ImGuiColorMod
 {
@@ -1098,14 +1138,52 @@ struct IMGUI_API ImGuiInputTextDeactivatedState
     void    ClearFreeMemory()           { ID = 0; TextA.clear(); }
 };
 
+// Color span submitted by ImGuiInputTextCallbackData::SetTextColor(), offsets are relative to the beginning of the line.
+struct ImGuiInputTextColorSpan
+{
+    int         Begin, End;
+    ImU32       Col;
+};
+
+// Rendered geometry of a line, stored in ImGuiInputTextLineCache.
+struct ImGuiInputTextLineCacheEntry
+{
+    ImGuiID     Hash;                   // Hash of line contents
+    int         TextOffset, TextLen;    // Range in ImGuiInputTextLineCache::TextBuffer (compared on lookup to handle hash collisions)
+    int         LastFrameUsed;
+    int         VtxOffset, VtxCount;    // Range in ImGuiInputTextLineCache::VtxBuffer
+    int         IdxOffset, IdxCount;    // Range in ImGuiInputTextLineCache::IdxBuffer
+};
+
+// Per-widget render cache for InputTextMultiline() with ImGuiInputTextFlags_CallbackTextColor.
+// Visible lines are rendered once with their color spans, and further frames copy their vertices/indices into the draw list.
+// Vertices positions are relative to the line position, indices are relative to the line first vertex.
+// All entries are rendered with the same settings (font, size, color, alpha): the cache is emptied when they change.
+struct ImGuiInputTextLineCache
+{
+    ImGuiID                                 ID;             // widget id
+    int                                     LastFrameActive;
+    float                                   LastTimeActive; // for garbage collection
+    ImFont*                                 Font;           // Render settings of all entries
+    const ImFontGlyph*                      FontGlyphs;     // (changes when font atlas is rebuilt)
+    float                                   FontSize;
+    ImU32                                   Col;
+    float                                   Alpha;
+    ImGuiStorage                            EntriesMap;     // Hash -> index in Entries
+    ImVector<ImGuiInputTextLineCacheEntry>  Entries;
+    ImVector<char>                          TextBuffer;
+    ImVector<ImDrawVert>                    VtxBuffer;
+    ImVector<ImDrawIdx>                     IdxBuffer;
+
+    ImGuiInputTextLineCache()           { ID = 0; LastFrameActive = -1; LastTimeActive = -1.0f; Font = NULL; FontGlyphs = NULL; FontSize = 0.0f; Col = 0; Alpha = 0.0f; }
+};
+
 // Forward declare imstb_textedit.h structure + make its main configuration define accessible
 #undef IMSTB_TEXTEDIT_STRING
 #undef IMSTB_TEXTEDIT_CHARTYPE
 #define IMSTB_TEXTEDIT_STRING             ImGuiInputTextState
 #define IMSTB_TEXTEDIT_CHARTYPE           char
 #define IMSTB_TEXTEDIT_GETWIDTH_NEWLINE   (-1.0f)
-#define IMSTB_TEXTEDIT_UNDOSTATECOUNT     99
-#define IMSTB_TEXTEDIT_UNDOCHARCOUNT      999
 namespace ImStb { struct STB_TexteditState; }
 typedef ImStb::STB_TexteditState ImStbTexteditState;
 
@@ -1118,8 +1196,11 @@ struct IMGUI_API ImGuiInputTextState
     ImGuiID                 ID;                     // widget id owning the text state
     int                     TextLen;                // UTF-8 length of the string in TextA (in bytes)
     ImVector<char>          TextA;                  // main UTF8 buffer. TextA.Size is a buffer size! Should always be >= buf_size passed by user (and of course >= CurLenA + 1).
+    int                     TextGapPos;             // [ImGuiInputTextFlags_NoLiveEdit] gap buffer: when TextGapSize > 0, TextA contains [0,TextGapPos) followed by TextGapSize unused bytes, followed by [TextGapPos,TextLen).
+    int                     TextGapSize;            // [ImGuiInputTextFlags_NoLiveEdit] gap buffer: 0 when TextA is a contiguous zero-terminated string. Use TextGapClose() before accessing TextA.Data directly.
     ImVector<char>          TextToRevertTo;         // value to revert to when pressing Escape = backup of end-user buffer at the time of focus (in UTF-8, unaltered)
     ImVector<char>          CallbackTextBackup;     // temporary storage for callback to support automatic reconcile of undo-stack
+    ImVector<int>           LineStarts;             // byte offset of the beginning of each line in TextA. Empty when invalidated, rebuilt on demand by LineIndexUpdate(). Kept up to date by stb_textedit insert/delete.
     int                     BufCapacity;            // end-user buffer capacity (include zero terminator)
     ImVec2                  Scroll;                 // horizontal offset (managed manually) + vertical scrolling (pulled from child window's own Scroll.y)
     float                   CursorAnim;             // timer for cursor blink, reset on every user action so the cursor reappears immediately
@@ -1133,8 +1214,8 @@ struct IMGUI_API ImGuiInputTextState
 
     ImGuiInputTextState();
     ~ImGuiInputTextState();
-    void        ClearText()                 { TextLen = 0; TextA[0] = 0; CursorClamp(); }
-    void        ClearFreeMemory()           { TextA.clear(); TextToRevertTo.clear(); }
+    void        ClearText()                 { TextLen = 0; TextA[0] = 0; TextGapPos = TextGapSize = 0; LineIndexClear(); CursorClamp(); }
+    void        ClearFreeMemory()           { TextA.clear(); TextToRevertTo.clear(); LineStarts.clear(); }
     void        OnKeyPressed(int key);      // Cannot be inline because we call in code in stb_textedit.h implementation
     void        OnCharPressed(unsigned int c);
 
@@ -1148,6 +1229,21 @@ struct IMGUI_API ImGuiInputTextState
     int         GetSelectionEnd() const;
     void        SelectAll();
 
+    // Line index (for multi-line, allow looking up cursor line and visible lines without scanning the whole buffer)
+    void        LineIndexClear()            { LineStarts.resize(0); } // Call after modifying TextA without going through stb_textedit.
+    void        LineIndexUpdate();                                      // Rebuild if needed.
+    int         LineIndexFindLine(int pos) const;                       // Return line number for a byte offset. Binary search, requires an up to date index.
+    void        LineIndexOnInsert(int pos, const char* new_text, int new_text_len);
+    void        LineIndexOnDelete(int pos, int n);
+
+    // Gap buffer (for ImGuiInputTextFlags_NoLiveEdit, allow inserting/deleting text without moving everything after the cursor)
+    // Positions are always logical byte offsets in the text. Moving the gap is O(distance).
+    void        TextGapMove(int pos);                                   // Move gap to 'pos', opening it if needed. Gap uses all spare bytes in TextA.
+    void        TextGapClose();                                         // Move gap to the end, making TextA a contiguous zero-terminated string.
+    const char* TextGetRange(int begin, int end);                       // Return pointer to text [begin,end), moving gap out of the range if needed.
+    const char* TextGetPtr(int pos) const       { return TextA.Data + ((pos < TextGapPos) ? pos : pos + TextGapSize); }
+    const char* TextGetSegmentEnd(int pos) const{ return TextA.Data + ((TextGapSize > 0 && pos < TextGapPos) ? TextGapPos : TextLen + TextGapSize); } // End of contiguous part containing 'pos'
+
     // Reload user buf (WIP #2890)
     // If you modify underlying user-passed const char* while active you need to call this (InputText V2 may lift this)
     //   strcpy(my_buf, "hello");
@@ -1289,6 +1385,7 @@ struct ImGuiWindowStackData
     ImGuiLastItemData       ParentLastItemDataBackup;
     ImGuiErrorRecoveryState StackSizesInBegin;          // Store size of various stacks for asserting
     bool                    DisabledOverrideReenable;   // Non-child window override disabled flag
+    int                     ProfilerZoneIdx;            // "Window" profiler zone, ended by End(). -1 when not recording.
 };
 
 struct ImGuiShrinkWidthItem
@@ -1851,11 +1948,26 @@ struct ImGuiWindowSettings
     bool        IsChild;
     bool        WantApply;      // Set when loaded from .ini data (to enable merging/loading .ini data into an already running context)
     bool        WantDelete;     // Set to invalidate/delete the settings entry
+    int         IniTextOffset;  // Offset of this entry in g.SettingsWindowsWriteCache.Prev, valid when IniTextSize > 0
+    int         IniTextSize;    // Set to 0 when modified, to format this entry again on next save
 
     ImGuiWindowSettings()       { memset(this, 0, sizeof(*this)); }
     char* GetName()             { return (char*)(this + 1); }
 };
 
+// Helper: Text written by a settings handler on last save, for each entry.
+// When saving, entries which didn't change since last save are copied instead of being formatted again.
+struct ImGuiSettingsWriteCache
+{
+    ImGuiTextBuffer     Prev;           // Text written on last save
+    ImGuiTextBuffer     Curr;           // Text being written
+
+    void                Begin()                             { Prev.Buf.swap(Curr.Buf); Curr.Buf.resize(0); }
+    bool                CopyEntry(int* offset, int* size)   { if (*size <= 0) return false; const int curr_offset = Curr.size(); Curr.append(Prev.begin() + *offset, Prev.begin() + *offset + *size); *offset = curr_offset; return true; }
+    void                EndEntry(int entry_offset, int* offset, int* size) { *offset = entry_offset; *size = Curr.size() - entry_offset; }
+    void                Clear()                             { Prev.clear(); Curr.clear(); }
+};
+
 struct ImGuiSettingsHandler
 {
     const char* TypeName;       // Short description stored in .ini file. Disallowed characters: '[' ']'
@@ -1938,6 +2050,7 @@ enum ImGuiDebugLogFlags_
     ImGuiDebugLogFlags_EventMask_           = ImGuiDebugLogFlags_EventError | ImGuiDebugLogFlags_EventActiveId | ImGuiDebugLogFlags_EventFocus | ImGuiDebugLogFlags_EventPopup | ImGuiDebugLogFlags_EventNav | ImGuiDebugLogFlags_EventClipper | ImGuiDebugLogFlags_EventSelection | ImGuiDebugLogFlags_EventIO | ImGuiDebugLogFlags_EventFont | ImGuiDebugLogFlags_EventInputRouting | ImGuiDebugLogFlags_EventDocking | ImGuiDebugLogFlags_EventViewport,
     ImGuiDebugLogFlags_OutputToTTY          = 1 << 20,  // Also send output to TTY
     ImGuiDebugLogFlags_OutputToTestEngine   = 1 << 21,  // Also send output to Test Engine
+    ImGuiDebugLogFlags_OutputToTrace        = 1 << 22,  // Also send output to trace file as instant events (see ProfilerTraceStart())
 };
 
 struct ImGuiDebugAllocEntry
@@ -1947,6 +2060,39 @@ struct ImGuiDebugAllocEntry
     ImS16       FreeCount;
 };
 
+// Owner of an allocation, for Metrics->Memory allocations.
+// Unless set with IMGUI_DEBUG_ALLOC_OWNER_SCOPE(), it is deduced from current table/window when allocating.
+// Allocations of draw list buffers are identified when resolving them in next NewFrame().
+enum ImGuiDebugAllocOwner
+{
+    ImGuiDebugAllocOwner_None,          // Outside of a frame and not from an identified system (e.g. CreateContext(), backends, your code)
+    ImGuiDebugAllocOwner_Window,        // Windows and their temporary data (ID stack, state storage, item width stack...), including your code between Begin()/End()
+    ImGuiDebugAllocOwner_DrawList,      // Buffers of window and viewport draw lists
+    ImGuiDebugAllocOwner_DrawData,      // Render(): gathering draw lists into ImDrawData
+    ImGuiDebugAllocOwner_Table,         // Tables and their temporary data, including your code between BeginTable()/EndTable()
+    ImGuiDebugAllocOwner_InputText,     // InputText() state and buffers
+    ImGuiDebugAllocOwner_Font,          // Font atlas and fonts
+    ImGuiDebugAllocOwner_Settings,      // .ini settings data and text
+    ImGuiDebugAllocOwner_TextLog,       // Debug log and logging/capture text buffers
+    ImGuiDebugAllocOwner_COUNT
+};
+
+// An allocation of current frame, attributed to its owner in next NewFrame().
+struct ImGuiDebugAllocPending
+{
+    void*               Ptr;            // NULL once freed
+    int                 Size;
+    ImS16               MovedTo;        // When freed by a reallocation (e.g. ImVector<> growing): index of the new allocation in PendingBuf[]
+    ImS8                Owner;          // ImGuiDebugAllocOwner
+};
+
+// Allocations of one frame, per owner
+struct ImGuiDebugAllocFrameStats
+{
+    int                 AllocCount[ImGuiDebugAllocOwner_COUNT];
+    int                 AllocBytes[ImGuiDebugAllocOwner_COUNT];
+};
+
 struct ImGuiDebugAllocInfo
 {
     int         TotalAllocCount;            // Number of call to MemAlloc().
@@ -1954,9 +2100,161 @@ struct ImGuiDebugAllocInfo
     ImS16       LastEntriesIdx;             // Current index in buffer
     ImGuiDebugAllocEntry LastEntriesBuf[6]; // Track last 6 frames that had allocations
 
+    // Per owner attribution
+    ImGuiDebugAllocOwner        OwnerOverride;          // Set by IMGUI_DEBUG_ALLOC_OWNER_SCOPE()
+    bool                        LastHookWasAlloc;       // To detect reallocations (alloc new block, copy, free old block)
+    int                         PendingCount;
+    ImGuiDebugAllocPending      PendingBuf[128];        // Allocations of current frame. When full, allocations are attributed immediately (without identifying draw lists)
+    ImGuiDebugAllocFrameStats   CurrFrame;
+    ImGuiDebugAllocFrameStats   History[60];            // Last 60 frames, for steady-state numbers
+    int                         HistoryIdx;
+    int                         HistoryCount;
+    int                         OwnerTotalCount[ImGuiDebugAllocOwner_COUNT];
+    ImU64                       OwnerTotalBytes[ImGuiDebugAllocOwner_COUNT];
+
     ImGuiDebugAllocInfo() { memset(this, 0, sizeof(*this)); }
 };
 
+// Type of owner of a memory report entry, see GetMemoryReport()
+enum ImGuiMemoryReportType
+{
+    ImGuiMemoryReportType_Context,      // Context-wide buffers (windows lists, viewports draw lists, input text state, debug log, profiler...)
+    ImGuiMemoryReportType_Window,
+    ImGuiMemoryReportType_Table,
+    ImGuiMemoryReportType_Font,
+    ImGuiMemoryReportType_Settings,
+    ImGuiMemoryReportType_Clipper,
+    ImGuiMemoryReportType_COUNT
+};
+
+// One buffer (or group of buffers) of an owner. Heap memory only: e.g. an ImGuiWindow counts sizeof(ImGuiWindow) and its buffers.
+struct ImGuiMemoryReportEntry
+{
+    ImGuiMemoryReportType   Type;
+    ImGuiID                 OwnerID;        // Window or table ID, 0 otherwise
+    const char*             OwnerName;      // Window name, font name... Valid until owner is destroyed: use report in same frame.
+    const char*             Part;           // Static string, e.g. "DrawList.VtxBuffer"
+    size_t                  UsedBytes;      // e.g. Size * sizeof(T) for an ImVector<T>
+    size_t                  CapacityBytes;  // e.g. Capacity * sizeof(T) for an ImVector<T>: this is what is allocated
+};
+
+struct ImGuiMemoryReport
+{
+    ImVector<ImGuiMemoryReportEntry> Entries;
+    size_t                  TotalUsedBytes[ImGuiMemoryReportType_COUNT];
+    size_t                  TotalCapacityBytes[ImGuiMemoryReportType_COUNT];
+
+    ImGuiMemoryReport()     { Clear(); }
+    void                    Clear() { Entries.resize(0); memset(TotalUsedBytes, 0, sizeof(TotalUsedBytes)); memset(TotalCapacityBytes, 0, sizeof(TotalCapacityBytes)); }
+};
+
+// A timed zone recorded by the profiler (see IMGUI_PROFILER_SCOPE() macros).
+// Consecutive calls to a same zone without child zones (e.g. many RenderText() calls in a row) are merged into one entry with Count > 1.
+struct ImGuiProfilerZone
+{
+    const char*             Name;               // Static string
+    ImGuiID                 WindowID;           // Window the zone relates to, 0 if none
+    int                     Depth;              // Number of parent zones
+    int                     Count;              // Number of merged calls
+    ImU64                   TimeBegin;          // In nanoseconds. Begin of first call.
+    ImU64                   TimeEnd;            // In nanoseconds. End of last call.
+    ImU64                   TimeTotal;          // In nanoseconds. Sum of all calls (<= TimeEnd - TimeBegin when Count > 1).
+};
+
+struct ImGuiProfilerFrame
+{
+    int                     FrameCount;         // Value of g.FrameCount for this frame
+    int                     ZonesDropped;       // Zones not recorded because ZonesPerFrameMax was reached
+    ImU64                   TimeBegin;          // In nanoseconds. Start of NewFrame().
+    ImU64                   TimeEnd;            // In nanoseconds. End of last top-level zone, typically Render().
+    ImVector<ImGuiProfilerZone> Zones;          // In order of begin: parents are before their children.
+
+    ImGuiProfilerFrame()    { FrameCount = ZonesDropped = 0; TimeBegin = TimeEnd = 0; }
+};
+
+struct ImGuiProfilerStackEntry
+{
+    int                     ZoneIdx;
+    ImU64                   TimeBegin;
+};
+
+// Hierarchical profiler for the core's own phases (NewFrame, Begin/End, TableUpdateLayout, RenderText, EndFrame, Render...).
+// - Zones are recorded for the frames started while Enabled is set, into a ring buffer of the last FramesMax frames.
+// - A frame starts with NewFrame() and is completed by the next call to NewFrame().
+// - Ending a zone also ends zones that were begun after it and are still open.
+struct ImGuiProfiler
+{
+    bool                    Enabled;            // Record zones.
+    bool                    Paused;             // Don't record zones, keep history.
+    int                     FramesMax;          // = 120. Size of history.
+    int                     ZonesPerFrameMax;   // = 16384.
+    int                     FramesIdx;          // Index in Frames[] of next frame to record.
+    int                     FramesCount;        // Number of completed frames in history.
+    int                     CurrFrameIdx;       // Index in Frames[] of frame being recorded, -1 if none.
+    ImVector<ImGuiProfilerFrame> Frames;        // Ring buffer
+    ImVector<ImGuiProfilerStackEntry> Stack;    // Open zones of frame being recorded
+    int                     ViewFrameOffset;    // Metrics window: frame being viewed (0: last completed frame).
+    float                   ViewZoom;           // Metrics window: timeline zoom.
+
+    // Trace output (see ProfilerTraceStart())
+    ImFileHandle            TraceFile;
+    ImGuiTextBuffer         TraceBuf;           // Pending output, written to TraceFile in chunks of IMGUI_PROFILER_TRACE_FLUSH_SIZE bytes.
+    ImU64                   TraceTimeBase;      // Timestamps in trace are relative to this.
+    ImU64                   TraceSize;          // Bytes written so far
+    int                     TraceEventsCount;
+    bool                    TraceBackupEnabled; // Value of Enabled before ProfilerTraceStart()
+    bool                    TraceBackupDebugLogToTrace; // Was ImGuiDebugLogFlags_OutputToTrace set before ProfilerTraceStart()?
+
+    ImGuiProfiler()         { Enabled = Paused = false; FramesMax = 120; ZonesPerFrameMax = 16384; FramesIdx = FramesCount = 0; CurrFrameIdx = -1; ViewFrameOffset = 0; ViewZoom = 1.0f; TraceFile = NULL; TraceTimeBase = TraceSize = 0; TraceEventsCount = 0; TraceBackupEnabled = TraceBackupDebugLogToTrace = false; }
+    void ClearFrames()      { for (ImGuiProfilerFrame& frame : Frames) frame.Zones.clear(); Frames.clear(); Stack.clear(); FramesIdx = FramesCount = 0; CurrFrameIdx = -1; }
+};
+
+// Draw-call statistics of one ImDrawList for one frame, collected by Render() while ImGuiDrawStats::Enabled is set.
+struct ImGuiDrawStatsList
+{
+    const char*             OwnerName;          // ImDrawList::_OwnerName (window name, "##Background", "##Foreground"). Only valid during the frame it was collected.
+    int                     CmdCount;           // Draw commands with elements (= draw calls)
+    int                     CmdMergedCount;     // New draw commands that were merged back into previous one (see ImDrawList::_OnChangedClipRect(), ImDrawListSplitter::Merge())
+    int                     CallbackCount;      // Draw commands with a user callback
+    int                     TextureChanges;     // Draw calls using a different texture than the previous one in the list
+    int                     ClipRectChanges;    // Draw calls using a different clipping rectangle than the previous one in the list
+    int                     VtxCount;
+    int                     IdxCount;
+    float                   PixelsDrawn;        // Estimate: sum of triangle areas, each scaled by the fraction of its bounding box which is inside its clipping rectangle
+
+    ImGuiDrawStatsList()    { memset(this, 0, sizeof(*this)); }
+};
+
+struct ImGuiDrawStatsFrame
+{
+    int                     FrameCount;         // Value of g.FrameCount for this frame
+    int                     DrawListsCount;
+    float                   DisplayArea;        // Sum of viewports areas, in pixels
+    ImGuiDrawStatsList      Totals;             // Sum of all draw lists (OwnerName is NULL)
+
+    ImGuiDrawStatsFrame()   { FrameCount = DrawListsCount = 0; DisplayArea = 0.0f; }
+    float   GetOverdraw() const { return DisplayArea > 0.0f ? Totals.PixelsDrawn / DisplayArea : 0.0f; }
+};
+
+// Draw-call statistics for the Metrics window.
+// - Collected between the start and the end of Render() while Enabled is set, into a ring buffer of the last FramesMax frames.
+// - Estimating PixelsDrawn walks every triangle of every draw list: this is not free, keep Enabled off when not looking at it.
+struct ImGuiDrawStats
+{
+    bool                    Enabled;            // Collect statistics.
+    bool                    Recording;          // Set during Render() when Enabled.
+    int                     FramesMax;          // = 120. Size of history.
+    int                     FramesIdx;          // Index in Frames[] of next frame to record.
+    int                     FramesCount;        // Number of completed frames in history.
+    ImGuiDrawStatsFrame     CurrFrame;          // Frame being recorded
+    ImVector<ImGuiDrawStatsFrame> Frames;       // Ring buffer
+    ImVector<ImGuiDrawStatsList> CurrLists;     // Per draw list statistics of frame being recorded
+    ImVector<ImGuiDrawStatsList> Lists;         // Per draw list statistics of last completed frame
+
+    ImGuiDrawStats()        { Enabled = Recording = false; FramesMax = 120; FramesIdx = FramesCount = 0; }
+    void ClearFrames()      { Frames.clear(); CurrLists.clear(); Lists.clear(); FramesIdx = FramesCount = 0; }
+};
+
 struct ImGuiMetricsConfig
 {
     bool        ShowDebugLog = false;
@@ -1968,6 +2266,7 @@ struct ImGuiMetricsConfig
     bool        ShowDrawCmdBoundingBoxes = true;
     bool        ShowTextEncodingViewer = false;
     bool        ShowAtlasTintedWithTextColor = false;
+    bool        MemoryReportGroupByOwner = false;
     int         ShowWindowsRectsType = -1;
     int         ShowTablesRectsType = -1;
     int         HighlightMonitorIdx = -1;
@@ -1998,6 +2297,36 @@ struct ImGuiIDStackTool
     ImGuiIDStackTool()      { memset(this, 0, sizeof(*this)); CopyToClipboardLastTime = -FLT_MAX; }
 };
 
+// Transient buffers which may be freed to fit io.ConfigMemoryCompactBudget, see GcCompactTransientBuffersToBudget()
+enum ImGuiGcCandidateType
+{
+    ImGuiGcCandidateType_Window,
+    ImGuiGcCandidateType_Table,
+    ImGuiGcCandidateType_TableTempData,
+};
+
+struct ImGuiGcCandidate
+{
+    ImGuiGcCandidateType    Type;
+    int                     Index;              // Index in g.Windows[], g.Tables pool or g.TablesTempData[]
+    float                   LastTimeActive;
+    size_t                  Bytes;              // Bytes freed by compacting
+};
+
+// Memory compaction statistics, for the Metrics window.
+struct ImGuiGcStats
+{
+    size_t                  TransientBytes;         // Transient buffers of windows and tables which are not compacted. Only updated when io.ConfigMemoryCompactBudget > 0.
+    int                     WindowsCompactedCount;  // Number of times transient buffers of a window were freed (after io.ConfigMemoryCompactTimer, to fit budget or on request)
+    int                     TablesCompactedCount;
+    int                     BudgetCompactedCount;   // Number of windows/tables compacted because io.ConfigMemoryCompactBudget was exceeded
+    int                     DrawListsShrunkCount;   // Number of times draw list buffers were shrunk (see io.ConfigMemoryShrinkDrawListFrames)
+    size_t                  DrawListsShrunkBytes;   // Bytes released by shrinking draw list buffers
+    ImVector<ImGuiGcCandidate> Candidates;          // Temporary storage for GcCompactTransientBuffersToBudget()
+
+    ImGuiGcStats()          { TransientBytes = DrawListsShrunkBytes = 0; WindowsCompactedCount = TablesCompactedCount = BudgetCompactedCount = DrawListsShrunkCount = 0; }
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] Generic context hooks
 //-----------------------------------------------------------------------------
@@ -2278,11 +2607,14 @@ struct ImGuiContext
     // Widget state
     ImGuiInputTextState     InputTextState;
     ImGuiInputTextDeactivatedState InputTextDeactivatedState;
+    ImPool<ImGuiInputTextLineCache> InputTextLineCaches;        // [ImGuiInputTextFlags_CallbackTextColor] Render caches
+    ImVector<ImGuiInputTextColorSpan> InputTextColorSpans;      // [ImGuiInputTextFlags_CallbackTextColor] Temporary storage for SetTextColor()
     ImFont                  InputTextPasswordFont;
     ImGuiID                 TempInputId;                        // Temporary text input when CTRL+clicking on a slider, etc.
     ImGuiDataTypeStorage    DataTypeZeroValue;                  // 0 for all data types
     int                     BeginMenuDepth;
     int                     BeginComboDepth;
+    ImVector<ImVec2>        PlotColumnsMinMax;                  // Temporary storage for PlotEx(): min/max of values covered by each pixel column
     ImGuiColorEditFlags     ColorEditOptions;                   // Store user options for color edit widgets
     ImGuiID                 ColorEditCurrentID;                 // Set temporarily while inside of the parent-most ColorEdit4/ColorPicker4 (because they call each others).
     ImGuiID                 ColorEditSavedID;                   // ID we are saving/restoring HS for
@@ -2320,6 +2652,8 @@ struct ImGuiContext
     ImVector<ImGuiSettingsHandler>      SettingsHandlers;       // List of .ini settings handlers
     ImChunkStream<ImGuiWindowSettings>  SettingsWindows;        // ImGuiWindow .ini settings entries
     ImChunkStream<ImGuiTableSettings>   SettingsTables;         // ImGuiTable .ini settings entries
+    ImGuiSettingsWriteCache             SettingsWindowsWriteCache;  // Text of ImGuiWindowSettings entries on last save
+    ImGuiSettingsWriteCache             SettingsTablesWriteCache;   // Text of ImGuiTableSettings entries on last save
     ImVector<ImGuiContextHook>          Hooks;                  // Hooks for extensions (e.g. test engine)
     ImGuiID                             HookIdNext;             // Next available HookId
 
@@ -2331,7 +2665,9 @@ struct ImGuiContext
     ImGuiLogFlags           LogFlags;                           // Capture flags/type
     ImGuiWindow*            LogWindow;
     ImFileHandle            LogFile;                            // If != NULL log to stdout/ file
-    ImGuiTextBuffer         LogBuffer;                          // Accumulation buffer when log to clipboard. This is pointer so our GImGui static constructor doesn't call heap allocators.
+    ImGuiTextBuffer         LogBuffer;                          // Accumulation buffer when log to clipboard, or pending text to write to file/callback. This is pointer so our GImGui static constructor doesn't call heap allocators.
+    ImGuiLogCallback        LogCallback;                        // When logging to callback
+    void*                   LogCallbackUserData;
     const char*             LogNextPrefix;
     const char*             LogNextSuffix;
     float                   LogLinePosY;
@@ -2370,6 +2706,9 @@ struct ImGuiContext
     ImGuiMetricsConfig      DebugMetricsConfig;
     ImGuiIDStackTool        DebugIDStackTool;
     ImGuiDebugAllocInfo     DebugAllocInfo;
+    ImGuiProfiler           Profiler;
+    ImGuiDrawStats          DrawStats;
+    ImGuiGcStats            GcStats;
 
     // Misc
     float                   FramerateSecPerFrame[60];           // Calculate estimate of framerate for user over the last 60 frames..
@@ -2547,6 +2886,7 @@ struct IMGUI_API ImGuiWindow
 
     int                     MemoryDrawListIdxCapacity;          // Backup of last idx/vtx count, so when waking up the window we can preallocate and avoid iterative alloc/copy
     int                     MemoryDrawListVtxCapacity;
+    int                     MemoryDrawListOversizedFrames;      // Number of consecutive frames the draw list used less than half of its buffers capacity (see io.ConfigMemoryShrinkDrawListFrames)
     bool                    MemoryCompacted;                    // Set when window extraneous data have been garbage collected
 
 public:
@@ -2651,9 +2991,11 @@ struct IMGUI_API ImGuiTabBar
 //-----------------------------------------------------------------------------
 
 #define IM_COL32_DISABLE                IM_COL32(0,0,0,1)   // Special sentinel code which cannot be used as a regular color.
-#define IMGUI_TABLE_MAX_COLUMNS         512                 // May be further lifted
+#ifndef IMGUI_TABLE_MAX_COLUMNS
+#define IMGUI_TABLE_MAX_COLUMNS         4096                // Maximum columns count (exclusive). May be overridden in imconfig.h, must be <= 32000 as draw channels indices are 16-bit.
+#endif
 
-// Our current column maximum is 64 but we may raise that in the future.
+// Column and draw channel indices are stored on 16-bit to keep per-column data small.
 typedef ImS16 ImGuiTableColumnIdx;
 typedef ImU16 ImGuiTableDrawChannelIdx;
 
@@ -2661,19 +3003,14 @@ typedef ImU16 ImGuiTableDrawChannelIdx;
 // We use the terminology "Enabled" to refer to a column that is not Hidden by user/api.
 // We use the terminology "Clipped" to refer to a column that is out of sight because of scrolling/clipping.
 // This is in contrast with some user-facing api such as IsItemVisible() / IsRectVisible() which use "Visible" to mean "not clipped".
+// Fields are ordered by access frequency: the first 53 bytes hold everything touched by TableBeginCell()/TableEndCell() for
+// every cell of every row, the rest is only accessed by TableUpdateLayout(), settings, sorting and headers.
+// Boolean flags are packed in one byte, and small cold fields fill the padding after the hot fields.
 struct ImGuiTableColumn
 {
+    // Hot data: accessed on every cell
     ImGuiTableColumnFlags   Flags;                          // Flags after some patching (not directly same as provided by user). See ImGuiTableColumnFlags_
-    float                   WidthGiven;                     // Final/actual width visible == (MaxX - MinX), locked in TableUpdateLayout(). May be > WidthRequest to honor minimum width, may be < WidthRequest to honor shrinking columns down in tight space.
-    float                   MinX;                           // Absolute positions
-    float                   MaxX;
-    float                   WidthRequest;                   // Master width absolute value when !(Flags & _WidthStretch). When Stretch this is derived every frame from StretchWeight in TableUpdateLayout()
-    float                   WidthAuto;                      // Automatic width
-    float                   WidthMax;                       // Maximum width (FIXME: overwritten by each instance)
-    float                   StretchWeight;                  // Master width weight when (Flags & _WidthStretch). Often around ~1.0f initially.
-    float                   InitStretchWeightOrWidth;       // Value passed to TableSetupColumn(). For Width it is a content width (_without padding_).
     ImRect                  ClipRect;                       // Clipping rectangle for the column
-    ImGuiID                 UserID;                         // Optional, value passed to TableSetupColumn()
     float                   WorkMinX;                       // Contents region min ~(MinX + CellPaddingX + CellSpacingX1) == cursor start position when entering column
     float                   WorkMaxX;                       // Contents region max ~(MaxX - CellPaddingX - CellSpacingX2)
     float                   ItemWidth;                      // Current item width for the column, preserved across rows
@@ -2681,30 +3018,41 @@ struct ImGuiTableColumn
     float                   ContentMaxXUnfrozen;
     float                   ContentMaxXHeadersUsed;         // Contents maximum position for headers rows (regardless of freezing). TableHeader() automatically softclip itself + report ideal desired size, to avoid creating extraneous draw calls
     float                   ContentMaxXHeadersIdeal;
-    ImS16                   NameOffset;                     // Offset into parent ColumnsNames[]
-    ImGuiTableColumnIdx     DisplayOrder;                   // Index within Table's IndexToDisplayOrder[] (column may be reordered by users)
-    ImGuiTableColumnIdx     IndexWithinEnabledSet;          // Index within enabled/visible set (<= IndexToDisplayOrder)
-    ImGuiTableColumnIdx     PrevEnabledColumn;              // Index of prev enabled/visible column within Columns[], -1 if first enabled/visible column
-    ImGuiTableColumnIdx     NextEnabledColumn;              // Index of next enabled/visible column within Columns[], -1 if last enabled/visible column
-    ImGuiTableColumnIdx     SortOrder;                      // Index of this column within sort specs, -1 if not sorting on this column, 0 for single-sort, may be >0 on multi-sort
     ImGuiTableDrawChannelIdx DrawChannelCurrent;            // Index within DrawSplitter.Channels[]
-    ImGuiTableDrawChannelIdx DrawChannelFrozen;             // Draw channels for frozen rows (often headers)
-    ImGuiTableDrawChannelIdx DrawChannelUnfrozen;           // Draw channels for unfrozen rows
-    bool                    IsEnabled;                      // IsUserEnabled && (Flags & ImGuiTableColumnFlags_Disabled) == 0
-    bool                    IsUserEnabled;                  // Is the column not marked Hidden by the user? (unrelated to being off view, e.g. clipped by scrolling).
-    bool                    IsUserEnabledNextFrame;
-    bool                    IsVisibleX;                     // Is actually in view (e.g. overlapping the host window clipping rectangle, not scrolled).
-    bool                    IsVisibleY;
-    bool                    IsRequestOutput;                // Return value for TableSetColumnIndex() / TableNextColumn(): whether we request user to output contents or not.
-    bool                    IsSkipItems;                    // Do we want item submissions to this column to be completely ignored (no layout will happen).
-    bool                    IsPreserveWidthAuto;
     ImS8                    NavLayerCurrent;                // ImGuiNavLayer in 1 byte
+    ImU8                    IsEnabled : 1;                  // IsUserEnabled && (Flags & ImGuiTableColumnFlags_Disabled) == 0
+    ImU8                    IsRequestOutput : 1;            // Return value for TableSetColumnIndex() / TableNextColumn(): whether we request user to output contents or not.
+    ImU8                    IsSkipItems : 1;                // Do we want item submissions to this column to be completely ignored (no layout will happen).
+    ImU8                    IsUserEnabled : 1;              // Is the column not marked Hidden by the user? (unrelated to being off view, e.g. clipped by scrolling).
+    ImU8                    IsUserEnabledNextFrame : 1;
+    ImU8                    IsVisibleX : 1;                 // Is actually in view (e.g. overlapping the host window clipping rectangle, not scrolled).
+    ImU8                    IsVisibleY : 1;
+    ImU8                    IsPreserveWidthAuto : 1;
+
+    // Cold data: layout, settings, sorting
     ImU8                    AutoFitQueue;                   // Queue of 8 values for the next 8 frames to request auto-fit
     ImU8                    CannotSkipItemsQueue;           // Queue of 8 values for the next 8 frames to disable Clipped/SkipItem
     ImU8                    SortDirection : 2;              // ImGuiSortDirection_Ascending or ImGuiSortDirection_Descending
     ImU8                    SortDirectionsAvailCount : 2;   // Number of available sort directions (0 to 3)
     ImU8                    SortDirectionsAvailMask : 4;    // Mask of available sort directions (1-bit each)
     ImU8                    SortDirectionsAvailList;        // Ordered list of available sort directions (2-bits each, total 8-bits)
+    float                   WidthGiven;                     // Final/actual width visible == (MaxX - MinX), locked in TableUpdateLayout(). May be > WidthRequest to honor minimum width, may be < WidthRequest to honor shrinking columns down in tight space.
+    float                   MinX;                           // Absolute positions
+    float                   MaxX;
+    float                   WidthRequest;                   // Master width absolute value when !(Flags & _WidthStretch). When Stretch this is derived every frame from StretchWeight in TableUpdateLayout()
+    float                   WidthAuto;                      // Automatic width
+    float                   WidthMax;                       // Maximum width (FIXME: overwritten by each instance)
+    float                   StretchWeight;                  // Master width weight when (Flags & _WidthStretch). Often around ~1.0f initially.
+    float                   InitStretchWeightOrWidth;       // Value passed to TableSetupColumn(). For Width it is a content width (_without padding_).
+    ImGuiID                 UserID;                         // Optional, value passed to TableSetupColumn()
+    int                     NameOffset;                     // Offset into parent ColumnsNames[]
+    ImGuiTableColumnIdx     DisplayOrder;                   // Index within Table's IndexToDisplayOrder[] (column may be reordered by users)
+    ImGuiTableColumnIdx     IndexWithinEnabledSet;          // Index within enabled/visible set (<= IndexToDisplayOrder)
+    ImGuiTableColumnIdx     PrevEnabledColumn;              // Index of prev enabled/visible column within Columns[], -1 if first enabled/visible column
+    ImGuiTableColumnIdx     NextEnabledColumn;              // Index of next enabled/visible column within Columns[], -1 if last enabled/visible column
+    ImGuiTableColumnIdx     SortOrder;                      // Index of this column within sort specs, -1 if not sorting on this column, 0 for single-sort, may be >0 on multi-sort
+    ImGuiTableDrawChannelIdx DrawChannelFrozen;             // Draw channels for frozen rows (often headers)
+    ImGuiTableDrawChannelIdx DrawChannelUnfrozen;           // Draw channels for unfrozen rows
 
     ImGuiTableColumn()
     {
@@ -2715,7 +3063,7 @@ struct ImGuiTableColumn
         PrevEnabledColumn = NextEnabledColumn = -1;
         SortOrder = -1;
         SortDirection = ImGuiSortDirection_None;
-        DrawChannelCurrent = DrawChannelFrozen = DrawChannelUnfrozen = (ImU8)-1;
+        DrawChannelCurrent = DrawChannelFrozen = DrawChannelUnfrozen = (ImGuiTableDrawChannelIdx)-1;
     }
 };
 
@@ -2823,6 +3171,7 @@ struct IMGUI_API ImGuiTable
     ImGuiTableColumnIdx         SortSpecsCount;
     ImGuiTableColumnIdx         ColumnsEnabledCount;        // Number of enabled columns (<= ColumnsCount)
     ImGuiTableColumnIdx         ColumnsEnabledFixedCount;   // Number of enabled columns using fixed width (<= ColumnsCount)
+    ImGuiTableColumnIdx         ColumnsVisibleCount;        // Number of enabled columns which are not clipped (<= ColumnsEnabledCount). Only those get a draw channel.
     ImGuiTableColumnIdx         DeclColumnsCount;           // Count calls to TableSetupColumn()
     ImGuiTableColumnIdx         AngledHeadersCount;         // Count columns with angled headers
     ImGuiTableColumnIdx         HoveredColumnBody;          // Index of column whose visible region is being hovered. Important: == ColumnsCount when hovering empty region after the right-most column!
@@ -2881,6 +3230,7 @@ struct IMGUI_API ImGuiTableTempData
 {
     int                         TableIndex;                 // Index in g.Tables.Buf[] pool
     float                       LastTimeActive;             // Last timestamp this structure was used
+    int                         LastFrameActive;            // Last frame-count this structure was used
     float                       AngledHeadersExtraWidth;    // Used in EndTable()
     ImVector<ImGuiTableHeaderData> AngledHeadersRequests;   // Used in TableAngledHeadersRow()
 
@@ -2895,6 +3245,7 @@ struct IMGUI_API ImGuiTableTempData
     ImVec1                      HostBackupColumnsOffset;    // Backup of OuterWindow->DC.ColumnsOffset at the end of BeginTable()
     float                       HostBackupItemWidth;        // Backup of OuterWindow->DC.ItemWidth at the end of BeginTable()
     int                         HostBackupItemWidthStackSize;//Backup of OuterWindow->DC.ItemWidthStack.Size at the end of BeginTable()
+    int                         ProfilerZoneIdx;            // "Table" profiler zone, ended by EndTable(). -1 when not recording.
 
     ImGuiTableTempData()        { memset(this, 0, sizeof(*this)); LastTimeActive = -1.0f; }
 };
@@ -2932,6 +3283,8 @@ struct ImGuiTableSettings
     ImGuiTableColumnIdx         ColumnsCount;
     ImGuiTableColumnIdx         ColumnsCountMax;        // Maximum number of columns this settings instance can store, we can recycle a settings instance with lower number of columns but not higher
     bool                        WantApply;              // Set when loaded from .ini data (to enable merging/loading .ini data into an already running context)
+    int                         IniTextOffset;          // Offset of this entry in g.SettingsTablesWriteCache.Prev, valid when IniTextSize > 0
+    int                         IniTextSize;            // Set to 0 when modified, to format this entry again on next save
 
     ImGuiTableSettings()        { memset(this, 0, sizeof(*this)); }
     ImGuiTableColumnSettings*   GetColumnSettings()     { return (ImGuiTableColumnSettings*)(this + 1); }
@@ -3082,6 +3435,7 @@ namespace ImGui
     // Logging/Capture
     IMGUI_API void          LogBegin(ImGuiLogFlags flags, int auto_open_depth);         // -> BeginCapture() when we design v2 api, for now stay under the radar by using the old name.
     IMGUI_API void          LogToBuffer(int auto_open_depth = -1);                      // Start logging/capturing to internal buffer
+    IMGUI_API void          LogToCallback(ImGuiLogCallback callback, void* user_data, int auto_open_depth = -1); // Start logging/capturing to a callback, receiving text in large chunks (e.g. to write it from another thread)
     IMGUI_API void          LogRenderedText(const ImVec2* ref_pos, const char* text, const char* text_end = NULL);
     IMGUI_API void          LogSetNextTextDecoration(const char* prefix, const char* suffix);
 
@@ -3323,6 +3677,8 @@ namespace ImGui
     IMGUI_API void          TableGcCompactTransientBuffers(ImGuiTable* table);
     IMGUI_API void          TableGcCompactTransientBuffers(ImGuiTableTempData* table);
     IMGUI_API void          TableGcCompactSettings();
+    IMGUI_API size_t        TableGcCalcTransientBytes(ImGuiTable* table);
+    IMGUI_API size_t        TableGcCalcTransientBytes(ImGuiTableTempData* table);
 
     // Tables: Settings
     IMGUI_API void                  TableLoadSettings(ImGuiTable* table);
@@ -3447,7 +3803,7 @@ namespace ImGui
     IMGUI_API void          ColorPickerOptionsPopup(const float* ref_col, ImGuiColorEditFlags flags);
 
     // Plot
-    IMGUI_API int           PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_getter)(void* data, int idx), void* data, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, const ImVec2& size_arg);
+    IMGUI_API int           PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_getter)(void* data, int idx), void* data, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, const ImVec2& size_arg, const ImGuiPlotLod* lod = NULL); // When 'lod' is set, values_count may be smaller than lod->ValuesCount: indices wrap around lod->ValuesCount.
 
     // Shade functions (write over already created vertices)
     IMGUI_API void          ShadeVertsLinearColorGradientKeepAlpha(ImDrawList* draw_list, int vert_start_idx, int vert_end_idx, ImVec2 gradient_p0, ImVec2 gradient_p1, ImU32 col0, ImU32 col1);
@@ -3458,6 +3814,9 @@ namespace ImGui
     IMGUI_API void          GcCompactTransientMiscBuffers();
     IMGUI_API void          GcCompactTransientWindowBuffers(ImGuiWindow* window);
     IMGUI_API void          GcAwakeTransientWindowBuffers(ImGuiWindow* window);
+    IMGUI_API size_t        GcCalcTransientWindowBytes(ImGuiWindow* window);        // Bytes freed by GcCompactTransientWindowBuffers()
+    IMGUI_API void          GcCompactTransientBuffersToBudget();                    // Free transient buffers of least recently active windows/tables until io.ConfigMemoryCompactBudget is satisfied
+    IMGUI_API void          GcShrinkDrawListBuffers(ImGuiWindow* window);
 
     // Error handling, State Recovery
     IMGUI_API bool          ErrorLog(const char* msg);
@@ -3471,6 +3830,19 @@ namespace ImGui
 
     // Debug Tools
     IMGUI_API void          DebugAllocHook(ImGuiDebugAllocInfo* info, int frame_count, void* ptr, size_t size); // size >= 0 : alloc, size = -1 : free
+    IMGUI_API void          DebugAllocResolveFrame(ImGuiDebugAllocInfo* info);  // Attribute allocations of last frame to their owners. Called by NewFrame().
+    IMGUI_API const char*   DebugAllocGetOwnerName(ImGuiDebugAllocOwner owner);
+    IMGUI_API void          GetMemoryReport(ImGuiMemoryReport* out_report);     // Enumerate heap buffers of windows, tables, fonts, settings, clipper and context, with used/capacity bytes.
+    IMGUI_API void          DebugDrawStatsBeginFrame();                         // Called by Render() when DrawStats.Enabled is set.
+    IMGUI_API void          DebugDrawStatsAddDrawList(const ImDrawList* draw_list); // Called by Render() for each draw list of each viewport when DrawStats.Recording is set.
+    IMGUI_API void          DebugDrawStatsEndFrame();
+    IMGUI_API const ImGuiDrawStatsFrame* DebugDrawStatsGetFrame(int frame_offset);  // 0: last completed frame, 1: frame before etc. NULL if not in history.
+    IMGUI_API ImU64         ProfilerGetTime();                                      // High resolution monotonic time, in nanoseconds.
+    IMGUI_API int           ProfilerBeginZone(const char* name, ImGuiID window_id); // Return zone index to pass to ProfilerEndZone(), -1 when not recording. Prefer using IMGUI_PROFILER_XXX() macros.
+    IMGUI_API void          ProfilerEndZone(int zone_idx);
+    IMGUI_API const ImGuiProfilerFrame* ProfilerGetFrame(int frame_offset);          // 0: last completed frame, 1: frame before etc. NULL if not in history.
+    IMGUI_API bool          ProfilerTraceStart(const char* filename);               // Enable profiler and stream zones of each frame + debug log entries to a Chrome Trace Event JSON file (chrome://tracing, ui.perfetto.dev).
+    IMGUI_API void          ProfilerTraceStop();                                    // Close file, restore profiler enabled state and debug log flags.
     IMGUI_API void          DebugDrawCursorPos(ImU32 col = IM_COL32(255, 0, 0, 255));
     IMGUI_API void          DebugDrawLineExtents(ImU32 col = IM_COL32(255, 0, 0, 255));
     IMGUI_API void          DebugDrawItemRect(ImU32 col = IM_COL32(255, 0, 0, 255));
@@ -3500,6 +3872,10 @@ namespace ImGui
     IMGUI_API void          DebugNodeWindowsList(ImVector<ImGuiWindow*>* windows, const char* label);
     IMGUI_API void          DebugNodeWindowsListByBeginStackParent(ImGuiWindow** windows, int windows_size, ImGuiWindow* parent_in_begin_stack);
     IMGUI_API void          DebugNodeViewport(ImGuiViewportP* viewport);
+    IMGUI_API void          DebugNodeMemoryReport();
+    IMGUI_API void          DebugNodeGcStats(ImGuiGcStats* stats);
+    IMGUI_API void          DebugNodeDrawStats(ImGuiDrawStats* stats);
+    IMGUI_API void          DebugNodeProfiler(ImGuiProfiler* profiler);
     IMGUI_API void          DebugRenderKeyboardPreview(ImDrawList* draw_list);
     IMGUI_API void          DebugRenderViewportThumbnail(ImDrawList* draw_list, ImGuiViewportP* viewport, const ImRect& bb);
 
@@ -3519,6 +3895,23 @@ namespace ImGui
 
 } // namespace ImGui
 
+// Helper for IMGUI_PROFILER_SCOPE()
+struct ImGuiProfilerScope
+{
+    int ZoneIdx;
+    ImGuiProfilerScope(const char* name, ImGuiID window_id) { ZoneIdx = ImGui::ProfilerBeginZone(name, window_id); }
+    ~ImGuiProfilerScope()                                   { ImGui::ProfilerEndZone(ZoneIdx); }
+};
+
+// Helper for IMGUI_DEBUG_ALLOC_OWNER_SCOPE()
+struct ImGuiDebugAllocOwnerScope
+{
+    ImGuiContext*           Ctx;
+    ImGuiDebugAllocOwner    BackupOwner;
+    ImGuiDebugAllocOwnerScope(ImGuiDebugAllocOwner owner)   { Ctx = GImGui; BackupOwner = ImGuiDebugAllocOwner_None; if (Ctx) { BackupOwner = Ctx->DebugAllocInfo.OwnerOverride; Ctx->DebugAllocInfo.OwnerOverride = owner; } }
+    ~ImGuiDebugAllocOwnerScope()                            { if (Ctx) Ctx->DebugAllocInfo.OwnerOverride = BackupOwner; }
+};
+
 
 //-----------------------------------------------------------------------------
 // [SECTION] ImFontAtlas internal API
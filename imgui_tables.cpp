@@ -260,6 +260,7 @@ static const int TABLE_DRAW_CHANNEL_NOCLIP = 2;                     // When usin
 static const float TABLE_BORDER_SIZE                     = 1.0f;    // FIXME-TABLE: Currently hard-coded because of clipping assumptions with outer borders rendering.
 static const float TABLE_RESIZE_SEPARATOR_HALF_THICKNESS = 4.0f;    // Extend outside inner borders.
 static const float TABLE_RESIZE_SEPARATOR_FEEDBACK_TIMER = 0.06f;   // Delay/timer before making the hover feedback (color+cursor) visible because tables/columns tends to be more cramped.
+IM_STATIC_ASSERT(IMGUI_TABLE_MAX_COLUMNS <= 32000);                 // Worst case draw channels count (4 + columns * 2) must fit in ImGuiTableDrawChannelIdx.
 
 // Helper
 inline ImGuiTableFlags TableFixFlags(ImGuiTableFlags flags, ImGuiWindow* outer_window)
@@ -314,6 +315,7 @@ bool    ImGui::BeginTableEx(const char* name, ImGuiID id, int columns_count, ImG
     ImGuiWindow* outer_window = GetCurrentWindow();
     if (outer_window->SkipItems) // Consistent with other tables + beneficial side effect that assert on miscalling EndTable() will be more visible.
         return false;
+    IMGUI_DEBUG_ALLOC_OWNER_SCOPE(ImGuiDebugAllocOwner_Table);
 
     // Sanity checks
     IM_ASSERT(columns_count > 0 && columns_count < IMGUI_TABLE_MAX_COLUMNS);
@@ -352,6 +354,7 @@ bool    ImGui::BeginTableEx(const char* name, ImGuiID id, int columns_count, ImG
         g.TablesTempData.resize(g.TablesTempDataStacked, ImGuiTableTempData());
     ImGuiTableTempData* temp_data = table->TempData = &g.TablesTempData[g.TablesTempDataStacked - 1];
     temp_data->TableIndex = table_idx;
+    temp_data->ProfilerZoneIdx = IMGUI_PROFILER_BEGIN("Table", outer_window->ID);
     table->DrawSplitter = &table->TempData->DrawSplitter;
     table->DrawSplitter->Clear();
 
@@ -542,6 +545,7 @@ bool    ImGui::BeginTableEx(const char* name, ImGuiID id, int columns_count, ImG
         g.TablesLastTimeActive.resize(table_idx + 1, -1.0f);
     g.TablesLastTimeActive[table_idx] = (float)g.Time;
     temp_data->LastTimeActive = (float)g.Time;
+    temp_data->LastFrameActive = g.FrameCount;
     table->MemoryCompacted = false;
 
     // Setup memory buffer (clear data if columns count changed)
@@ -790,6 +794,7 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
 {
     ImGuiContext& g = *GImGui;
     IM_ASSERT(table->IsLayoutLocked == false);
+    IMGUI_PROFILER_SCOPE("TableUpdateLayout", table->OuterWindow->ID);
 
     const ImGuiTableFlags table_sizing_policy = (table->Flags & ImGuiTableFlags_SizingMask_);
     table->IsDefaultDisplayOrder = true;
@@ -867,7 +872,8 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
 
         // Calculate ideal/auto column width (that's the width required for all contents to be visible without clipping)
         // Combine width from regular rows + width from headers unless requested not to.
-        if (!column->IsPreserveWidthAuto && table->InstanceCurrent == 0)
+        // Columns which were clipped and didn't request output last frame haven't submitted contents: keep their last known width.
+        if (!column->IsPreserveWidthAuto && table->InstanceCurrent == 0 && column->IsRequestOutput)
             column->WidthAuto = TableGetColumnWidthAuto(table, column);
 
         // Non-resizable columns keep their requested width (apply user value regardless of IsPreserveWidthAuto)
@@ -1034,6 +1040,7 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
     // [Part 6] Setup final position, offset, skip/clip states and clipping rectangles, detect hovered column
     // Process columns in their visible orders as we are comparing the visible order and adjusting host_clip_rect while looping.
     int visible_n = 0;
+    int visible_count = 0;
     bool has_at_least_one_column_requesting_output = false;
     bool offset_x_frozen = (table->FreezeColumnsCount > 0);
     float offset_x = ((table->FreezeColumnsCount > 0) ? table->OuterRect.Min.x : work_rect.Min.x) + table->OuterPaddingX - table->CellSpacingX1;
@@ -1106,7 +1113,10 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
         column->IsVisibleY = true; // (column->ClipRect.Max.y > column->ClipRect.Min.y);
         const bool is_visible = column->IsVisibleX; //&& column->IsVisibleY;
         if (is_visible)
+        {
             ImBitArraySetBit(table->VisibleMaskByIndex, column_n);
+            visible_count++;
+        }
 
         // Mark column as requesting output from user. Note that fixed + non-resizable sets are auto-fitting at all times and therefore always request output.
         column->IsRequestOutput = is_visible || column->AutoFitQueue != 0 || column->CannotSkipItemsQueue != 0;
@@ -1173,6 +1183,7 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
         offset_x += column->WidthGiven + table->CellSpacingX1 + table->CellSpacingX2 + table->CellPaddingX * 2.0f;
         visible_n++;
     }
+    table->ColumnsVisibleCount = (ImGuiTableColumnIdx)visible_count;
 
     // In case the table is visible (e.g. decorations) but all columns clipped, we keep a column visible.
     // Else if give no chance to a clipper-savy user to submit rows and therefore total contents height used by scrollbar.
@@ -1423,7 +1434,7 @@ void    ImGui::EndTable()
         if (IM_BITARRAY_TESTBIT(table->EnabledMaskByIndex, column_n))
         {
             ImGuiTableColumn* column = &table->Columns[column_n];
-            float column_width_request = ((column->Flags & ImGuiTableColumnFlags_WidthFixed) && !(column->Flags & ImGuiTableColumnFlags_NoResize)) ? column->WidthRequest : TableGetColumnWidthAuto(table, column);
+            float column_width_request = ((column->Flags & ImGuiTableColumnFlags_WidthFixed) && !(column->Flags & ImGuiTableColumnFlags_NoResize)) ? column->WidthRequest : column->IsRequestOutput ? TableGetColumnWidthAuto(table, column) : column->WidthAuto;
             if (column->Flags & ImGuiTableColumnFlags_WidthFixed)
                 auto_fit_width_for_fixed += column_width_request;
             else
@@ -1535,6 +1546,9 @@ void    ImGui::EndTable()
         TableSaveSettings(table);
     table->IsInitializing = false;
 
+    // [DEBUG] Profiler: end "Table" zone
+    IMGUI_PROFILER_END(temp_data->ProfilerZoneIdx);
+
     // Clear or restore current table, if any
     IM_ASSERT(g.CurrentWindow == outer_window && g.CurrentTable == table);
     IM_ASSERT(g.TablesTempDataStacked > 0);
@@ -1619,7 +1633,7 @@ void ImGui::TableSetupColumn(const char* label, ImGuiTableColumnFlags flags, flo
     column->NameOffset = -1;
     if (label != NULL && label[0] != 0)
     {
-        column->NameOffset = (ImS16)table->ColumnsNames.size();
+        column->NameOffset = table->ColumnsNames.size();
         table->ColumnsNames.append(label, label + strlen(label) + 1);
     }
 }
@@ -2441,18 +2455,20 @@ void ImGui::TablePopBackgroundChannel()
 //   channels, while simplifying per-row/per-cell overhead. It will be empty and discarded when merged.
 // - We allocate 1 or 2 background draw channels. This is because we know TablePushBackgroundChannel() is only used for
 //   horizontal spanning. If we allowed vertical spanning we'd need one background draw channel per merge group (1-4).
+// - We only allocate channels for visible columns: clipped columns (e.g. scrolled out of view in a table with thousands
+//   of columns) all share the dummy channel, so the cost of Split()/Merge() is bound by what is visible.
 // Draw channel allocation (before merging):
 // - NoClip                       --> 2+D+1 channels: bg0/1 + bg2 + foreground (same clip rect == always 1 draw call)
 // - Clip                         --> 2+D+N channels
 // - FreezeRows                   --> 2+D+N*2 (unless scrolling value is zero)
 // - FreezeRows || FreezeColunns  --> 3+D+N*2 (unless scrolling value is zero)
-// Where D is 1 if any column is clipped or hidden (dummy channel) otherwise 0.
+// Where N is the number of visible columns and D is 1 if any column is clipped or hidden (dummy channel) otherwise 0.
 void ImGui::TableSetupDrawChannels(ImGuiTable* table)
 {
     const int freeze_row_multiplier = (table->FreezeRowsCount > 0) ? 2 : 1;
-    const int channels_for_row = (table->Flags & ImGuiTableFlags_NoClip) ? 1 : table->ColumnsEnabledCount;
+    const int channels_for_row = (table->Flags & ImGuiTableFlags_NoClip) ? 1 : table->ColumnsVisibleCount;
     const int channels_for_bg = 1 + 1 * freeze_row_multiplier;
-    const int channels_for_dummy = (table->ColumnsEnabledCount < table->ColumnsCount || (memcmp(table->VisibleMaskByIndex, table->EnabledMaskByIndex, ImBitArrayGetStorageSizeInBytes(table->ColumnsCount)) != 0)) ? +1 : 0;
+    const int channels_for_dummy = (table->ColumnsVisibleCount < table->ColumnsCount) ? +1 : 0; // VisibleMaskByIndex is a subset of EnabledMaskByIndex
     const int channels_total = channels_for_bg + (channels_for_row * freeze_row_multiplier) + channels_for_dummy;
     table->DrawSplitter->Split(table->InnerWindow->DrawList, channels_total);
     table->DummyDrawChannel = (ImGuiTableDrawChannelIdx)((channels_for_dummy > 0) ? channels_total - 1 : -1);
@@ -2503,8 +2519,9 @@ void ImGui::TableSetupDrawChannels(ImGuiTable* table)
 // When the contents of a column didn't stray off its limit, we move its channels into the corresponding group
 // based on its position (within frozen rows/columns groups or not).
 // At the end of the operation our 1-4 groups will each have a ImDrawCmd using the same ClipRect.
-// This function assume that each column are pointing to a distinct draw channel,
-// otherwise merge_group->ChannelsCount will not match set bit count of merge_group->ChannelsMask.
+// This function assume that each column are pointing to a distinct draw channel.
+// The resulting channel order only depends on which group each channel goes to, so it is cached in the table
+// and reused on the next frame if unchanged (which is the common case).
 //
 // Column channels will not be merged into one of the 1-4 groups in the following cases:
 // - The contents stray off its clipping rectangle (we only compare the MaxX value, not the MinX value).
@@ -2528,23 +2545,28 @@ void ImGui::TableMergeDrawChannels(ImGuiTable* table)
     {
         ImRect          ClipRect;
         int             ChannelsCount = 0;
-        ImBitArrayPtr   ChannelsMask = NULL;
     };
     int merge_group_mask = 0x00;
     MergeGroup merge_groups[4];
 
-    // Use a reusable temp buffer for the merge masks as they are dynamically sized.
-    const int max_draw_channels = (4 + table->ColumnsCount * 2);
-    const int size_for_masks_bitarrays_one = (int)ImBitArrayGetStorageSizeInBytes(max_draw_channels);
-    g.TempBuffer.reserve(size_for_masks_bitarrays_one * 5);
-    memset(g.TempBuffer.Data, 0, size_for_masks_bitarrays_one * 5);
-    for (int n = 0; n < IM_ARRAYSIZE(merge_groups); n++)
-        merge_groups[n].ChannelsMask = (ImBitArrayPtr)(void*)(g.TempBuffer.Data + (size_for_masks_bitarrays_one * n));
-    ImBitArrayPtr remaining_mask = (ImBitArrayPtr)(void*)(g.TempBuffer.Data + (size_for_masks_bitarrays_one * 4));
+    // Store destination of each channel in a reusable temp buffer: 0-3 = merge group, 4 = Bg2DrawChannelUnfrozen, -1 = not merged.
+    // (sized on actual channels count, which only depends on the number of visible columns)
+    const int max_draw_channels = splitter->_Count;
+    const ImS8 MERGE_KEY_NONE = -1;
+    const ImS8 MERGE_KEY_BG2_UNFROZEN = 4;
+    g.TempBuffer.reserve(max_draw_channels);
+    ImS8* merge_key = (ImS8*)(void*)g.TempBuffer.Data;
+    memset(merge_key, MERGE_KEY_NONE, max_draw_channels);
 
     // 1. Scan channels and take note of those which can be merged
+    // (skip 32 clipped columns at a time: with many columns most of VisibleMaskByIndex is zero)
     for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
     {
+        if (table->VisibleMaskByIndex[column_n >> 5] == 0)
+        {
+            column_n |= 31;
+            continue;
+        }
         if (!IM_BITARRAY_TESTBIT(table->VisibleMaskByIndex, column_n))
             continue;
         ImGuiTableColumn* column = &table->Columns[column_n];
@@ -2577,11 +2599,11 @@ void ImGui::TableMergeDrawChannels(ImGuiTable* table)
             }
 
             const int merge_group_n = (has_freeze_h && column_n < table->FreezeColumnsCount ? 0 : 1) + (has_freeze_v && merge_group_sub_n == 0 ? 0 : 2);
-            IM_ASSERT(channel_no < max_draw_channels);
+            IM_ASSERT(channel_no < max_draw_channels && merge_key[channel_no] == MERGE_KEY_NONE);
             MergeGroup* merge_group = &merge_groups[merge_group_n];
             if (merge_group->ChannelsCount == 0)
                 merge_group->ClipRect = ImRect(+FLT_MAX, +FLT_MAX, -FLT_MAX, -FLT_MAX);
-            ImBitArraySetBit(merge_group->ChannelsMask, channel_no);
+            merge_key[channel_no] = (ImS8)merge_group_n;
             merge_group->ChannelsCount++;
             merge_group->ClipRect.Add(src_channel->_CmdBuffer[0].ClipRect);
             merge_group_mask |= (1 << merge_group_n);
@@ -2610,79 +2632,94 @@ void ImGui::TableMergeDrawChannels(ImGuiTable* table)
         }
 #endif
 
-    // 2. Rewrite channel list in our preferred order
-    if (merge_group_mask != 0)
+    if (merge_group_mask == 0)
+        return;
+
+    // 2. Compute merged clip rectangles
+    ImVec4 merge_clip_rects[4];
+    //ImRect host_rect = (table->InnerWindow == table->OuterWindow) ? table->InnerClipRect : table->HostClipRect;
+    ImRect host_rect = table->HostClipRect;
+    for (int merge_group_n = 0; merge_group_n < IM_ARRAYSIZE(merge_groups); merge_group_n++)
     {
-        // We skip channel 0 (Bg0/Bg1) and 1 (Bg2 frozen) from the shuffling since they won't move - see channels allocation in TableSetupDrawChannels().
-        const int LEADING_DRAW_CHANNELS = 2;
-        g.DrawChannelsTempMergeBuffer.resize(splitter->_Count - LEADING_DRAW_CHANNELS); // Use shared temporary storage so the allocation gets amortized
-        ImDrawChannel* dst_tmp = g.DrawChannelsTempMergeBuffer.Data;
-        ImBitArraySetBitRange(remaining_mask, LEADING_DRAW_CHANNELS, splitter->_Count);
-        ImBitArrayClearBit(remaining_mask, table->Bg2DrawChannelUnfrozen);
-        IM_ASSERT(has_freeze_v == false || table->Bg2DrawChannelUnfrozen != TABLE_DRAW_CHANNEL_BG2_FROZEN);
-        int remaining_count = splitter->_Count - (has_freeze_v ? LEADING_DRAW_CHANNELS + 1 : LEADING_DRAW_CHANNELS);
-        //ImRect host_rect = (table->InnerWindow == table->OuterWindow) ? table->InnerClipRect : table->HostClipRect;
-        ImRect host_rect = table->HostClipRect;
-        for (int merge_group_n = 0; merge_group_n < IM_ARRAYSIZE(merge_groups); merge_group_n++)
-        {
-            if (int merge_channels_count = merge_groups[merge_group_n].ChannelsCount)
-            {
-                MergeGroup* merge_group = &merge_groups[merge_group_n];
-                ImRect merge_clip_rect = merge_group->ClipRect;
-
-                // Extend outer-most clip limits to match those of host, so draw calls can be merged even if
-                // outer-most columns have some outer padding offsetting them from their parent ClipRect.
-                // The principal cases this is dealing with are:
-                // - On a same-window table (not scrolling = single group), all fitting columns ClipRect -> will extend and match host ClipRect -> will merge
-                // - Columns can use padding and have left-most ClipRect.Min.x and right-most ClipRect.Max.x != from host ClipRect -> will extend and match host ClipRect -> will merge
-                // FIXME-TABLE FIXME-WORKRECT: We are wasting a merge opportunity on tables without scrolling if column doesn't fit
-                // within host clip rect, solely because of the half-padding difference between window->WorkRect and window->InnerClipRect.
-                if ((merge_group_n & 1) == 0 || !has_freeze_h)
-                    merge_clip_rect.Min.x = ImMin(merge_clip_rect.Min.x, host_rect.Min.x);
-                if ((merge_group_n & 2) == 0 || !has_freeze_v)
-                    merge_clip_rect.Min.y = ImMin(merge_clip_rect.Min.y, host_rect.Min.y);
-                if ((merge_group_n & 1) != 0)
-                    merge_clip_rect.Max.x = ImMax(merge_clip_rect.Max.x, host_rect.Max.x);
-                if ((merge_group_n & 2) != 0 && (table->Flags & ImGuiTableFlags_NoHostExtendY) == 0)
-                    merge_clip_rect.Max.y = ImMax(merge_clip_rect.Max.y, host_rect.Max.y);
-                //GetForegroundDrawList()->AddRect(merge_group->ClipRect.Min, merge_group->ClipRect.Max, IM_COL32(255, 0, 0, 200), 0.0f, 0, 1.0f); // [DEBUG]
-                //GetForegroundDrawList()->AddLine(merge_group->ClipRect.Min, merge_clip_rect.Min, IM_COL32(255, 100, 0, 200));
-                //GetForegroundDrawList()->AddLine(merge_group->ClipRect.Max, merge_clip_rect.Max, IM_COL32(255, 100, 0, 200));
-                remaining_count -= merge_group->ChannelsCount;
-                for (int n = 0; n < (size_for_masks_bitarrays_one >> 2); n++)
-                    remaining_mask[n] &= ~merge_group->ChannelsMask[n];
-                for (int n = 0; n < splitter->_Count && merge_channels_count != 0; n++)
-                {
-                    // Copy + overwrite new clip rect
-                    if (!IM_BITARRAY_TESTBIT(merge_group->ChannelsMask, n))
-                        continue;
-                    IM_BITARRAY_CLEARBIT(merge_group->ChannelsMask, n);
-                    merge_channels_count--;
-
-                    ImDrawChannel* channel = &splitter->_Channels[n];
-                    IM_ASSERT(channel->_CmdBuffer.Size == 1 && merge_clip_rect.Contains(ImRect(channel->_CmdBuffer[0].ClipRect)));
-                    channel->_CmdBuffer[0].ClipRect = merge_clip_rect.ToVec4();
-                    memcpy(dst_tmp++, channel, sizeof(ImDrawChannel));
-                }
-            }
+        MergeGroup* merge_group = &merge_groups[merge_group_n];
+        if (merge_group->ChannelsCount == 0)
+            continue;
+        ImRect merge_clip_rect = merge_group->ClipRect;
+
+        // Extend outer-most clip limits to match those of host, so draw calls can be merged even if
+        // outer-most columns have some outer padding offsetting them from their parent ClipRect.
+        // The principal cases this is dealing with are:
+        // - On a same-window table (not scrolling = single group), all fitting columns ClipRect -> will extend and match host ClipRect -> will merge
+        // - Columns can use padding and have left-most ClipRect.Min.x and right-most ClipRect.Max.x != from host ClipRect -> will extend and match host ClipRect -> will merge
+        // FIXME-TABLE FIXME-WORKRECT: We are wasting a merge opportunity on tables without scrolling if column doesn't fit
+        // within host clip rect, solely because of the half-padding difference between window->WorkRect and window->InnerClipRect.
+        if ((merge_group_n & 1) == 0 || !has_freeze_h)
+            merge_clip_rect.Min.x = ImMin(merge_clip_rect.Min.x, host_rect.Min.x);
+        if ((merge_group_n & 2) == 0 || !has_freeze_v)
+            merge_clip_rect.Min.y = ImMin(merge_clip_rect.Min.y, host_rect.Min.y);
+        if ((merge_group_n & 1) != 0)
+            merge_clip_rect.Max.x = ImMax(merge_clip_rect.Max.x, host_rect.Max.x);
+        if ((merge_group_n & 2) != 0 && (table->Flags & ImGuiTableFlags_NoHostExtendY) == 0)
+            merge_clip_rect.Max.y = ImMax(merge_clip_rect.Max.y, host_rect.Max.y);
+        //GetForegroundDrawList()->AddRect(merge_group->ClipRect.Min, merge_group->ClipRect.Max, IM_COL32(255, 0, 0, 200), 0.0f, 0, 1.0f); // [DEBUG]
+        //GetForegroundDrawList()->AddLine(merge_group->ClipRect.Min, merge_clip_rect.Min, IM_COL32(255, 100, 0, 200));
+        //GetForegroundDrawList()->AddLine(merge_group->ClipRect.Max, merge_clip_rect.Max, IM_COL32(255, 100, 0, 200));
+        merge_clip_rects[merge_group_n] = merge_clip_rect.ToVec4();
+    }
 
-            // Make sure Bg2DrawChannelUnfrozen appears in the middle of our groups (whereas Bg0/Bg1 and Bg2 frozen are fixed to 0 and 1)
-            if (merge_group_n == 1 && has_freeze_v)
-                memcpy(dst_tmp++, &splitter->_Channels[table->Bg2DrawChannelUnfrozen], sizeof(ImDrawChannel));
+    // 3. Rewrite channel list in our preferred order, overwriting clip rect of merged channels.
+    // We skip channel 0 (Bg0/Bg1) and 1 (Bg2 frozen) from the shuffling since they won't move - see channels allocation in TableSetupDrawChannels().
+    // Make sure Bg2DrawChannelUnfrozen appears in the middle of our groups (whereas Bg0/Bg1 and Bg2 frozen are fixed to 0 and 1)
+    // Order is: [Group 0] [Group 1] [Bg2 Unfrozen] [Group 2] [Group 3] [Unmerged channels]
+    // This is a counting sort on channel destination: bucket_offsets[bucket_n] .. bucket_offsets[bucket_n + 1] is the range of each bucket.
+    const int LEADING_DRAW_CHANNELS = 2;
+    IM_ASSERT(has_freeze_v == false || table->Bg2DrawChannelUnfrozen != TABLE_DRAW_CHANNEL_BG2_FROZEN);
+    if (has_freeze_v)
+        merge_key[table->Bg2DrawChannelUnfrozen] = MERGE_KEY_BG2_UNFROZEN;
+    static const int key_to_bucket[6] = { 5, 0, 1, 3, 4, 2 }; // Indexed by merge_key + 1
+    int bucket_offsets[6 + 1] = {};
+    for (int n = LEADING_DRAW_CHANNELS; n < max_draw_channels; n++)
+        bucket_offsets[key_to_bucket[merge_key[n] + 1] + 1]++;
+    for (int bucket_n = 0; bucket_n < 6; bucket_n++)
+        bucket_offsets[bucket_n + 1] += bucket_offsets[bucket_n];
+    int bucket_write_offsets[6];
+    memcpy(bucket_write_offsets, bucket_offsets, sizeof(bucket_write_offsets));
+
+    g.DrawChannelsTempMergeBuffer.resize(max_draw_channels - LEADING_DRAW_CHANNELS); // Use shared temporary storage so the allocation gets amortized
+    ImDrawChannel* dst_tmp = g.DrawChannelsTempMergeBuffer.Data;
+    for (int n = LEADING_DRAW_CHANNELS; n < max_draw_channels; n++)
+    {
+        ImDrawChannel* channel = &splitter->_Channels[n];
+        const int merge_group_n = merge_key[n];
+        if (merge_group_n >= 0 && merge_group_n < IM_ARRAYSIZE(merge_groups))
+        {
+            IM_ASSERT(channel->_CmdBuffer.Size == 1 && ImRect(merge_clip_rects[merge_group_n]).Contains(ImRect(channel->_CmdBuffer[0].ClipRect)));
+            channel->_CmdBuffer[0].ClipRect = merge_clip_rects[merge_group_n];
         }
+        memcpy(&dst_tmp[bucket_write_offsets[key_to_bucket[merge_group_n + 1]]++], channel, sizeof(ImDrawChannel));
+    }
 
-        // Append unmergeable channels that we didn't reorder at the end of the list
-        for (int n = 0; n < splitter->_Count && remaining_count != 0; n++)
+    // 4. Consecutive channels of a same group are merged right away into the first draw command of the group,
+    // sparing the per-channel header compare/erase that DrawSplitter.Merge() would otherwise do.
+    for (int merge_group_n = 0; merge_group_n < IM_ARRAYSIZE(merge_groups); merge_group_n++)
+    {
+        const int bucket_n = key_to_bucket[merge_group_n + 1];
+        ImDrawCmd* merge_cmd = NULL;
+        for (int dst_n = bucket_offsets[bucket_n]; dst_n < bucket_offsets[bucket_n + 1]; dst_n++)
         {
-            if (!IM_BITARRAY_TESTBIT(remaining_mask, n))
-                continue;
-            ImDrawChannel* channel = &splitter->_Channels[n];
-            memcpy(dst_tmp++, channel, sizeof(ImDrawChannel));
-            remaining_count--;
+            ImDrawCmd* cmd = &dst_tmp[dst_n]._CmdBuffer.Data[0];
+            if (merge_cmd != NULL && cmd->TextureId == merge_cmd->TextureId && cmd->VtxOffset == merge_cmd->VtxOffset && cmd->UserCallback == NULL)
+            {
+                merge_cmd->ElemCount += cmd->ElemCount;
+                dst_tmp[dst_n]._CmdBuffer.resize(0);
+            }
+            else
+            {
+                merge_cmd = (cmd->UserCallback == NULL) ? cmd : NULL;
+            }
         }
-        IM_ASSERT(dst_tmp == g.DrawChannelsTempMergeBuffer.Data + g.DrawChannelsTempMergeBuffer.Size);
-        memcpy(splitter->_Channels.Data + LEADING_DRAW_CHANNELS, g.DrawChannelsTempMergeBuffer.Data, (splitter->_Count - LEADING_DRAW_CHANNELS) * sizeof(ImDrawChannel));
     }
+    memcpy(splitter->_Channels.Data + LEADING_DRAW_CHANNELS, g.DrawChannelsTempMergeBuffer.Data, (max_draw_channels - LEADING_DRAW_CHANNELS) * sizeof(ImDrawChannel));
 }
 
 static ImU32 TableGetColumnBorderCol(ImGuiTable* table, int order_n, int column_n)
@@ -2883,11 +2920,18 @@ void ImGui::TableSetColumnSortDirection(int column_n, ImGuiSortDirection sort_di
 
 void ImGui::TableSortSpecsSanitize(ImGuiTable* table)
 {
+    ImGuiContext& g = *GImGui;
     IM_ASSERT(table->Flags & ImGuiTableFlags_Sortable);
 
     // Clear SortOrder from hidden column and verify that there's no gap or duplicate.
+    // (Same as display order validation: SortOrder values must be a permutation of 0..sort_order_count-1.
+    // They may come from .ini data or from multiple columns using _DefaultSort, so we can't assert on them.)
+    // Use g.TempBuffer as scratch, it only grows so this doesn't allocate every frame.
+    g.TempBuffer.reserve_discard(table->ColumnsCount * (int)sizeof(ImU32));
+    ImU32* sort_scratch = (ImU32*)(void*)g.TempBuffer.Data;
+    memset(sort_scratch, 0xFF, (size_t)table->ColumnsCount * sizeof(ImU32));
     int sort_order_count = 0;
-    ImU64 sort_order_mask = 0x00;
+    bool need_fix_linearize = false;
     for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
     {
         ImGuiTableColumn* column = &table->Columns[column_n];
@@ -2896,38 +2940,41 @@ void ImGui::TableSortSpecsSanitize(ImGuiTable* table)
         if (column->SortOrder == -1)
             continue;
         sort_order_count++;
-        sort_order_mask |= ((ImU64)1 << column->SortOrder);
-        IM_ASSERT(sort_order_count < (int)sizeof(sort_order_mask) * 8);
+        const int sort_order = column->SortOrder;
+        if (sort_order < 0 || sort_order >= table->ColumnsCount || sort_scratch[sort_order] != (ImU32)-1)
+            need_fix_linearize = true;
+        else
+            sort_scratch[sort_order] = (ImU32)column_n;
     }
+    for (int sort_n = 0; sort_n < sort_order_count && !need_fix_linearize; sort_n++)
+        if (sort_scratch[sort_n] == (ImU32)-1)
+            need_fix_linearize = true;
 
-    const bool need_fix_linearize = ((ImU64)1 << sort_order_count) != (sort_order_mask + 1);
     const bool need_fix_single_sort_order = (sort_order_count > 1) && !(table->Flags & ImGuiTableFlags_SortMulti);
     if (need_fix_linearize || need_fix_single_sort_order)
     {
-        ImU64 fixed_mask = 0x00;
-        for (int sort_n = 0; sort_n < sort_order_count; sort_n++)
+        // Gather sorted columns ordered by SortOrder (ties resolved by column index, invalid values last).
+        // Keys are (SortOrder << 16) | column_n, column indices fit in 16-bit as IMGUI_TABLE_MAX_COLUMNS <= 32000.
+        struct Func { static int IMGUI_CDECL CompareKeys(const void* lhs, const void* rhs) { const ImU32 a = *(const ImU32*)lhs, b = *(const ImU32*)rhs; return (a < b) ? -1 : (a > b) ? +1 : 0; } };
+        int sort_keys_count = 0;
+        for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
+            if (table->Columns[column_n].SortOrder != -1)
+                sort_scratch[sort_keys_count++] = ((ImU32)(ImU16)table->Columns[column_n].SortOrder << 16) | (ImU32)column_n;
+        IM_ASSERT(sort_keys_count == sort_order_count);
+        ImQsort(sort_scratch, (size_t)sort_keys_count, sizeof(ImU32), Func::CompareKeys);
+
+        // Fix: Make sure only one column has a SortOrder if ImGuiTableFlags_MultiSortable is not set.
+        if (need_fix_single_sort_order)
         {
-            // Fix: Rewrite sort order fields if needed so they have no gap or duplicate.
-            // (e.g. SortOrder 0 disappeared, SortOrder 1..2 exists --> rewrite then as SortOrder 0..1)
-            int column_with_smallest_sort_order = -1;
-            for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
-                if ((fixed_mask & ((ImU64)1 << (ImU64)column_n)) == 0 && table->Columns[column_n].SortOrder != -1)
-                    if (column_with_smallest_sort_order == -1 || table->Columns[column_n].SortOrder < table->Columns[column_with_smallest_sort_order].SortOrder)
-                        column_with_smallest_sort_order = column_n;
-            IM_ASSERT(column_with_smallest_sort_order != -1);
-            fixed_mask |= ((ImU64)1 << column_with_smallest_sort_order);
-            table->Columns[column_with_smallest_sort_order].SortOrder = (ImGuiTableColumnIdx)sort_n;
-
-            // Fix: Make sure only one column has a SortOrder if ImGuiTableFlags_MultiSortable is not set.
-            if (need_fix_single_sort_order)
-            {
-                sort_order_count = 1;
-                for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
-                    if (column_n != column_with_smallest_sort_order)
-                        table->Columns[column_n].SortOrder = -1;
-                break;
-            }
+            for (int sort_n = 1; sort_n < sort_order_count; sort_n++)
+                table->Columns[sort_scratch[sort_n] & 0xFFFF].SortOrder = -1;
+            sort_order_count = 1;
         }
+
+        // Fix: Rewrite sort order fields if needed so they have no gap or duplicate.
+        // (e.g. SortOrder 0 disappeared, SortOrder 1..2 exists --> rewrite then as SortOrder 0..1)
+        for (int sort_n = 0; sort_n < sort_order_count; sort_n++)
+            table->Columns[sort_scratch[sort_n] & 0xFFFF].SortOrder = (ImGuiTableColumnIdx)sort_n;
     }
 
     // Fallback default sort order (if no column with the ImGuiTableColumnFlags_DefaultSort flag)
@@ -3559,6 +3606,7 @@ static size_t TableSettingsCalcChunkSize(int columns_count)
 ImGuiTableSettings* ImGui::TableSettingsCreate(ImGuiID id, int columns_count)
 {
     ImGuiContext& g = *GImGui;
+    IMGUI_DEBUG_ALLOC_OWNER_SCOPE(ImGuiDebugAllocOwner_Settings);
     ImGuiTableSettings* settings = g.SettingsTables.alloc_chunk(TableSettingsCalcChunkSize(columns_count));
     TableSettingsInit(settings, id, columns_count, columns_count);
     return settings;
@@ -3650,6 +3698,7 @@ void ImGui::TableSaveSettings(ImGuiTable* table)
     }
     settings->SaveFlags &= table->Flags;
     settings->RefScale = save_ref_scale ? table->RefScale : 0.0f;
+    settings->IniTextSize = 0; // Format this entry again on next save
 
     MarkIniSettingsDirty();
 }
@@ -3682,7 +3731,6 @@ void ImGui::TableLoadSettings(ImGuiTable* table)
 
     // Serialize ImGuiTableSettings/ImGuiTableColumnSettings into ImGuiTable/ImGuiTableColumn
     ImGuiTableColumnSettings* column_settings = settings->GetColumnSettings();
-    ImU64 display_order_mask = 0;
     for (int data_n = 0; data_n < settings->ColumnsCount; data_n++, column_settings++)
     {
         int column_n = column_settings->Index;
@@ -3702,21 +3750,27 @@ void ImGui::TableLoadSettings(ImGuiTable* table)
             column->DisplayOrder = column_settings->DisplayOrder;
         else
             column->DisplayOrder = (ImGuiTableColumnIdx)column_n;
-        display_order_mask |= (ImU64)1 << column->DisplayOrder;
         column->IsUserEnabled = column->IsUserEnabledNextFrame = column_settings->IsEnabled;
         column->SortOrder = column_settings->SortOrder;
         column->SortDirection = column_settings->SortDirection;
     }
 
-    // Validate and fix invalid display order data
-    const ImU64 expected_display_order_mask = (settings->ColumnsCount == 64) ? ~0 : ((ImU64)1 << settings->ColumnsCount) - 1;
-    if (display_order_mask != expected_display_order_mask)
+    // Rebuild index, validating that display orders are a permutation (no duplicate, no out of range value).
+    // Fix invalid display order data by resetting to default order.
+    bool display_order_valid = true;
+    for (int order_n = 0; order_n < table->ColumnsCount; order_n++)
+        table->DisplayOrderToIndex[order_n] = -1;
+    for (int column_n = 0; column_n < table->ColumnsCount && display_order_valid; column_n++)
+    {
+        const int order_n = table->Columns[column_n].DisplayOrder;
+        if (order_n < 0 || order_n >= table->ColumnsCount || table->DisplayOrderToIndex[order_n] != -1)
+            display_order_valid = false;
+        else
+            table->DisplayOrderToIndex[order_n] = (ImGuiTableColumnIdx)column_n;
+    }
+    if (!display_order_valid)
         for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
-            table->Columns[column_n].DisplayOrder = (ImGuiTableColumnIdx)column_n;
-
-    // Rebuild index
-    for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
-        table->DisplayOrderToIndex[table->Columns[column_n].DisplayOrder] = (ImGuiTableColumnIdx)column_n;
+            table->DisplayOrderToIndex[column_n] = table->Columns[column_n].DisplayOrder = (ImGuiTableColumnIdx)column_n;
 }
 
 static void TableSettingsHandler_ClearAll(ImGuiContext* ctx, ImGuiSettingsHandler*)
@@ -3746,6 +3800,8 @@ static void* TableSettingsHandler_ReadOpen(ImGuiContext*, ImGuiSettingsHandler*,
     int columns_count = 0;
     if (sscanf(name, "0x%08X,%d", &id, &columns_count) < 2)
         return NULL;
+    if (columns_count <= 0 || columns_count >= IMGUI_TABLE_MAX_COLUMNS)
+        return NULL;
 
     if (ImGuiTableSettings* settings = ImGui::TableSettingsFindByID(id))
     {
@@ -3787,10 +3843,19 @@ static void TableSettingsHandler_ReadLine(ImGuiContext*, ImGuiSettingsHandler*,
 
 static void TableSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImGuiTextBuffer* buf)
 {
+    // Copy text of entries which didn't change since last save (TableSaveSettings() clears settings->IniTextSize)
     ImGuiContext& g = *ctx;
+    ImGuiSettingsWriteCache* cache = &g.SettingsTablesWriteCache;
+    cache->Begin();
+    cache->Curr.reserve(cache->Prev.size() + 1);
     for (ImGuiTableSettings* settings = g.SettingsTables.begin(); settings != NULL; settings = g.SettingsTables.next_chunk(settings))
     {
         if (settings->ID == 0) // Skip ditched settings
+        {
+            settings->IniTextSize = 0;
+            continue;
+        }
+        if (cache->CopyEntry(&settings->IniTextOffset, &settings->IniTextSize))
             continue;
 
         // TableSaveSettings() may clear some of those flags when we establish that the data can be stripped
@@ -3802,10 +3867,12 @@ static void TableSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandle
         if (!save_size && !save_visible && !save_order && !save_sort)
             continue;
 
-        buf->reserve(buf->size() + 30 + settings->ColumnsCount * 50); // ballpark reserve
-        buf->appendf("[%s][0x%08X,%d]\n", handler->TypeName, settings->ID, settings->ColumnsCount);
+        ImGuiTextBuffer* out = &cache->Curr;
+        const int entry_offset = out->size();
+        out->reserve(out->size() + 30 + settings->ColumnsCount * 50); // ballpark reserve
+        out->appendf("[%s][0x%08X,%d]\n", handler->TypeName, settings->ID, settings->ColumnsCount);
         if (settings->RefScale != 0.0f)
-            buf->appendf("RefScale=%g\n", settings->RefScale);
+            out->appendf("RefScale=%g\n", settings->RefScale);
         ImGuiTableColumnSettings* column = settings->GetColumnSettings();
         for (int column_n = 0; column_n < settings->ColumnsCount; column_n++, column++)
         {
@@ -3813,17 +3880,20 @@ static void TableSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandle
             bool save_column = column->UserID != 0 || save_size || save_visible || save_order || (save_sort && column->SortOrder != -1);
             if (!save_column)
                 continue;
-            buf->appendf("Column %-2d", column_n);
-            if (column->UserID != 0)                    { buf->appendf(" UserID=%08X", column->UserID); }
-            if (save_size && column->IsStretch)         { buf->appendf(" Weight=%.4f", column->WidthOrWeight); }
-            if (save_size && !column->IsStretch)        { buf->appendf(" Width=%d", (int)column->WidthOrWeight); }
-            if (save_visible)                           { buf->appendf(" Visible=%d", column->IsEnabled); }
-            if (save_order)                             { buf->appendf(" Order=%d", column->DisplayOrder); }
-            if (save_sort && column->SortOrder != -1)   { buf->appendf(" Sort=%d%c", column->SortOrder, (column->SortDirection == ImGuiSortDirection_Ascending) ? 'v' : '^'); }
-            buf->append("\n");
+            out->appendf("Column %-2d", column_n);
+            if (column->UserID != 0)                    { out->appendf(" UserID=%08X", column->UserID); }
+            if (save_size && column->IsStretch)         { out->appendf(" Weight=%.4f", column->WidthOrWeight); }
+            if (save_size && !column->IsStretch)        { out->appendf(" Width=%d", (int)column->WidthOrWeight); }
+            if (save_visible)                           { out->appendf(" Visible=%d", column->IsEnabled); }
+            if (save_order)                             { out->appendf(" Order=%d", column->DisplayOrder); }
+            if (save_sort && column->SortOrder != -1)   { out->appendf(" Sort=%d%c", column->SortOrder, (column->SortDirection == ImGuiSortDirection_Ascending) ? 'v' : '^'); }
+            out->append("\n");
         }
-        buf->append("\n");
+        out->append("\n");
+        cache->EndEntry(entry_offset, &settings->IniTextOffset, &settings->IniTextSize);
     }
+    if (!cache->Curr.empty())
+        buf->append(cache->Curr.begin(), cache->Curr.end());
 }
 
 void ImGui::TableSettingsAddSettingsHandler()
@@ -3845,6 +3915,7 @@ void ImGui::TableSettingsAddSettingsHandler()
 // - TableRemove() [Internal]
 // - TableGcCompactTransientBuffers() [Internal]
 // - TableGcCompactSettings() [Internal]
+// - TableGcCalcTransientBytes() [Internal]
 //-------------------------------------------------------------------------
 
 // Remove Table (currently only used by TestEngine)
@@ -3873,6 +3944,7 @@ void ImGui::TableGcCompactTransientBuffers(ImGuiTable* table)
     for (int n = 0; n < table->ColumnsCount; n++)
         table->Columns[n].NameOffset = -1;
     g.TablesLastTimeActive[g.Tables.GetIndex(table)] = -1.0f;
+    g.GcStats.TablesCompactedCount++;
 }
 
 void ImGui::TableGcCompactTransientBuffers(ImGuiTableTempData* temp_data)
@@ -3899,6 +3971,24 @@ void ImGui::TableGcCompactSettings()
     g.SettingsTables.swap(new_chunk_stream);
 }
 
+// Bytes freed by TableGcCompactTransientBuffers()
+size_t ImGui::TableGcCalcTransientBytes(ImGuiTable* table)
+{
+    size_t bytes = (size_t)table->ColumnsNames.Buf.Capacity;
+    bytes += (size_t)table->SortSpecsMulti.Capacity * sizeof(ImGuiTableColumnSortSpecs);
+    return bytes;
+}
+
+size_t ImGui::TableGcCalcTransientBytes(ImGuiTableTempData* temp_data)
+{
+    const ImDrawListSplitter* splitter = &temp_data->DrawSplitter;
+    size_t bytes = (size_t)splitter->_Channels.Capacity * sizeof(ImDrawChannel);
+    for (int n = 0; n < splitter->_Channels.Size; n++)
+        if (n != splitter->_Current) // Current channel is a copy of the draw list buffers
+            bytes += (size_t)splitter->_Channels[n]._CmdBuffer.Capacity * sizeof(ImDrawCmd) + (size_t)splitter->_Channels[n]._IdxBuffer.Capacity * sizeof(ImDrawIdx);
+    return bytes;
+}
+
 
 //-------------------------------------------------------------------------
 // [SECTION] Tables: Debugging
@@ -3944,6 +4034,7 @@ void ImGui::DebugNodeTable(ImGuiTable* table)
     BulletText("OuterRect: Pos: (%.1f,%.1f) Size: (%.1f,%.1f) Sizing: '%s'", table->OuterRect.Min.x, table->OuterRect.Min.y, table->OuterRect.GetWidth(), table->OuterRect.GetHeight(), DebugNodeTableGetSizingPolicyDesc(table->Flags));
     BulletText("ColumnsGivenWidth: %.1f, ColumnsAutoFitWidth: %.1f, InnerWidth: %.1f%s", table->ColumnsGivenWidth, table->ColumnsAutoFitWidth, table->InnerWidth, table->InnerWidth == 0.0f ? " (auto)" : "");
     BulletText("CellPaddingX: %.1f, CellSpacingX: %.1f/%.1f, OuterPaddingX: %.1f", table->CellPaddingX, table->CellSpacingX1, table->CellSpacingX2, table->OuterPaddingX);
+    BulletText("ColumnsEnabledCount: %d, ColumnsVisibleCount: %d", table->ColumnsEnabledCount, table->ColumnsVisibleCount);
     BulletText("HoveredColumnBody: %d, HoveredColumnBorder: %d", table->HoveredColumnBody, table->HoveredColumnBorder);
     BulletText("ResizedColumn: %d, ReorderColumn: %d, HeldHeaderColumn: %d", table->ResizedColumn, table->ReorderColumn, table->HeldHeaderColumn);
     for (int n = 0; n < table->InstanceCurrent + 1; n++)
@@ -3930,39 +3930,75 @@ static ImVec2 InputTextCalcTextSize(ImGuiContext* ctx, const char* text_begin, c
 namespace ImStb
 {
 static int     STB_TEXTEDIT_STRINGLEN(const ImGuiInputTextState* obj)                             { return obj->TextLen; }
-static char    STB_TEXTEDIT_GETCHAR(const ImGuiInputTextState* obj, int idx)                      { IM_ASSERT(idx <= obj->TextLen); return obj->TextA[idx]; }
-static float   STB_TEXTEDIT_GETWIDTH(ImGuiInputTextState* obj, int line_start_idx, int char_idx)  { unsigned int c; ImTextCharFromUtf8(&c, obj->TextA.Data + line_start_idx + char_idx, obj->TextA.Data + obj->TextLen); if ((ImWchar)c == '\n') return IMSTB_TEXTEDIT_GETWIDTH_NEWLINE; ImGuiContext& g = *obj->Ctx; return g.Font->GetCharAdvance((ImWchar)c) * g.FontScale; }
+static char    STB_TEXTEDIT_GETCHAR(const ImGuiInputTextState* obj, int idx)                      { IM_ASSERT(idx <= obj->TextLen); return *obj->TextGetPtr(idx); }
+static float   STB_TEXTEDIT_GETWIDTH(ImGuiInputTextState* obj, int line_start_idx, int char_idx)  { unsigned int c; ImTextCharFromUtf8(&c, obj->TextGetPtr(line_start_idx + char_idx), obj->TextGetSegmentEnd(line_start_idx + char_idx)); if ((ImWchar)c == '\n') return IMSTB_TEXTEDIT_GETWIDTH_NEWLINE; ImGuiContext& g = *obj->Ctx; return g.Font->GetCharAdvance((ImWchar)c) * g.FontScale; }
 static char    STB_TEXTEDIT_NEWLINE = '\n';
 static void    STB_TEXTEDIT_LAYOUTROW(StbTexteditRow* r, ImGuiInputTextState* obj, int line_start_idx)
 {
-    const char* text = obj->TextA.Data;
+    // When using a gap buffer, move the gap out of the way if the row continues after it (cost is proportional to row length)
+    if (obj->TextGapSize > 0 && line_start_idx < obj->TextGapPos && memchr(obj->TextA.Data + line_start_idx, '\n', (size_t)(obj->TextGapPos - line_start_idx)) == NULL)
+        obj->TextGapMove(line_start_idx);
+    const char* text = obj->TextGetPtr(line_start_idx);
     const char* text_remaining = NULL;
-    const ImVec2 size = InputTextCalcTextSize(obj->Ctx, text + line_start_idx, text + obj->TextLen, &text_remaining, NULL, true);
+    const ImVec2 size = InputTextCalcTextSize(obj->Ctx, text, obj->TextGetSegmentEnd(line_start_idx), &text_remaining, NULL, true);
     r->x0 = 0.0f;
     r->x1 = size.x;
     r->baseline_y_delta = size.y;
     r->ymin = 0.0f;
     r->ymax = size.y;
-    r->num_chars = (int)(text_remaining - (text + line_start_idx));
+    r->num_chars = (int)(text_remaining - text);
 }
 
 #define IMSTB_TEXTEDIT_GETNEXTCHARINDEX  IMSTB_TEXTEDIT_GETNEXTCHARINDEX_IMPL
 #define IMSTB_TEXTEDIT_GETPREVCHARINDEX  IMSTB_TEXTEDIT_GETPREVCHARINDEX_IMPL
+#define IMSTB_TEXTEDIT_FINDROWBYCOORD    IMSTB_TEXTEDIT_FINDROWBYCOORD_IMPL
+#define IMSTB_TEXTEDIT_FINDROWBYCHAR     IMSTB_TEXTEDIT_FINDROWBYCHAR_IMPL
+
+// Rows are lines of same height (we don't do word-wrapping), use our line index to skip rows instead of laying them all out.
+// We return a row a little before the one stb_textedit is looking for, it will iterate the remaining rows itself.
+static int IMSTB_TEXTEDIT_FINDROWBYCOORD_IMPL(ImGuiInputTextState* obj, float y, float* out_row_y)
+{
+    obj->LineIndexUpdate();
+    const float line_height = obj->Ctx->FontSize;
+    const int line_n = ImClamp((int)(y / line_height) - 1, 0, obj->LineStarts.Size - 1);
+    *out_row_y = line_n * line_height;
+    return obj->LineStarts[line_n];
+}
+
+static int IMSTB_TEXTEDIT_FINDROWBYCHAR_IMPL(ImGuiInputTextState* obj, int idx, float* out_row_y, int* out_prev_row_start)
+{
+    obj->LineIndexUpdate();
+    int line_n = obj->LineIndexFindLine(idx);
+    if (line_n > 0 && obj->LineStarts[line_n] >= obj->TextLen) // Let stb_textedit handle reaching the trailing empty line
+        line_n--;
+    *out_row_y = line_n * obj->Ctx->FontSize;
+    *out_prev_row_start = (line_n > 0) ? obj->LineStarts[line_n - 1] : 0;
+    return obj->LineStarts[line_n];
+}
 
 static int IMSTB_TEXTEDIT_GETNEXTCHARINDEX_IMPL(ImGuiInputTextState* obj, int idx)
 {
     if (idx >= obj->TextLen)
         return obj->TextLen + 1;
     unsigned int c;
-    return idx + ImTextCharFromUtf8(&c, obj->TextA.Data + idx, obj->TextA.Data + obj->TextLen);
+    return idx + ImTextCharFromUtf8(&c, obj->TextGetPtr(idx), obj->TextGetSegmentEnd(idx));
 }
 
 static int IMSTB_TEXTEDIT_GETPREVCHARINDEX_IMPL(ImGuiInputTextState* obj, int idx)
 {
     if (idx <= 0)
         return -1;
-    const char* p = ImTextFindPreviousUtf8Codepoint(obj->TextA.Data, obj->TextA.Data + idx);
-    return (int)(p - obj->TextA.Data);
+    const int segment_begin = (obj->TextGapSize > 0 && idx > obj->TextGapPos) ? obj->TextGapPos : 0;
+    const char* segment_begin_p = obj->TextGetPtr(segment_begin);
+    const char* p = ImTextFindPreviousUtf8Codepoint(segment_begin_p, segment_begin_p + (idx - segment_begin));
+    return segment_begin + (int)(p - segment_begin_p);
+}
+
+static unsigned int InputTextGetCodepoint(const ImGuiInputTextState* obj, int idx)
+{
+    unsigned int c;
+    ImTextCharFromUtf8(&c, obj->TextGetPtr(idx), obj->TextGetSegmentEnd(idx));
+    return c;
 }
 
 static bool ImCharIsSeparatorW(unsigned int c)
@@ -3985,10 +4021,8 @@ static int is_word_boundary_from_right(ImGuiInputTextState* obj, int idx)
     if ((obj->Flags & ImGuiInputTextFlags_Password) || idx <= 0)
         return 0;
 
-    const char* curr_p = obj->TextA.Data + idx;
-    const char* prev_p = ImTextFindPreviousUtf8Codepoint(obj->TextA.Data, curr_p);
-    unsigned int curr_c; ImTextCharFromUtf8(&curr_c, curr_p, obj->TextA.Data + obj->TextLen);
-    unsigned int prev_c; ImTextCharFromUtf8(&prev_c, prev_p, obj->TextA.Data + obj->TextLen);
+    unsigned int curr_c = InputTextGetCodepoint(obj, idx);
+    unsigned int prev_c = InputTextGetCodepoint(obj, IMSTB_TEXTEDIT_GETPREVCHARINDEX(obj, idx));
 
     bool prev_white = ImCharIsBlankW(prev_c);
     bool prev_separ = ImCharIsSeparatorW(prev_c);
@@ -4001,10 +4035,8 @@ static int is_word_boundary_from_left(ImGuiInputTextState* obj, int idx)
     if ((obj->Flags & ImGuiInputTextFlags_Password) || idx <= 0)
         return 0;
 
-    const char* curr_p = obj->TextA.Data + idx;
-    const char* prev_p = ImTextFindPreviousUtf8Codepoint(obj->TextA.Data, curr_p);
-    unsigned int prev_c; ImTextCharFromUtf8(&prev_c, curr_p, obj->TextA.Data + obj->TextLen);
-    unsigned int curr_c; ImTextCharFromUtf8(&curr_c, prev_p, obj->TextA.Data + obj->TextLen);
+    unsigned int prev_c = InputTextGetCodepoint(obj, idx);
+    unsigned int curr_c = InputTextGetCodepoint(obj, IMSTB_TEXTEDIT_GETPREVCHARINDEX(obj, idx));
 
     bool prev_white = ImCharIsBlankW(prev_c);
     bool prev_separ = ImCharIsSeparatorW(prev_c);
@@ -4039,18 +4071,32 @@ static int  STB_TEXTEDIT_MOVEWORDRIGHT_IMPL(ImGuiInputTextState* obj, int idx)
 #define STB_TEXTEDIT_MOVEWORDLEFT       STB_TEXTEDIT_MOVEWORDLEFT_IMPL  // They need to be #define for stb_textedit.h
 #define STB_TEXTEDIT_MOVEWORDRIGHT      STB_TEXTEDIT_MOVEWORDRIGHT_IMPL
 
-static void STB_TEXTEDIT_DELETECHARS(ImGuiInputTextState* obj, int pos, int n)
+// With ImGuiInputTextFlags_NoLiveEdit we don't need TextA to be a contiguous string every frame,
+// so multi-line edits are done in a gap buffer which avoids moving all the text after the cursor on every keystroke.
+static bool InputTextUseGapBuffer(const ImGuiInputTextState* obj)
 {
-    char* dst = obj->TextA.Data + pos;
+    return (obj->Flags & ImGuiInputTextFlags_NoLiveEdit) && (obj->Flags & ImGuiInputTextFlags_Multiline);
+}
 
+static void STB_TEXTEDIT_DELETECHARS(ImGuiInputTextState* obj, int pos, int n)
+{
     obj->Edited = true;
-    obj->TextLen -= n;
+    obj->LineIndexOnDelete(pos, n);
 
-    // Offset remaining text (FIXME-OPT: Use memmove)
-    const char* src = obj->TextA.Data + pos + n;
-    while (char c = *src++)
-        *dst++ = c;
-    *dst = '\0';
+    // Gap buffer: deleted bytes are merged into the gap
+    if (InputTextUseGapBuffer(obj))
+    {
+        obj->TextGapMove(pos);
+        obj->TextGapSize += n;
+        obj->TextLen -= n;
+        return;
+    }
+
+    // Offset remaining text, including zero-terminator
+    obj->TextGapClose();
+    char* dst = obj->TextA.Data + pos;
+    obj->TextLen -= n;
+    memmove(dst, dst + n, (size_t)(obj->TextLen - pos + 1));
 }
 
 static bool STB_TEXTEDIT_INSERTCHARS(ImGuiInputTextState* obj, int pos, const char* new_text, int new_text_len)
@@ -4063,19 +4109,45 @@ static bool STB_TEXTEDIT_INSERTCHARS(ImGuiInputTextState* obj, int pos, const ch
         return false;
 
     // Grow internal buffer if needed
+    const bool use_gap_buffer = InputTextUseGapBuffer(obj);
     if (new_text_len + text_len + 1 > obj->TextA.Size)
     {
         if (!is_resizable)
             return false;
-        obj->TextA.resize(text_len + ImClamp(new_text_len, 32, ImMax(256, new_text_len)) + 1);
+        int grow_size = ImClamp(new_text_len, 32, ImMax(256, new_text_len));
+        if (use_gap_buffer)
+            grow_size = ImMax(grow_size, text_len / 2); // Text after the gap needs to be moved after each resize, grow more to amortize.
+        obj->TextGapClose();
+        obj->TextA.resize(text_len + grow_size + 1);
+    }
+
+    obj->Edited = true;
+    obj->LineIndexOnInsert(pos, new_text, new_text_len);
+
+    // Gap buffer: move gap to insertion point and write into it. Gap uses all spare bytes so it is always large enough here.
+    if (use_gap_buffer)
+    {
+        obj->TextGapMove(pos);
+        memcpy(obj->TextA.Data + pos, new_text, (size_t)new_text_len);
+        obj->TextLen += new_text_len;
+        if (obj->TextGapSize > 0)
+        {
+            IM_ASSERT(obj->TextGapSize >= new_text_len);
+            obj->TextGapPos += new_text_len;
+            obj->TextGapSize -= new_text_len;
+        }
+        else
+        {
+            obj->TextA[obj->TextLen] = '\0'; // Inserted at the end of contiguous text
+        }
+        return true;
     }
 
+    obj->TextGapClose();
     char* text = obj->TextA.Data;
     if (pos != text_len)
         memmove(text + pos + new_text_len, text + pos, (size_t)(text_len - pos));
     memcpy(text + pos, new_text, (size_t)new_text_len);
-
-    obj->Edited = true;
     obj->TextLen += new_text_len;
     obj->TextA[obj->TextLen] = '\0';
 
@@ -4123,6 +4195,32 @@ static void stb_textedit_replace(ImGuiInputTextState* str, STB_TexteditState* st
     IM_ASSERT(0); // Failed to insert character, normally shouldn't happen because of how we currently use stb_textedit_replace()
 }
 
+// Release unused undo/redo storage, keeping the history itself (which is preserved if we come back to the same widget).
+template<typename T>
+static void stb_textedit_shrink_vector(ImVector<T>& v)
+{
+    if (v.Size == 0)
+    {
+        v.clear();
+    }
+    else if (v.Capacity > v.Size)
+    {
+        ImVector<T> v_copy;
+        v_copy = v; // Allocate exact size
+        v.swap(v_copy);
+    }
+}
+
+static void stb_textedit_shrink_undo(STB_TexteditState* state)
+{
+    StbUndoState* s = &state->undostate;
+    stb_textedit_compact_undo(s);
+    stb_textedit_shrink_vector(s->undo_rec);
+    stb_textedit_shrink_vector(s->undo_char);
+    stb_textedit_shrink_vector(s->redo_rec);
+    stb_textedit_shrink_vector(s->redo_char);
+}
+
 } // namespace ImStb
 
 // We added an extra indirection where 'Stb' is heap-allocated, in order facilitate the work of bindings generators.
@@ -4169,6 +4267,121 @@ void ImGuiInputTextState::ReloadUserBufAndSelectAll()       { ReloadUserBuf = tr
 void ImGuiInputTextState::ReloadUserBufAndKeepSelection()   { ReloadUserBuf = true; ReloadSelectionStart = Stb->select_start; ReloadSelectionEnd = Stb->select_end; }
 void ImGuiInputTextState::ReloadUserBufAndMoveToEnd()       { ReloadUserBuf = true; ReloadSelectionStart = ReloadSelectionEnd = INT_MAX; }
 
+// Line index: LineStarts[n] is the byte offset of line n. LineStarts[0] is always 0.
+// Built with a single memchr() pass over the text, then maintained by STB_TEXTEDIT_INSERTCHARS()/STB_TEXTEDIT_DELETECHARS(),
+// which only need to scan inserted text and offset the line starts after the edit point.
+void ImGuiInputTextState::LineIndexUpdate()
+{
+    if (LineStarts.Size > 0)
+        return;
+    LineStarts.push_back(0);
+    if (TextA.Data == NULL)
+        return;
+    const int gap_pos = (TextGapSize > 0) ? TextGapPos : TextLen;
+    const char* text_begin = TextA.Data;
+    for (const char* s = text_begin; (s = (const char*)memchr(s, '\n', (size_t)(text_begin + gap_pos - s))) != NULL; s++)
+        LineStarts.push_back((int)(s - text_begin) + 1);
+    if (gap_pos < TextLen)
+    {
+        text_begin += TextGapSize; // Text after gap
+        for (const char* s = text_begin + gap_pos; (s = (const char*)memchr(s, '\n', (size_t)(text_begin + TextLen - s))) != NULL; s++)
+            LineStarts.push_back((int)(s - text_begin) + 1);
+    }
+}
+
+int ImGuiInputTextState::LineIndexFindLine(int pos) const
+{
+    IM_ASSERT(LineStarts.Size > 0);
+    int count = LineStarts.Size;
+    const int* first = LineStarts.Data;
+    while (count > 0) // Upper bound
+    {
+        const int count2 = count >> 1;
+        if (first[count2] <= pos)
+        {
+            first += count2 + 1;
+            count -= count2 + 1;
+        }
+        else
+        {
+            count = count2;
+        }
+    }
+    return (int)(first - LineStarts.Data) - 1;
+}
+
+void ImGuiInputTextState::LineIndexOnInsert(int pos, const char* new_text, int new_text_len)
+{
+    if (LineStarts.Size == 0)
+        return;
+    const int line_n = LineIndexFindLine(pos) + 1;
+    for (int n = line_n; n < LineStarts.Size; n++)
+        LineStarts.Data[n] += new_text_len;
+    int new_lines_count = 0;
+    for (const char* s = new_text; (s = (const char*)memchr(s, '\n', (size_t)(new_text + new_text_len - s))) != NULL; s++)
+        new_lines_count++;
+    if (new_lines_count == 0)
+        return;
+    LineStarts.resize(LineStarts.Size + new_lines_count);
+    memmove(LineStarts.Data + line_n + new_lines_count, LineStarts.Data + line_n, (size_t)(LineStarts.Size - new_lines_count - line_n) * sizeof(int));
+    int* p_write = LineStarts.Data + line_n;
+    for (const char* s = new_text; (s = (const char*)memchr(s, '\n', (size_t)(new_text + new_text_len - s))) != NULL; s++)
+        *p_write++ = pos + (int)(s - new_text) + 1;
+}
+
+void ImGuiInputTextState::LineIndexOnDelete(int pos, int n)
+{
+    if (LineStarts.Size == 0)
+        return;
+    const int line_first = LineIndexFindLine(pos) + 1;     // First line starting after 'pos'
+    const int line_last = LineIndexFindLine(pos + n) + 1;  // First line starting after 'pos + n'
+    if (line_last > line_first)
+        LineStarts.erase(LineStarts.Data + line_first, LineStarts.Data + line_last);
+    for (int line_n = line_first; line_n < LineStarts.Size; line_n++)
+        LineStarts.Data[line_n] -= n;
+}
+
+// Gap buffer: TextA = [0,TextGapPos) + [TextGapSize unused bytes] + [TextGapPos,TextLen) + zero-terminator.
+// When opened, the gap uses all spare bytes of TextA. When moved to the end it is closed, making TextA a regular string again.
+void ImGuiInputTextState::TextGapMove(int pos)
+{
+    IM_ASSERT(pos >= 0 && pos <= TextLen);
+    char* text = TextA.Data;
+    if (TextGapSize == 0)
+    {
+        TextGapPos = TextLen;
+        TextGapSize = TextA.Size - 1 - TextLen;
+        text[TextLen + TextGapSize] = 0;
+    }
+    if (TextGapSize > 0)
+    {
+        if (pos < TextGapPos)
+            memmove(text + pos + TextGapSize, text + pos, (size_t)(TextGapPos - pos));
+        else if (pos > TextGapPos)
+            memmove(text + TextGapPos, text + TextGapPos + TextGapSize, (size_t)(pos - TextGapPos));
+    }
+    TextGapPos = pos;
+    if (TextGapPos == TextLen)
+    {
+        text[TextLen] = 0;
+        TextGapSize = 0;
+    }
+}
+
+void ImGuiInputTextState::TextGapClose()
+{
+    if (TextGapSize > 0)
+        TextGapMove(TextLen);
+}
+
+const char* ImGuiInputTextState::TextGetRange(int begin, int end)
+{
+    IM_ASSERT(begin <= end);
+    if (TextGapSize > 0 && begin < TextGapPos && TextGapPos < end)
+        TextGapMove((TextGapPos - begin < end - TextGapPos) ? begin : end); // Move to the closest end
+    return TextGetPtr(begin);
+}
+
 ImGuiInputTextCallbackData::ImGuiInputTextCallbackData()
 {
     memset(this, 0, sizeof(*this));
@@ -4232,6 +4445,17 @@ void ImGuiInputTextCallbackData::InsertChars(int pos, const char* new_text, cons
     BufTextLen += new_text_len;
 }
 
+void ImGuiInputTextCallbackData::SetTextColor(int pos, int bytes_count, ImU32 col)
+{
+    IM_ASSERT(EventFlag == ImGuiInputTextFlags_CallbackTextColor);
+    IM_ASSERT(pos >= 0 && bytes_count >= 0 && pos + bytes_count <= BufTextLen);
+    if (bytes_count == 0)
+        return;
+    ImGuiContext& g = *Ctx;
+    ImGuiInputTextColorSpan span = { pos, pos + bytes_count, col };
+    g.InputTextColorSpans.push_back(span);
+}
+
 // Return false to discard a character.
 static bool InputTextFilterCharacter(ImGuiContext* ctx, unsigned int* p_char, ImGuiInputTextFlags flags, ImGuiInputTextCallback callback, void* user_data, bool input_source_is_clipboard)
 {
@@ -4374,6 +4598,8 @@ void ImGui::InputTextDeactivateHook(ImGuiID id)
     if (id == 0 || state->ID != id)
         return;
     g.InputTextDeactivatedState.ID = state->ID;
+    state->TextGapClose();
+    ImStb::stb_textedit_shrink_undo(state->Stb);
     if (state->Flags & ImGuiInputTextFlags_ReadOnly)
     {
         g.InputTextDeactivatedState.TextA.resize(0); // In theory this data won't be used, but clear to be neat.
@@ -4386,6 +4612,240 @@ void ImGui::InputTextDeactivateHook(ImGuiID id)
     }
 }
 
+// [ImGuiInputTextFlags_CallbackTextColor] Lines longer than this are not cached, but rendered with horizontal clipping every frame.
+#define IMGUI_INPUTTEXT_LINE_CACHE_MAX_LEN  1024
+
+// Hash line contents 8 bytes at a time (ImHashData() is processing one byte at a time, which shows when hashing all visible lines every frame).
+static ImGuiID InputTextHashLine(const char* data, int data_size)
+{
+    ImU64 h = ((ImU64)data_size * 0x9E3779B97F4A7C15ULL);
+    for (; data_size > 0; data += 8, data_size -= 8)
+    {
+        ImU64 v = 0;
+        memcpy(&v, data, (size_t)ImMin(data_size, 8));
+        h = (h ^ v) * 0xFF51AFD7ED558CCDULL;
+        h ^= h >> 32;
+    }
+    return (ImGuiID)(h ^ (h >> 29));
+}
+
+static int IMGUI_CDECL InputTextColorSpanComparerByBegin(const void* lhs, const void* rhs)
+{
+    return ((const ImGuiInputTextColorSpan*)lhs)->Begin - ((const ImGuiInputTextColorSpan*)rhs)->Begin;
+}
+
+// Sort spans submitted by SetTextColor(), trim overlaps (first span wins) and apply style alpha.
+static void InputTextColorSpansNormalize(ImVector<ImGuiInputTextColorSpan>& spans)
+{
+    if (spans.Size > 1)
+        ImQsort(spans.Data, (size_t)spans.Size, sizeof(ImGuiInputTextColorSpan), InputTextColorSpanComparerByBegin);
+    int prev_end = 0;
+    int out_n = 0;
+    for (ImGuiInputTextColorSpan span : spans)
+    {
+        span.Begin = ImMax(span.Begin, prev_end);
+        if (span.Begin >= span.End)
+            continue;
+        span.Col = ImGui::GetColorU32(span.Col);
+        spans[out_n++] = span;
+        prev_end = span.End;
+    }
+    spans.resize(out_n);
+}
+
+// Render a single line, alternating between default color and color spans.
+static void InputTextRenderLineSpans(ImDrawList* draw_list, ImFont* font, float font_size, ImVec2 pos, ImU32 col, const ImVec4& clip_rect, const char* line_begin, const char* line_end, const ImGuiInputTextColorSpan* spans, int spans_count)
+{
+    const char* s = line_begin;
+    int span_n = 0;
+    while (s < line_end && pos.x <= clip_rect.z)
+    {
+        const bool in_span = (span_n < spans_count && s == line_begin + spans[span_n].Begin);
+        const char* part_end = in_span ? line_begin + spans[span_n].End : (span_n < spans_count) ? line_begin + spans[span_n].Begin : line_end;
+        font->RenderText(draw_list, font_size, pos, in_span ? spans[span_n].Col : col, clip_rect, s, part_end);
+        pos.x += font->CalcTextSizeA(font_size, FLT_MAX, 0.0f, s, part_end).x;
+        s = part_end;
+        if (in_span)
+            span_n++;
+    }
+}
+
+// Copy cached line geometry into the draw list.
+static void InputTextLineCacheRender(ImDrawList* draw_list, const ImGuiInputTextLineCache* cache, const ImGuiInputTextLineCacheEntry* entry, const ImVec2& line_pos)
+{
+    if (entry->IdxCount == 0)
+        return;
+    draw_list->PrimReserve(entry->IdxCount, entry->VtxCount);
+    const ImDrawIdx idx_base = (ImDrawIdx)draw_list->_VtxCurrentIdx;
+    ImDrawVert* vtx_dst = draw_list->_VtxWritePtr;
+    memcpy(vtx_dst, cache->VtxBuffer.Data + entry->VtxOffset, (size_t)entry->VtxCount * sizeof(ImDrawVert));
+    for (int n = 0; n < entry->VtxCount; n++)
+    {
+        vtx_dst[n].pos.x += line_pos.x;
+        vtx_dst[n].pos.y += line_pos.y;
+    }
+    const ImDrawIdx* idx_src = cache->IdxBuffer.Data + entry->IdxOffset;
+    ImDrawIdx* idx_dst = draw_list->_IdxWritePtr;
+    for (int n = 0; n < entry->IdxCount; n++)
+        idx_dst[n] = (ImDrawIdx)(idx_src[n] + idx_base);
+    draw_list->_VtxWritePtr += entry->VtxCount;
+    draw_list->_IdxWritePtr += entry->IdxCount;
+    draw_list->_VtxCurrentIdx += entry->VtxCount;
+}
+
+// Only keep entries which were used during this frame.
+static void InputTextLineCacheCompact(ImGuiInputTextLineCache* cache, int frame_count)
+{
+    ImVector<ImGuiInputTextLineCacheEntry> entries;
+    ImVector<char> text_buffer;
+    ImVector<ImDrawVert> vtx_buffer;
+    ImVector<ImDrawIdx> idx_buffer;
+    cache->EntriesMap.Clear();
+    for (ImGuiInputTextLineCacheEntry entry : cache->Entries)
+    {
+        if (entry.LastFrameUsed != frame_count)
+            continue;
+        text_buffer.resize(text_buffer.Size + entry.TextLen);
+        memcpy(text_buffer.Data + text_buffer.Size - entry.TextLen, cache->TextBuffer.Data + entry.TextOffset, (size_t)entry.TextLen);
+        vtx_buffer.resize(vtx_buffer.Size + entry.VtxCount);
+        memcpy(vtx_buffer.Data + vtx_buffer.Size - entry.VtxCount, cache->VtxBuffer.Data + entry.VtxOffset, (size_t)entry.VtxCount * sizeof(ImDrawVert));
+        idx_buffer.resize(idx_buffer.Size + entry.IdxCount);
+        memcpy(idx_buffer.Data + idx_buffer.Size - entry.IdxCount, cache->IdxBuffer.Data + entry.IdxOffset, (size_t)entry.IdxCount * sizeof(ImDrawIdx));
+        entry.TextOffset = text_buffer.Size - entry.TextLen;
+        entry.VtxOffset = vtx_buffer.Size - entry.VtxCount;
+        entry.IdxOffset = idx_buffer.Size - entry.IdxCount;
+        cache->EntriesMap.SetInt(entry.Hash, entries.Size);
+        entries.push_back(entry);
+    }
+    cache->Entries.swap(entries);
+    cache->TextBuffer.swap(text_buffer);
+    cache->VtxBuffer.swap(vtx_buffer);
+    cache->IdxBuffer.swap(idx_buffer);
+}
+
+// [ImGuiInputTextFlags_CallbackTextColor] Render lines of a multi-line text, starting from 'text_begin' which is at 'pos'.
+// - Lines above and below 'clip_rect' are skipped.
+// - Lines which aren't in the cache are colored by the user callback and rendered with ImFont::RenderText(), then their vertices are stored in the cache.
+// - Lines which are in the cache are copied into the draw list. Cached lines are keyed by contents, so scrolling and editing
+//   other lines don't need to render them again. Changing font or color empties the cache.
+static void InputTextRenderLinesCached(ImGuiContext* ctx, ImGuiID id, ImDrawList* draw_list, ImVec2 pos, ImU32 col, const ImVec4& clip_rect, const char* text_begin, const char* text_end, ImGuiInputTextFlags flags, ImGuiInputTextCallback callback, void* user_data)
+{
+    ImGuiContext& g = *ctx;
+    ImFont* font = g.Font;
+    const float font_size = g.FontSize;
+    if ((col & IM_COL32_A_MASK) == 0)
+        return;
+
+    ImGuiInputTextLineCache* cache = g.InputTextLineCaches.GetOrAddByKey(id);
+    cache->ID = id;
+    cache->LastFrameActive = g.FrameCount;
+    cache->LastTimeActive = (float)g.Time;
+
+    // Empty cache when anything else affecting the output changes (font atlas may be rebuilt, style alpha is applied to color spans)
+    if (cache->Font != font || cache->FontGlyphs != font->Glyphs.Data || cache->FontSize != font_size || cache->Col != col || cache->Alpha != g.Style.Alpha)
+    {
+        cache->Font = font;
+        cache->FontGlyphs = font->Glyphs.Data;
+        cache->FontSize = font_size;
+        cache->Col = col;
+        cache->Alpha = g.Style.Alpha;
+        cache->EntriesMap.Clear();
+        cache->Entries.resize(0);
+        cache->TextBuffer.resize(0);
+        cache->VtxBuffer.resize(0);
+        cache->IdxBuffer.resize(0);
+    }
+
+    const ImVec4 no_clip_rect(-FLT_MAX, -FLT_MAX, FLT_MAX, FLT_MAX);
+    ImVector<ImGuiInputTextColorSpan>& spans = g.InputTextColorSpans;
+    int lines_rendered = 0;
+    for (const char* line_begin = text_begin; line_begin < text_end && pos.y <= clip_rect.w; pos.y += font_size)
+    {
+        const char* line_end = (const char*)memchr(line_begin, '\n', (size_t)(text_end - line_begin));
+        if (line_end == NULL)
+            line_end = text_end;
+        const char* next_line_begin = line_end + 1;
+        if (pos.y + font_size < clip_rect.y || line_begin == line_end)
+        {
+            line_begin = next_line_begin;
+            continue;
+        }
+        lines_rendered++;
+
+        // Lookup cache
+        const int line_len = (int)(line_end - line_begin);
+        const bool use_cache = (line_len <= IMGUI_INPUTTEXT_LINE_CACHE_MAX_LEN);
+        const ImVec2 line_pos = ImTrunc(pos); // Match ImFont::RenderText()
+        const ImGuiID hash = use_cache ? InputTextHashLine(line_begin, line_len) : 0;
+        if (use_cache)
+        {
+            const int entry_idx = cache->EntriesMap.GetInt(hash, -1);
+            ImGuiInputTextLineCacheEntry* entry = (entry_idx != -1) ? &cache->Entries[entry_idx] : NULL;
+            if (entry != NULL && entry->TextLen == line_len && memcmp(cache->TextBuffer.Data + entry->TextOffset, line_begin, (size_t)line_len) == 0)
+            {
+                entry->LastFrameUsed = g.FrameCount;
+                InputTextLineCacheRender(draw_list, cache, entry, line_pos);
+                line_begin = next_line_begin;
+                continue;
+            }
+        }
+
+        // Let user color the line
+        spans.resize(0);
+        if (callback != NULL)
+        {
+            ImGuiInputTextCallbackData callback_data;
+            callback_data.Ctx = &g;
+            callback_data.EventFlag = ImGuiInputTextFlags_CallbackTextColor;
+            callback_data.Flags = flags;
+            callback_data.UserData = user_data;
+            callback_data.Buf = (char*)line_begin;
+            callback_data.BufTextLen = callback_data.BufSize = line_len;
+            callback(&callback_data);
+            InputTextColorSpansNormalize(spans);
+        }
+
+        // Render and store in cache
+        const int vtx_begin = draw_list->VtxBuffer.Size;
+        const int idx_begin = draw_list->IdxBuffer.Size;
+        const unsigned int vtx_current_idx = draw_list->_VtxCurrentIdx;
+        const unsigned int vtx_offset = draw_list->_CmdHeader.VtxOffset;
+        InputTextRenderLineSpans(draw_list, font, font_size, pos, col, use_cache ? no_clip_rect : clip_rect, line_begin, line_end, spans.Data, spans.Size);
+        if (use_cache && draw_list->_CmdHeader.VtxOffset == vtx_offset) // Don't cache if a new draw command was created for large meshes
+        {
+            ImGuiInputTextLineCacheEntry entry;
+            entry.Hash = hash;
+            entry.TextOffset = cache->TextBuffer.Size;
+            entry.TextLen = line_len;
+            entry.LastFrameUsed = g.FrameCount;
+            entry.VtxOffset = cache->VtxBuffer.Size;
+            entry.VtxCount = draw_list->VtxBuffer.Size - vtx_begin;
+            entry.IdxOffset = cache->IdxBuffer.Size;
+            entry.IdxCount = draw_list->IdxBuffer.Size - idx_begin;
+            cache->VtxBuffer.resize(entry.VtxOffset + entry.VtxCount);
+            for (int n = 0; n < entry.VtxCount; n++)
+            {
+                ImDrawVert& v = cache->VtxBuffer.Data[entry.VtxOffset + n];
+                v = draw_list->VtxBuffer.Data[vtx_begin + n];
+                v.pos.x -= line_pos.x;
+                v.pos.y -= line_pos.y;
+            }
+            cache->TextBuffer.resize(entry.TextOffset + entry.TextLen);
+            memcpy(cache->TextBuffer.Data + entry.TextOffset, line_begin, (size_t)entry.TextLen);
+            cache->IdxBuffer.resize(entry.IdxOffset + entry.IdxCount);
+            for (int n = 0; n < entry.IdxCount; n++)
+                cache->IdxBuffer.Data[entry.IdxOffset + n] = (ImDrawIdx)(draw_list->IdxBuffer.Data[idx_begin + n] - vtx_current_idx);
+            cache->EntriesMap.SetInt(hash, cache->Entries.Size);
+            cache->Entries.push_back(entry);
+        }
+        line_begin = next_line_begin;
+    }
+
+    // Discard unused entries when the cache grows too large (e.g. after scrolling or editing many lines)
+    if (cache->Entries.Size > lines_rendered * 2 + 64)
+        InputTextLineCacheCompact(cache, g.FrameCount);
+}
+
 // Edit a string of text
 // - buf_size account for the zero-terminator, so a buf_size of 6 can hold "Hello" but not "Hello!".
 //   This is so we can easily call InputText() on static arrays using ARRAYSIZE() and to match
@@ -4399,6 +4859,7 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
     ImGuiWindow* window = GetCurrentWindow();
     if (window->SkipItems)
         return false;
+    IMGUI_DEBUG_ALLOC_OWNER_SCOPE(ImGuiDebugAllocOwner_InputText);
 
     IM_ASSERT(buf != NULL && buf_size >= 0);
     IM_ASSERT(!((flags & ImGuiInputTextFlags_CallbackHistory) && (flags & ImGuiInputTextFlags_Multiline)));        // Can't use both together (they both use up/down keys)
@@ -4490,6 +4951,7 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
     const bool is_password = (flags & ImGuiInputTextFlags_Password) != 0;
     const bool is_undoable = (flags & ImGuiInputTextFlags_NoUndoRedo) == 0;
     const bool is_resizable = (flags & ImGuiInputTextFlags_CallbackResize) != 0;
+    const bool is_live_edit = (flags & ImGuiInputTextFlags_NoLiveEdit) == 0;
     if (is_resizable)
         IM_ASSERT(callback != NULL); // Must provide a callback if you set the ImGuiInputTextFlags_CallbackResize flag!
 
@@ -4500,6 +4962,7 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
     const bool user_scroll_active = is_multiline && state != NULL && g.ActiveId == GetWindowScrollbarID(draw_window, ImGuiAxis_Y);
     bool clear_active_id = false;
     bool select_all = false;
+    bool value_edited_not_applied = false; // ImGuiInputTextFlags_NoLiveEdit only
 
     float scroll_y = is_multiline ? draw_window->Scroll.y : FLT_MAX;
 
@@ -4519,6 +4982,14 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
 
         // From the moment we focused we are normally ignoring the content of 'buf' (unless we are in read-only mode)
         const int buf_len = (int)strlen(buf);
+
+        // With ImGuiInputTextFlags_NoLiveEdit, if we were deactivated earlier in this frame our edits haven't been written to 'buf' yet: carry them over.
+        const char* init_text = buf;
+        if (!is_live_edit && !is_readonly && !init_reload_from_user_buf && g.InputTextDeactivatedState.ID == id && strcmp(g.InputTextDeactivatedState.TextA.Data, buf) != 0)
+        {
+            init_text = g.InputTextDeactivatedState.TextA.Data;
+            value_edited_not_applied = true;
+        }
         if (!init_reload_from_user_buf)
         {
             // Take a copy of the initial buffer value.
@@ -4528,15 +4999,18 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
 
         // Preserve cursor position and undo/redo stack if we come back to same widget
         // FIXME: Since we reworked this on 2022/06, may want to differentiate recycle_cursor vs recycle_undostate?
+        const int init_text_len = (init_text == buf) ? buf_len : (int)strlen(init_text);
         bool recycle_state = (state->ID == id && !init_changed_specs && !init_reload_from_user_buf);
-        if (recycle_state && (state->TextLen != buf_len || (strncmp(state->TextA.Data, buf, buf_len) != 0)))
+        if (recycle_state && (state->TextLen != init_text_len || (strncmp(state->TextA.Data, init_text, init_text_len) != 0)))
             recycle_state = false;
 
         // Start edition
         state->ID = id;
-        state->TextA.resize(buf_size + 1);          // we use +1 to make sure that .Data is always pointing to at least an empty string.
-        state->TextLen = (int)strlen(buf);
-        memcpy(state->TextA.Data, buf, state->TextLen + 1);
+        state->TextA.resize(ImMax(buf_size, init_text_len + 1) + 1); // we use +1 to make sure that .Data is always pointing to at least an empty string.
+        state->TextLen = init_text_len;
+        memcpy(state->TextA.Data, init_text, state->TextLen + 1);
+        state->TextGapPos = state->TextGapSize = 0;
+        state->LineIndexClear();
 
         if (recycle_state)
         {
@@ -4624,7 +5098,7 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
 
     // Select the buffer to render.
     const bool buf_display_from_state = (render_cursor || render_selection || g.ActiveId == id) && !is_readonly && state;
-    const bool is_displaying_hint = (hint != NULL && (buf_display_from_state ? state->TextA.Data : buf)[0] == 0);
+    const bool is_displaying_hint = (hint != NULL && (buf_display_from_state ? state->TextLen == 0 : buf[0] == 0));
 
     // Password pushes a temporary font with only a fallback glyph
     if (is_password && !is_displaying_hint)
@@ -4649,6 +5123,7 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         state->Edited = false;
         state->BufCapacity = buf_size;
         state->Flags = flags;
+        state->Stb->undostate.mem_budget = ImMax(io.ConfigInputTextUndoMemoryBudget, 0);
 
         // Although we are active we don't prevent mouse from hovering other elements unless we are interacting right now with the widget.
         // Down the line we should have a cleaner library-wide concept of Selected vs Active.
@@ -4840,7 +5315,7 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         {
             if (flags & ImGuiInputTextFlags_EscapeClearsAll)
             {
-                if (buf[0] != 0)
+                if (is_live_edit ? (buf[0] != 0) : (state->TextLen > 0))
                 {
                     revert_edit = true;
                 }
@@ -4874,10 +5349,11 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
                 const int ib = state->HasSelection() ? ImMin(state->Stb->select_start, state->Stb->select_end) : 0;
                 const int ie = state->HasSelection() ? ImMax(state->Stb->select_start, state->Stb->select_end) : state->TextLen;
 
-                char backup = state->TextA.Data[ie];
-                state->TextA.Data[ie] = 0; // A bit of a hack since SetClipboardText only takes null terminated strings
-                SetClipboardText(state->TextA.Data + ib);
-                state->TextA.Data[ie] = backup;
+                char* text_copy = (char*)state->TextGetRange(ib, ie);
+                char backup = text_copy[ie - ib];
+                text_copy[ie - ib] = 0; // A bit of a hack since SetClipboardText only takes null terminated strings
+                SetClipboardText(text_copy);
+                text_copy[ie - ib] = backup;
             }
             if (is_cut)
             {
@@ -4927,17 +5403,18 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         IM_ASSERT(state != NULL);
         if (revert_edit && !is_readonly)
         {
+            state->TextGapClose();
             if (flags & ImGuiInputTextFlags_EscapeClearsAll)
             {
                 // Clear input
-                IM_ASSERT(buf[0] != 0);
+                IM_ASSERT(is_live_edit ? (buf[0] != 0) : (state->TextLen > 0));
                 apply_new_text = "";
                 apply_new_text_length = 0;
                 value_changed = true;
                 IMSTB_TEXTEDIT_CHARTYPE empty_string;
                 stb_textedit_replace(state, state->Stb, &empty_string, 0);
             }
-            else if (strcmp(buf, state->TextToRevertTo.Data) != 0)
+            else if (strcmp(is_live_edit ? buf : state->TextA.Data, state->TextToRevertTo.Data) != 0)
             {
                 apply_new_text = state->TextToRevertTo.Data;
                 apply_new_text_length = state->TextToRevertTo.Size - 1;
@@ -4962,6 +5439,8 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
             // Note that as soon as the input box is active, the in-widget value gets priority over any underlying modification of the input buffer
             // FIXME: We actually always render 'buf' when calling DrawList->AddText, making the comment above incorrect.
             // FIXME-OPT: CPU waste to do this every time the widget is active, should mark dirty state from the stb_textedit callbacks.
+            // With ImGuiInputTextFlags_NoLiveEdit we only do it when deactivating/validating, or after calling the user callback.
+            bool apply_now = is_live_edit || clear_active_id || validated;
 
             // User callback
             if ((flags & (ImGuiInputTextFlags_CallbackCompletion | ImGuiInputTextFlags_CallbackHistory | ImGuiInputTextFlags_CallbackEdit | ImGuiInputTextFlags_CallbackAlways)) != 0)
@@ -4997,6 +5476,9 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
 
                 if (event_flag)
                 {
+                    state->TextGapClose();
+                    apply_now = true;
+
                     ImGuiInputTextCallbackData callback_data;
                     callback_data.Ctx = &g;
                     callback_data.EventFlag = event_flag;
@@ -5036,17 +5518,27 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
                         IM_ASSERT(callback_data.BufTextLen == (int)strlen(callback_data.Buf)); // You need to maintain BufTextLen if you change the text!
                         InputTextReconcileUndoStateAfterUserCallback(state, callback_data.Buf, callback_data.BufTextLen); // FIXME: Move the rest of this block inside function and rename to InputTextReconcileStateAfterUserCallback() ?
                         state->TextLen = callback_data.BufTextLen;  // Assume correct length and valid UTF-8 from user, saves us an extra strlen()
+                        state->LineIndexClear();
                         state->CursorAnimReset();
                     }
                 }
             }
 
             // Will copy result string if modified
-            if (!is_readonly && strcmp(state->TextA.Data, buf) != 0)
+            if (!is_readonly && apply_now)
             {
-                apply_new_text = state->TextA.Data;
-                apply_new_text_length = state->TextLen;
-                value_changed = true;
+                state->TextGapClose();
+                if (strcmp(state->TextA.Data, buf) != 0)
+                {
+                    apply_new_text = state->TextA.Data;
+                    apply_new_text_length = state->TextLen;
+                    value_changed = true;
+                }
+            }
+            else if (!is_readonly && state->Edited)
+            {
+                // Not applied yet but still notify of the edit, so IsItemDeactivatedAfterEdit() can trigger applying on deactivation.
+                value_edited_not_applied = true;
             }
         }
     }
@@ -5054,7 +5546,20 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
     // Handle reapplying final data on deactivation (see InputTextDeactivateHook() for details)
     if (g.InputTextDeactivatedState.ID == id)
     {
-        if (g.ActiveId != id && IsItemDeactivatedAfterEdit() && !is_readonly && strcmp(g.InputTextDeactivatedState.TextA.Data, buf) != 0)
+        // For multi-line, g.LastItemData currently refers to our child window: test deactivation on our own item.
+        bool is_deactivated_after_edit;
+        if (is_multiline)
+        {
+            ImGuiLastItemData child_item_data = g.LastItemData;
+            g.LastItemData = item_data_backup;
+            is_deactivated_after_edit = IsItemDeactivatedAfterEdit();
+            g.LastItemData = child_item_data;
+        }
+        else
+        {
+            is_deactivated_after_edit = IsItemDeactivatedAfterEdit();
+        }
+        if (g.ActiveId != id && is_deactivated_after_edit && !is_readonly && strcmp(g.InputTextDeactivatedState.TextA.Data, buf) != 0)
         {
             apply_new_text = g.InputTextDeactivatedState.TextA.Data;
             apply_new_text_length = g.InputTextDeactivatedState.TextA.Size - 1;
@@ -5123,6 +5628,9 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         buf_display_end = hint + strlen(hint);
     }
 
+    // Multi-line text may be colored by user and rendered through a per-line cache
+    const bool use_line_cache = is_multiline && !is_displaying_hint && !is_password && (flags & ImGuiInputTextFlags_CallbackTextColor) != 0;
+
     // Render text. We currently only render selection when the widget is active or while scrolling.
     // FIXME: We could remove the '&& render_cursor' to keep rendering selection when inactive.
     if (render_cursor || render_selection)
@@ -5139,38 +5647,64 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         // We are attempting to do most of that in **one main pass** to minimize the computation cost (non-negligible for large amount of text) + 2nd pass for selection rendering (we could merge them by an extra refactoring effort)
         // FIXME: This should occur on buf_display but we'd need to maintain cursor/select_start/select_end for UTF-8.
         const char* text_begin = state->TextA.Data;
-        const char* text_end = text_begin + state->TextLen;
         ImVec2 cursor_offset, select_start_offset;
 
         {
             // Find lines numbers straddling cursor and selection min position
             int cursor_line_no = render_cursor ? -1 : -1000;
             int selmin_line_no = render_selection ? -1 : -1000;
-            const char* cursor_ptr = render_cursor ? text_begin + state->Stb->cursor : NULL;
-            const char* selmin_ptr = render_selection ? text_begin + ImMin(state->Stb->select_start, state->Stb->select_end) : NULL;
+            const int cursor_pos = state->Stb->cursor;
+            const int selmin_pos = ImMin(state->Stb->select_start, state->Stb->select_end);
 
             // Count lines and find line number for cursor and selection ends
+            // In multi-line mode, use the line index which is maintained incrementally while editing (binary search instead of scanning the whole buffer)
             int line_count = 1;
+            int cursor_line_begin_pos = -1;
+            int selmin_line_begin_pos = -1;
             if (is_multiline)
             {
-                for (const char* s = text_begin; (s = (const char*)memchr(s, '\n', (size_t)(text_end - s))) != NULL; s++)
+                state->LineIndexUpdate();
+                line_count = state->LineStarts.Size;
+                if (cursor_line_no == -1)
+                {
+                    const int line_n = state->LineIndexFindLine(cursor_pos);
+                    cursor_line_no = line_n + 1;
+                    cursor_line_begin_pos = state->LineStarts[line_n];
+                }
+                if (selmin_line_no == -1)
                 {
-                    if (cursor_line_no == -1 && s >= cursor_ptr) { cursor_line_no = line_count; }
-                    if (selmin_line_no == -1 && s >= selmin_ptr) { selmin_line_no = line_count; }
-                    line_count++;
+                    const int line_n = state->LineIndexFindLine(selmin_pos);
+                    selmin_line_no = line_n + 1;
+                    selmin_line_begin_pos = state->LineStarts[line_n];
+                }
+
+                // Gap buffer: ensure the text we are measuring below is contiguous
+                if (state->TextGapSize > 0 && (render_cursor || render_selection))
+                {
+                    const int range_begin = render_cursor ? (render_selection ? ImMin(cursor_line_begin_pos, selmin_line_begin_pos) : cursor_line_begin_pos) : selmin_line_begin_pos;
+                    const int range_end = render_cursor ? (render_selection ? ImMax(cursor_pos, selmin_pos) : cursor_pos) : selmin_pos;
+                    text_begin = state->TextGetRange(range_begin, range_end) - range_begin;
                 }
             }
+            const char* cursor_ptr = render_cursor ? text_begin + cursor_pos : NULL;
+            const char* selmin_ptr = render_selection ? text_begin + selmin_pos : NULL;
+            const char* cursor_line_begin = (cursor_line_begin_pos != -1) ? text_begin + cursor_line_begin_pos : NULL;
+            const char* selmin_line_begin = (selmin_line_begin_pos != -1) ? text_begin + selmin_line_begin_pos : NULL;
             if (cursor_line_no == -1)
                 cursor_line_no = line_count;
             if (selmin_line_no == -1)
                 selmin_line_no = line_count;
 
             // Calculate 2d position by finding the beginning of the line and measuring distance
-            cursor_offset.x = InputTextCalcTextSize(&g, ImStrbol(cursor_ptr, text_begin), cursor_ptr).x;
+            if (cursor_line_begin == NULL && cursor_ptr != NULL)
+                cursor_line_begin = ImStrbol(cursor_ptr, text_begin);
+            cursor_offset.x = InputTextCalcTextSize(&g, cursor_line_begin, cursor_ptr).x;
             cursor_offset.y = cursor_line_no * g.FontSize;
             if (selmin_line_no >= 0)
             {
-                select_start_offset.x = InputTextCalcTextSize(&g, ImStrbol(selmin_ptr, text_begin), selmin_ptr).x;
+                if (selmin_line_begin == NULL)
+                    selmin_line_begin = ImStrbol(selmin_ptr, text_begin);
+                select_start_offset.x = InputTextCalcTextSize(&g, selmin_line_begin, selmin_ptr).x;
                 select_start_offset.y = selmin_line_no * g.FontSize;
             }
 
@@ -5214,6 +5748,28 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
             state->CursorFollow = false;
         }
 
+        // Find visible lines (multi-line only submits those to AddText())
+        int line_visible_first = 0;
+        int line_visible_last = INT_MAX;
+        if (is_multiline)
+        {
+            line_visible_first = ImMax((int)((clip_rect.y - draw_pos.y) / g.FontSize) - 1, 0);
+            line_visible_last = (int)((clip_rect.w - draw_pos.y) / g.FontSize) + 1;
+
+            // Gap buffer: ensure visible text is contiguous (with an extra line of margin for selection rendering)
+            if (state->TextGapSize > 0)
+            {
+                const int range_begin = state->LineStarts[ImClamp(line_visible_first - 1, 0, state->LineStarts.Size - 1)];
+                const int range_end = (line_visible_last + 1 < state->LineStarts.Size) ? state->LineStarts[line_visible_last + 1] : state->TextLen;
+                text_begin = state->TextGetRange(range_begin, range_end) - range_begin;
+                if (!is_displaying_hint)
+                {
+                    buf_display = text_begin;
+                    buf_display_end = text_begin + state->TextLen;
+                }
+            }
+        }
+
         // Draw selection
         const ImVec2 draw_scroll = ImVec2(state->Scroll.x, 0.0f);
         if (render_selection)
@@ -5225,7 +5781,20 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
             float bg_offy_up = is_multiline ? 0.0f : -1.0f;    // FIXME: those offsets should be part of the style? they don't play so well with multi-line selection.
             float bg_offy_dn = is_multiline ? 0.0f : 2.0f;
             ImVec2 rect_pos = draw_pos + select_start_offset - draw_scroll;
-            for (const char* p = text_selected_begin; p < text_selected_end; )
+            const char* p = text_selected_begin;
+            if (is_multiline && rect_pos.y < clip_rect.y)
+            {
+                // Skip lines above clipping rectangle
+                const int selmin_line_n = (int)(select_start_offset.y / g.FontSize) - 1;
+                const int line_n = ImMin(selmin_line_n + (int)((clip_rect.y - rect_pos.y) / g.FontSize), state->LineStarts.Size - 1);
+                if (line_n > selmin_line_n)
+                {
+                    p = ImMin(text_begin + state->LineStarts[line_n], text_selected_end);
+                    rect_pos.x = draw_pos.x - draw_scroll.x;
+                    rect_pos.y += (line_n - selmin_line_n) * g.FontSize;
+                }
+            }
+            while (p < text_selected_end)
             {
                 if (rect_pos.y > clip_rect.w + g.FontSize)
                     break;
@@ -5249,11 +5818,24 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         }
 
         // We test for 'buf_display_max_length' as a way to avoid some pathological cases (e.g. single-line 1 MB string) which would make ImDrawList crash.
-        // FIXME-OPT: Multiline could submit a smaller amount of contents to AddText() since we already iterated through it.
+        // Multiline only submits visible lines to AddText(), using the line index.
         if (is_multiline || (buf_display_end - buf_display) < buf_display_max_length)
         {
             ImU32 col = GetColorU32(is_displaying_hint ? ImGuiCol_TextDisabled : ImGuiCol_Text);
-            draw_window->DrawList->AddText(g.Font, g.FontSize, draw_pos - draw_scroll, col, buf_display, buf_display_end, 0.0f, is_multiline ? NULL : &clip_rect);
+            ImVec2 text_pos = draw_pos - draw_scroll;
+            const char* text_visible_begin = buf_display;
+            const char* text_visible_end = buf_display_end;
+            if (is_multiline && buf_display == text_begin)
+            {
+                text_visible_begin = (line_visible_first < state->LineStarts.Size) ? text_begin + state->LineStarts[line_visible_first] : buf_display_end;
+                if (line_visible_last < state->LineStarts.Size)
+                    text_visible_end = text_begin + state->LineStarts[line_visible_last];
+                text_pos.y += line_visible_first * g.FontSize;
+            }
+            if (use_line_cache)
+                InputTextRenderLinesCached(&g, id, draw_window->DrawList, text_pos, col, draw_window->DrawList->_CmdHeader.ClipRect, text_visible_begin, text_visible_end, flags, callback, callback_user_data);
+            else
+                draw_window->DrawList->AddText(g.Font, g.FontSize, text_pos, col, text_visible_begin, text_visible_end, 0.0f, is_multiline ? NULL : &clip_rect);
         }
 
         // Draw blinking cursor
@@ -5278,6 +5860,8 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
     else
     {
         // Render text only (no selection, no cursor)
+        if (buf_display_from_state && state->TextGapSize > 0)
+            state->TextGapClose();
         if (is_multiline)
             text_size = ImVec2(inner_size.x, InputTextCalcTextLenAndLineCount(buf_display, &buf_display_end) * g.FontSize); // We don't need width
         else if (!is_displaying_hint && g.ActiveId == id)
@@ -5288,7 +5872,10 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         if (is_multiline || (buf_display_end - buf_display) < buf_display_max_length)
         {
             ImU32 col = GetColorU32(is_displaying_hint ? ImGuiCol_TextDisabled : ImGuiCol_Text);
-            draw_window->DrawList->AddText(g.Font, g.FontSize, draw_pos, col, buf_display, buf_display_end, 0.0f, is_multiline ? NULL : &clip_rect);
+            if (use_line_cache)
+                InputTextRenderLinesCached(&g, id, draw_window->DrawList, draw_pos, col, draw_window->DrawList->_CmdHeader.ClipRect, buf_display, buf_display_end, flags, callback, callback_user_data);
+            else
+                draw_window->DrawList->AddText(g.Font, g.FontSize, draw_pos, col, buf_display, buf_display_end, 0.0f, is_multiline ? NULL : &clip_rect);
         }
     }
 
@@ -5317,6 +5904,12 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
     // Log as text
     if (g.LogEnabled && (!is_password || is_displaying_hint))
     {
+        if (buf_display_from_state && !is_displaying_hint && state->TextGapSize > 0)
+        {
+            state->TextGapClose();
+            buf_display = state->TextA.Data;
+            buf_display_end = buf_display + state->TextLen;
+        }
         LogSetNextTextDecoration("{", "}");
         LogRenderedText(&draw_pos, buf_display, buf_display_end);
     }
@@ -5324,7 +5917,7 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
     if (label_size.x > 0)
         RenderText(ImVec2(frame_bb.Max.x + style.ItemInnerSpacing.x, frame_bb.Min.y + style.FramePadding.y), label);
 
-    if (value_changed)
+    if (value_changed || value_edited_not_applied)
         MarkItemEdited(id);
 
     IMGUI_TEST_ENGINE_ITEM_INFO(id, label, g.LastItemData.StatusFlags | ImGuiItemStatusFlags_Inputable);
@@ -5344,24 +5937,23 @@ void ImGui::DebugNodeInputTextState(ImGuiInputTextState* state)
     DebugLocateItemOnHover(state->ID);
     Text("CurLenA: %d, Cursor: %d, Selection: %d..%d", state->TextLen, stb_state->cursor, stb_state->select_start, stb_state->select_end);
     Text("BufCapacityA: %d", state->BufCapacity);
-    Text("(Internal Buffer: TextA Size: %d, Capacity: %d)", state->TextA.Size, state->TextA.Capacity);
+    Text("(Internal Buffer: TextA Size: %d, Capacity: %d, Gap: %d bytes at %d)", state->TextA.Size, state->TextA.Capacity, state->TextGapSize, state->TextGapPos);
     Text("has_preferred_x: %d (%.2f)", stb_state->has_preferred_x, stb_state->preferred_x);
-    Text("undo_point: %d, redo_point: %d, undo_char_point: %d, redo_char_point: %d", undo_state->undo_point, undo_state->redo_point, undo_state->undo_char_point, undo_state->redo_char_point);
+    Text("undo: %d records, %d chars, redo: %d records, %d chars", undo_state->undo_rec.Size - undo_state->undo_rec_first, undo_state->undo_char.Size - undo_state->undo_char_first, undo_state->redo_rec.Size, undo_state->redo_char.Size);
+    Text("undo memory: %d/%d bytes", ImStb::stb_textedit_undo_memory_usage(undo_state), undo_state->mem_budget);
     if (BeginChild("undopoints", ImVec2(0.0f, GetTextLineHeight() * 10), ImGuiChildFlags_Borders | ImGuiChildFlags_ResizeY)) // Visualize undo state
     {
+        // Display undo records (oldest first) followed by redo records (next to be redone first)
         PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(0, 0));
-        for (int n = 0; n < IMSTB_TEXTEDIT_UNDOSTATECOUNT; n++)
-        {
-            ImStb::StbUndoRecord* undo_rec = &undo_state->undo_rec[n];
-            const char undo_rec_type = (n < undo_state->undo_point) ? 'u' : (n >= undo_state->redo_point) ? 'r' : ' ';
-            if (undo_rec_type == ' ')
-                BeginDisabled();
-            const int buf_preview_len = (undo_rec_type != ' ' && undo_rec->char_storage != -1) ? undo_rec->insert_length : 0;
-            const char* buf_preview_str = undo_state->undo_char + undo_rec->char_storage;
+        const int undo_count = undo_state->undo_rec.Size - undo_state->undo_rec_first;
+        for (int n = 0; n < undo_count + undo_state->redo_rec.Size; n++)
+        {
+            const bool is_undo = (n < undo_count);
+            ImStb::StbUndoRecord* undo_rec = is_undo ? &undo_state->undo_rec[undo_state->undo_rec_first + n] : &undo_state->redo_rec[undo_state->redo_rec.Size - 1 - (n - undo_count)];
+            const int buf_preview_len = (undo_rec->char_storage != -1) ? ImMin(undo_rec->insert_length, 256) : 0;
+            const char* buf_preview_str = (undo_rec->char_storage != -1) ? (is_undo ? undo_state->undo_char.Data : undo_state->redo_char.Data) + undo_rec->char_storage : "";
             Text("%c [%02d] where %03d, insert %03d, delete %03d, char_storage %03d \"%.*s\"",
-                undo_rec_type, n, undo_rec->where, undo_rec->insert_length, undo_rec->delete_length, undo_rec->char_storage, buf_preview_len, buf_preview_str);
-            if (undo_rec_type == ' ')
-                EndDisabled();
+                is_undo ? 'u' : 'r', n, undo_rec->where, undo_rec->insert_length, undo_rec->delete_length, undo_rec->char_storage, buf_preview_len, buf_preview_str);
         }
         PopStyleVar();
     }
@@ -7999,6 +8591,8 @@ void ImGui::DebugNodeMultiSelectState(ImGuiMultiSelectState* storage)
 // [SECTION] Widgets: Multi-Select helpers
 //-------------------------------------------------------------------------
 // - ImGuiSelectionBasicStorage
+// - ImGuiSelectionBitsetStorage
+// - ImGuiSelectionHashStorage
 // - ImGuiSelectionExternalStorage
 //-------------------------------------------------------------------------
 
@@ -8164,6 +8758,344 @@ void ImGuiSelectionBasicStorage::ApplyRequests(ImGuiMultiSelectIO* ms_io)
 
 //-------------------------------------------------------------------------
 
+ImGuiSelectionBitsetStorage::ImGuiSelectionBitsetStorage()
+{
+    Size = 0;
+}
+
+void ImGuiSelectionBitsetStorage::Clear()
+{
+    Size = 0;
+    _Bits.resize(0);
+}
+
+void ImGuiSelectionBitsetStorage::Swap(ImGuiSelectionBitsetStorage& r)
+{
+    ImSwap(Size, r.Size);
+    _Bits.swap(r._Bits);
+}
+
+bool ImGuiSelectionBitsetStorage::Contains(ImGuiID idx) const
+{
+    const ImU32 word_n = idx >> 6;
+    return word_n < (ImU32)_Bits.Size && (_Bits.Data[word_n] & ((ImU64)1 << (idx & 63))) != 0;
+}
+
+void ImGuiSelectionBitsetStorage::SetItemSelected(ImGuiID idx, bool selected)
+{
+    const int word_n = (int)(idx >> 6);
+    const ImU64 mask = (ImU64)1 << (idx & 63);
+    if (word_n >= _Bits.Size)
+    {
+        if (!selected)
+            return;
+        _Bits.resize(word_n + 1, 0);
+    }
+    ImU64* p_word = &_Bits.Data[word_n];
+    if (selected && (*p_word & mask) == 0) { *p_word |= mask; Size++; }
+    else if (!selected && (*p_word & mask) != 0) { *p_word &= ~mask; Size--; }
+}
+
+// Process 64 items at a time. Storage is grown as needed, up to the last selected index.
+void ImGuiSelectionBitsetStorage::SetRangeSelected(ImGuiID idx_first, ImGuiID idx_last, bool selected)
+{
+    IM_ASSERT(idx_first <= idx_last);
+    int word_first = (int)(idx_first >> 6);
+    int word_last = (int)(idx_last >> 6);
+    ImU64 mask_first = ~(ImU64)0 << (idx_first & 63);
+    ImU64 mask_last = ~(ImU64)0 >> (63 - (idx_last & 63));
+    if (word_last >= _Bits.Size)
+    {
+        if (selected)
+        {
+            _Bits.resize(word_last + 1, 0);
+        }
+        else
+        {
+            if (word_first >= _Bits.Size)
+                return;
+            word_last = _Bits.Size - 1;
+            mask_last = ~(ImU64)0;
+        }
+    }
+    for (int word_n = word_first; word_n <= word_last; word_n++)
+    {
+        ImU64 mask = ~(ImU64)0;
+        if (word_n == word_first)
+            mask &= mask_first;
+        if (word_n == word_last)
+            mask &= mask_last;
+        ImU64* p_word = &_Bits.Data[word_n];
+        const ImU64 old_word = *p_word;
+        const ImU64 new_word = selected ? (old_word | mask) : (old_word & ~mask);
+        if (old_word != new_word)
+        {
+            Size += ImCountSetBits(new_word) - ImCountSetBits(old_word);
+            *p_word = new_word;
+        }
+    }
+}
+
+// Iterator stores the next index to look at. Empty words are skipped 64 items at a time.
+bool ImGuiSelectionBitsetStorage::GetNextSelectedItem(void** opaque_it, ImGuiID* out_idx)
+{
+    const ImU64 idx = (ImU64)(intptr_t)*opaque_it;
+    int word_n = (int)(idx >> 6);
+    ImU64 word = (word_n < _Bits.Size) ? _Bits.Data[word_n] & (~(ImU64)0 << (idx & 63)) : 0;
+    while (word == 0 && ++word_n < _Bits.Size)
+        word = _Bits.Data[word_n];
+    if (word == 0)
+    {
+        *out_idx = 0;
+        return false;
+    }
+    const ImGuiID found_idx = (ImGuiID)(word_n * 64 + ImCountTrailingZeros(word));
+    *opaque_it = (void*)(intptr_t)(found_idx + 1);
+    *out_idx = found_idx;
+    return true;
+}
+
+// Apply requests coming from BeginMultiSelect() and EndMultiSelect().
+// Item indices are used as storage ids, ImGuiSelectionUserData values are expected to be indices.
+void ImGuiSelectionBitsetStorage::ApplyRequests(ImGuiMultiSelectIO* ms_io)
+{
+    IM_ASSERT(ms_io->ItemsCount != -1 && "Missing value for items_count in BeginMultiSelect() call!");
+    for (ImGuiSelectionRequest& req : ms_io->Requests)
+    {
+        if (req.Type == ImGuiSelectionRequestType_SetAll)
+        {
+            Clear();
+            if (req.Selected && ms_io->ItemsCount > 0)
+                SetRangeSelected(0, (ImGuiID)(ms_io->ItemsCount - 1), true);
+        }
+        else if (req.Type == ImGuiSelectionRequestType_SetRange)
+        {
+            SetRangeSelected((ImGuiID)req.RangeFirstItem, (ImGuiID)req.RangeLastItem, req.Selected);
+        }
+    }
+}
+
+//-------------------------------------------------------------------------
+
+// Mix bits so that ids with similar low bits (e.g. aligned pointers) don't cluster. (MurmurHash3 finalizer)
+static inline ImU32 ImGuiSelectionHashStorage_Hash(ImGuiID id)
+{
+    id ^= id >> 16; id *= 0x85EBCA6B;
+    id ^= id >> 13; id *= 0xC2B2AE35;
+    id ^= id >> 16;
+    return id;
+}
+
+static void ImGuiSelectionHashStorage_Insert(ImVector<ImGuiID>& keys, ImGuiID id)
+{
+    const ImU32 mask = (ImU32)keys.Size - 1;
+    for (ImU32 slot = ImGuiSelectionHashStorage_Hash(id) & mask; ; slot = (slot + 1) & mask)
+        if (keys.Data[slot] == 0)
+        {
+            keys.Data[slot] = id;
+            return;
+        }
+}
+
+ImGuiSelectionHashStorage::ImGuiSelectionHashStorage()
+{
+    Size = 0;
+    UserData = NULL;
+    AdapterIndexToStorageId = [](ImGuiSelectionHashStorage*, int idx) { return (ImGuiID)idx; };
+    _HasZero = false;
+    _SortedKeysDirty = false;
+}
+
+// Table memory is kept around but not cleared: clearing is O(1), Reserve() zero-fills it again when the next item is added.
+void ImGuiSelectionHashStorage::Clear()
+{
+    Size = 0;
+    _Keys.resize(0);
+    _SortedKeys.resize(0);
+    _HasZero = false;
+    _SortedKeysDirty = false;
+}
+
+void ImGuiSelectionHashStorage::Swap(ImGuiSelectionHashStorage& r)
+{
+    ImSwap(Size, r.Size);
+    ImSwap(_HasZero, r._HasZero);
+    ImSwap(_SortedKeysDirty, r._SortedKeysDirty);
+    _Keys.swap(r._Keys);
+    _SortedKeys.swap(r._SortedKeys);
+}
+
+// Keep load factor <= 50%
+void ImGuiSelectionHashStorage::Reserve(int items_count)
+{
+    if (items_count * 2 <= _Keys.Size)
+        return;
+    const int new_table_size = ImMax(ImUpperPowerOfTwo(items_count * 2), 16);
+    if (_Keys.Size == 0)
+    {
+        // Nothing to rehash (e.g. after Clear()): reuse all existing capacity, rounded down to a power of two
+        const int kept_table_size = (_Keys.Capacity > 0) ? ImUpperPowerOfTwo(_Keys.Capacity + 1) / 2 : 0;
+        _Keys.resize(ImMax(new_table_size, kept_table_size), 0);
+        return;
+    }
+    ImVector<ImGuiID> old_keys;
+    old_keys.swap(_Keys);
+    _Keys.resize(new_table_size, 0);
+    for (ImGuiID id : old_keys)
+        if (id != 0)
+            ImGuiSelectionHashStorage_Insert(_Keys, id);
+}
+
+bool ImGuiSelectionHashStorage::Contains(ImGuiID id) const
+{
+    if (id == 0)
+        return _HasZero;
+    if (_Keys.Size == 0)
+        return false;
+    const ImU32 mask = (ImU32)_Keys.Size - 1;
+    for (ImU32 slot = ImGuiSelectionHashStorage_Hash(id) & mask; ; slot = (slot + 1) & mask)
+    {
+        if (_Keys.Data[slot] == id)
+            return true;
+        if (_Keys.Data[slot] == 0)
+            return false;
+    }
+}
+
+void ImGuiSelectionHashStorage::SetItemSelected(ImGuiID id, bool selected)
+{
+    if (id == 0)
+    {
+        if (_HasZero != selected)
+        {
+            _HasZero = selected;
+            Size += selected ? +1 : -1;
+            _SortedKeysDirty = true;
+        }
+        return;
+    }
+    if (selected)
+        Reserve(Size + 1);
+    else if (_Keys.Size == 0)
+        return;
+
+    // Lookup
+    const ImU32 mask = (ImU32)_Keys.Size - 1;
+    ImU32 slot = ImGuiSelectionHashStorage_Hash(id) & mask;
+    while (_Keys.Data[slot] != id && _Keys.Data[slot] != 0)
+        slot = (slot + 1) & mask;
+    const bool is_contained = (_Keys.Data[slot] == id);
+    if (selected == is_contained)
+        return;
+    Size += selected ? +1 : -1;
+    _SortedKeysDirty = true;
+    if (selected)
+    {
+        _Keys.Data[slot] = id;
+        return;
+    }
+
+    // Remove without tombstones: shift back following entries of the probe sequence which can't be reached anymore.
+    for (ImU32 slot_next = (slot + 1) & mask; _Keys.Data[slot_next] != 0; slot_next = (slot_next + 1) & mask)
+    {
+        const ImU32 slot_ideal = ImGuiSelectionHashStorage_Hash(_Keys.Data[slot_next]) & mask;
+        if (((slot_next - slot_ideal) & mask) >= ((slot_next - slot) & mask))
+        {
+            _Keys.Data[slot] = _Keys.Data[slot_next];
+            slot = slot_next;
+        }
+    }
+    _Keys.Data[slot] = 0;
+}
+
+// LSD radix sort, 8 bits at a time. Much faster than ImQsort() for millions of ids.
+static void ImGuiSelectionHashStorage_SortIds(ImVector<ImGuiID>& ids)
+{
+    ImVector<ImGuiID> temp;
+    temp.resize(ids.Size);
+    ImGuiID* src = ids.Data;
+    ImGuiID* dst = temp.Data;
+    for (int shift = 0; shift < 32; shift += 8)
+    {
+        int offsets[256] = {};
+        for (int n = 0; n < ids.Size; n++)
+            offsets[(src[n] >> shift) & 0xFF]++;
+        if (offsets[(src[0] >> shift) & 0xFF] == ids.Size)
+            continue; // All ids share the same byte
+        for (int bucket_n = 0, offset = 0; bucket_n < 256; bucket_n++)
+        {
+            const int count = offsets[bucket_n];
+            offsets[bucket_n] = offset;
+            offset += count;
+        }
+        for (int n = 0; n < ids.Size; n++)
+            dst[offsets[(src[n] >> shift) & 0xFF]++] = src[n];
+        ImSwap(src, dst);
+    }
+    if (src != ids.Data)
+        ids.swap(temp);
+}
+
+// Iterate a sorted copy of the selection. It is only rebuilt when the selection changed since last iteration.
+bool ImGuiSelectionHashStorage::GetNextSelectedItem(void** opaque_it, ImGuiID* out_id)
+{
+    ImGuiID* it = (ImGuiID*)*opaque_it;
+    if (it == NULL)
+    {
+        if (_SortedKeysDirty)
+        {
+            _SortedKeys.resize(0);
+            _SortedKeys.reserve(Size);
+            if (_HasZero)
+                _SortedKeys.push_back(0);
+            for (ImGuiID id : _Keys)
+                if (id != 0)
+                    _SortedKeys.push_back(id);
+            IM_ASSERT(_SortedKeys.Size == Size);
+            if (_SortedKeys.Size > 1)
+                ImGuiSelectionHashStorage_SortIds(_SortedKeys);
+            _SortedKeysDirty = false;
+        }
+        it = _SortedKeys.Data;
+    }
+    ImGuiID* it_end = _SortedKeys.Data + _SortedKeys.Size;
+    IM_ASSERT(it >= _SortedKeys.Data && it <= it_end);
+    const bool has_more = (it != it_end);
+    *opaque_it = has_more ? (void**)(it + 1) : (void**)(it);
+    *out_id = has_more ? *it : 0;
+    return has_more;
+}
+
+// Apply requests coming from BeginMultiSelect() and EndMultiSelect().
+// Unlike ImGuiSelectionBasicStorage, this doesn't preserve selection order.
+void ImGuiSelectionHashStorage::ApplyRequests(ImGuiMultiSelectIO* ms_io)
+{
+    IM_ASSERT(ms_io->ItemsCount != -1 && "Missing value for items_count in BeginMultiSelect() call!");
+    IM_ASSERT(AdapterIndexToStorageId != NULL);
+    for (ImGuiSelectionRequest& req : ms_io->Requests)
+    {
+        if (req.Type == ImGuiSelectionRequestType_SetAll)
+        {
+            Clear();
+            if (req.Selected)
+            {
+                Reserve(ms_io->ItemsCount);
+                for (int idx = 0; idx < ms_io->ItemsCount; idx++)
+                    SetItemSelected(GetStorageIdFromIndex(idx), true);
+            }
+        }
+        else if (req.Type == ImGuiSelectionRequestType_SetRange)
+        {
+            if (req.Selected)
+                Reserve(Size + (int)(req.RangeLastItem - req.RangeFirstItem + 1));
+            for (int idx = (int)req.RangeFirstItem; idx <= (int)req.RangeLastItem; idx++)
+                SetItemSelected(GetStorageIdFromIndex(idx), req.Selected);
+        }
+    }
+}
+
+//-------------------------------------------------------------------------
+
 ImGuiSelectionExternalStorage::ImGuiSelectionExternalStorage()
 {
     UserData = NULL;
@@ -8323,7 +9255,217 @@ bool ImGui::ListBox(const char* label, int* current_item, const char* (*getter)(
 // - others https://github.com/ocornut/imgui/wiki/Useful-Extensions
 //-------------------------------------------------------------------------
 
-int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_getter)(void* data, int idx), void* data, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, const ImVec2& size_arg)
+// Min/max of values [idx_begin, idx_end), ignoring NaN. Contiguous arrays are read with 4 accumulators (friendlier to compilers auto-vectorization).
+static void PlotCalcMinMax(const float* values, int stride, int idx_begin, int idx_end, float* io_min, float* io_max)
+{
+    float v_min = *io_min;
+    float v_max = *io_max;
+    if (stride == sizeof(float))
+    {
+        const float* p = values + idx_begin;
+        const float* p_end = values + idx_end;
+        float v_min4[4] = { v_min, v_min, v_min, v_min };
+        float v_max4[4] = { v_max, v_max, v_max, v_max };
+        for (; p + 4 <= p_end; p += 4)
+            for (int n = 0; n < 4; n++)
+            {
+                v_min4[n] = (p[n] < v_min4[n]) ? p[n] : v_min4[n];
+                v_max4[n] = (p[n] > v_max4[n]) ? p[n] : v_max4[n];
+            }
+        for (int n = 0; n < 4; n++)
+        {
+            v_min = ImMin(v_min, v_min4[n]);
+            v_max = ImMax(v_max, v_max4[n]);
+        }
+        for (; p < p_end; p++)
+        {
+            v_min = (*p < v_min) ? *p : v_min;
+            v_max = (*p > v_max) ? *p : v_max;
+        }
+    }
+    else
+    {
+        for (int idx = idx_begin; idx < idx_end; idx++)
+        {
+            const float v = *(const float*)(const void*)((const unsigned char*)values + (size_t)idx * stride);
+            v_min = (v < v_min) ? v : v_min;
+            v_max = (v > v_max) ? v : v_max;
+        }
+    }
+    *io_min = v_min;
+    *io_max = v_max;
+}
+
+ImGuiPlotLod::ImGuiPlotLod()
+{
+    Values = NULL;
+    ValuesCount = 0;
+    Stride = sizeof(float);
+}
+
+void ImGuiPlotLod::Clear()
+{
+    Values = NULL;
+    ValuesCount = 0;
+    Blocks.clear();
+    LevelOffsets.clear();
+}
+
+void ImGuiPlotLod::Build(const float* values, int values_count, int stride)
+{
+    IM_ASSERT(values_count >= 0 && (values != NULL || values_count == 0));
+    Values = values;
+    ValuesCount = values_count;
+    Stride = stride;
+
+    // Setup levels, up to a single block
+    LevelOffsets.resize(0);
+    int blocks_count = 0;
+    for (int level_size = (values_count + IMGUI_PLOT_LOD_BLOCK_SIZE - 1) / IMGUI_PLOT_LOD_BLOCK_SIZE; ; level_size = (level_size + 1) / 2)
+    {
+        LevelOffsets.push_back(blocks_count);
+        blocks_count += level_size;
+        if (level_size <= 1)
+            break;
+    }
+    LevelOffsets.push_back(blocks_count);
+    Blocks.resize(blocks_count * 2);
+    UpdateRange(0, values_count);
+}
+
+void ImGuiPlotLod::UpdateRange(int idx_begin, int idx_end)
+{
+    IM_ASSERT(idx_begin >= 0 && idx_begin <= idx_end && idx_end <= ValuesCount);
+    if (idx_begin == idx_end)
+        return;
+
+    // Update level 0 blocks from values, then parents
+    int b0 = idx_begin / IMGUI_PLOT_LOD_BLOCK_SIZE;
+    int b1 = (idx_end - 1) / IMGUI_PLOT_LOD_BLOCK_SIZE + 1;
+    for (int b = b0; b < b1; b++)
+    {
+        float v_min = FLT_MAX, v_max = -FLT_MAX;
+        PlotCalcMinMax(Values, Stride, b * IMGUI_PLOT_LOD_BLOCK_SIZE, ImMin((b + 1) * IMGUI_PLOT_LOD_BLOCK_SIZE, ValuesCount), &v_min, &v_max);
+        Blocks[b * 2 + 0] = v_min;
+        Blocks[b * 2 + 1] = v_max;
+    }
+    for (int level = 1; level + 1 < LevelOffsets.Size; level++)
+    {
+        const float* src = &Blocks[LevelOffsets[level - 1] * 2];
+        const int src_count = LevelOffsets[level] - LevelOffsets[level - 1];
+        float* dst = &Blocks[LevelOffsets[level] * 2];
+        b0 = b0 / 2;
+        b1 = (b1 - 1) / 2 + 1;
+        for (int b = b0; b < b1; b++)
+        {
+            const int c0 = b * 2;
+            const int c1 = ImMin(b * 2 + 1, src_count - 1);
+            dst[b * 2 + 0] = ImMin(src[c0 * 2 + 0], src[c1 * 2 + 0]);
+            dst[b * 2 + 1] = ImMax(src[c0 * 2 + 1], src[c1 * 2 + 1]);
+        }
+    }
+}
+
+bool ImGuiPlotLod::GetMinMax(int idx_begin, int idx_end, float* out_min, float* out_max) const
+{
+    IM_ASSERT(idx_begin >= 0 && idx_begin <= idx_end && idx_end <= ValuesCount);
+    float v_min = FLT_MAX, v_max = -FLT_MAX;
+    int b0 = (idx_begin + IMGUI_PLOT_LOD_BLOCK_SIZE - 1) / IMGUI_PLOT_LOD_BLOCK_SIZE; // First full block
+    int b1 = idx_end / IMGUI_PLOT_LOD_BLOCK_SIZE;                                     // End of full blocks
+    if (b0 >= b1)
+    {
+        PlotCalcMinMax(Values, Stride, idx_begin, idx_end, &v_min, &v_max);
+    }
+    else
+    {
+        // Partial blocks at both ends are read from values, full blocks from the largest levels which fit
+        PlotCalcMinMax(Values, Stride, idx_begin, b0 * IMGUI_PLOT_LOD_BLOCK_SIZE, &v_min, &v_max);
+        PlotCalcMinMax(Values, Stride, b1 * IMGUI_PLOT_LOD_BLOCK_SIZE, idx_end, &v_min, &v_max);
+        for (int level = 0; b0 < b1; level++, b0 >>= 1, b1 >>= 1)
+        {
+            const float* blocks = &Blocks[LevelOffsets[level] * 2];
+            if (b0 & 1)
+            {
+                v_min = ImMin(v_min, blocks[b0 * 2 + 0]);
+                v_max = ImMax(v_max, blocks[b0 * 2 + 1]);
+                b0++;
+            }
+            if (b1 & 1)
+            {
+                b1--;
+                v_min = ImMin(v_min, blocks[b1 * 2 + 0]);
+                v_max = ImMax(v_max, blocks[b1 * 2 + 1]);
+            }
+        }
+    }
+    *out_min = v_min;
+    *out_max = v_max;
+    return v_min <= v_max;
+}
+
+struct ImGuiPlotArrayGetterData
+{
+    const float* Values;
+    int Stride;
+
+    ImGuiPlotArrayGetterData(const float* values, int stride) { Values = values; Stride = stride; }
+};
+
+static float Plot_ArrayGetter(void* data, int idx)
+{
+    ImGuiPlotArrayGetterData* plot_data = (ImGuiPlotArrayGetterData*)data;
+    const float v = *(const float*)(const void*)((const unsigned char*)plot_data->Values + (size_t)idx * plot_data->Stride);
+    return v;
+}
+
+static float Plot_LodGetter(void* data, int idx)
+{
+    return ((const ImGuiPlotLod*)data)->GetValue(idx);
+}
+
+// Min/max of values [idx_begin, idx_end) in display order (values_offset is applied, range may wrap around the end of the array).
+// Arrays are read directly instead of calling values_getter() for each value.
+static bool PlotGetMinMax(float (*values_getter)(void* data, int idx), void* data, const ImGuiPlotLod* lod, int values_count, int values_offset, int idx_begin, int idx_end, float* out_min, float* out_max)
+{
+    float v_min = FLT_MAX, v_max = -FLT_MAX;
+    const int wrap_begin = (idx_begin + values_offset) % values_count;
+    const int wrap_end = wrap_begin + (idx_end - idx_begin);
+    for (int range_n = 0; range_n < 2; range_n++)
+    {
+        const int range_begin = (range_n == 0) ? wrap_begin : 0;
+        const int range_end = (range_n == 0) ? ImMin(wrap_end, values_count) : wrap_end - values_count;
+        if (range_begin >= range_end)
+            continue;
+        if (lod != NULL)
+        {
+            float range_min, range_max;
+            if (lod->GetMinMax(range_begin, range_end, &range_min, &range_max))
+            {
+                v_min = ImMin(v_min, range_min);
+                v_max = ImMax(v_max, range_max);
+            }
+        }
+        else if (values_getter == &Plot_ArrayGetter)
+        {
+            const ImGuiPlotArrayGetterData* plot_data = (const ImGuiPlotArrayGetterData*)data;
+            PlotCalcMinMax(plot_data->Values, plot_data->Stride, range_begin, range_end, &v_min, &v_max);
+        }
+        else
+        {
+            for (int idx = range_begin; idx < range_end; idx++)
+            {
+                const float v = values_getter(data, idx);
+                v_min = (v < v_min) ? v : v_min; // Ignore NaN values
+                v_max = (v > v_max) ? v : v_max;
+            }
+        }
+    }
+    *out_min = v_min;
+    *out_max = v_max;
+    return v_min <= v_max;
+}
+
+int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_getter)(void* data, int idx), void* data, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, const ImVec2& size_arg, const ImGuiPlotLod* lod)
 {
     ImGuiContext& g = *GImGui;
     ImGuiWindow* window = GetCurrentWindow();
@@ -8345,18 +9487,42 @@ int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_get
     bool hovered;
     ButtonBehavior(frame_bb, id, &hovered, NULL);
 
+    // When plotting from a ImGuiPlotLod, values_count may be smaller than the array (e.g. last N values of a ring buffer): indices wrap around the whole array.
+    const int values_wrap_count = lod ? lod->ValuesCount : values_count;
+    IM_ASSERT(values_count <= values_wrap_count);
+
+    // When there are more values than pixel columns, compute min/max of values covered by each column (sampling values would miss peaks)
+    const int values_count_min = (plot_type == ImGuiPlotType_Lines) ? 2 : 1;
+    const int columns_count = (int)inner_bb.GetWidth();
+    const bool use_columns = (values_count >= values_count_min && columns_count > 0 && values_count > columns_count);
+    ImVector<ImVec2>& columns_min_max = g.PlotColumnsMinMax; // x = min, y = max
+    if (use_columns)
+    {
+        columns_min_max.resize(columns_count);
+        for (int n = 0; n < columns_count; n++)
+        {
+            const int idx_begin = (int)((ImS64)values_count * n / columns_count);
+            const int idx_end = (int)((ImS64)values_count * (n + 1) / columns_count);
+            PlotGetMinMax(values_getter, data, lod, values_wrap_count, values_offset, idx_begin, idx_end, &columns_min_max[n].x, &columns_min_max[n].y);
+        }
+    }
+
     // Determine scale from values if not specified
     if (scale_min == FLT_MAX || scale_max == FLT_MAX)
     {
         float v_min = FLT_MAX;
         float v_max = -FLT_MAX;
-        for (int i = 0; i < values_count; i++)
+        if (use_columns)
         {
-            const float v = values_getter(data, i);
-            if (v != v) // Ignore NaN values
-                continue;
-            v_min = ImMin(v_min, v);
-            v_max = ImMax(v_max, v);
+            for (const ImVec2& column_min_max : columns_min_max)
+            {
+                v_min = ImMin(v_min, column_min_max.x);
+                v_max = ImMax(v_max, column_min_max.y);
+            }
+        }
+        else if (values_count > 0)
+        {
+            PlotGetMinMax(values_getter, data, lod, values_wrap_count, values_offset, 0, values_count, &v_min, &v_max); // Ignore NaN values
         }
         if (scale_min == FLT_MAX)
             scale_min = v_min;
@@ -8366,7 +9532,6 @@ int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_get
 
     RenderFrame(frame_bb.Min, frame_bb.Max, GetColorU32(ImGuiCol_FrameBg), true, style.FrameRounding);
 
-    const int values_count_min = (plot_type == ImGuiPlotType_Lines) ? 2 : 1;
     int idx_hovered = -1;
     if (values_count >= values_count_min)
     {
@@ -8380,8 +9545,8 @@ int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_get
             const int v_idx = (int)(t * item_count);
             IM_ASSERT(v_idx >= 0 && v_idx < values_count);
 
-            const float v0 = values_getter(data, (v_idx + values_offset) % values_count);
-            const float v1 = values_getter(data, (v_idx + 1 + values_offset) % values_count);
+            const float v0 = values_getter(data, (v_idx + values_offset) % values_wrap_count);
+            const float v1 = (plot_type == ImGuiPlotType_Lines) ? values_getter(data, (v_idx + 1 + values_offset) % values_wrap_count) : 0.0f; // Don't read past last value
             if (plot_type == ImGuiPlotType_Lines)
                 SetTooltip("%d: %8.4g\n%d: %8.4g", v_idx, v0, v_idx + 1, v1);
             else if (plot_type == ImGuiPlotType_Histogram)
@@ -8392,7 +9557,7 @@ int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_get
         const float t_step = 1.0f / (float)res_w;
         const float inv_scale = (scale_min == scale_max) ? 0.0f : (1.0f / (scale_max - scale_min));
 
-        float v0 = values_getter(data, (0 + values_offset) % values_count);
+        float v0 = values_getter(data, (0 + values_offset) % values_wrap_count);
         float t0 = 0.0f;
         ImVec2 tp0 = ImVec2( t0, 1.0f - ImSaturate((v0 - scale_min) * inv_scale) );                       // Point in the normalized space of our target rectangle
         float histogram_zero_line_t = (scale_min * scale_max < 0.0f) ? (1 + scale_min * inv_scale) : (scale_min < 0.0f ? 0.0f : 1.0f);   // Where does the zero line stands
@@ -8400,12 +9565,54 @@ int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_get
         const ImU32 col_base = GetColorU32((plot_type == ImGuiPlotType_Lines) ? ImGuiCol_PlotLines : ImGuiCol_PlotHistogram);
         const ImU32 col_hovered = GetColorU32((plot_type == ImGuiPlotType_Lines) ? ImGuiCol_PlotLinesHovered : ImGuiCol_PlotHistogramHovered);
 
+        // Display min/max of values covered by each pixel column
+        if (use_columns)
+        {
+            const float column_w = inner_bb.GetWidth() / columns_count;
+            const float histogram_zero_line_y = ImLerp(inner_bb.Min.y, inner_bb.Max.y, histogram_zero_line_t);
+            float prev_y_top = 0.0f, prev_y_bottom = 0.0f;
+            bool prev_valid = false;
+            for (int n = 0; n < columns_count; n++)
+            {
+                const int idx_begin = (int)((ImS64)values_count * n / columns_count);
+                const int idx_end = (int)((ImS64)values_count * (n + 1) / columns_count);
+                const float v_min = columns_min_max[n].x;
+                const float v_max = columns_min_max[n].y;
+                if (v_min > v_max) // No values or only NaN
+                {
+                    prev_valid = false;
+                    continue;
+                }
+                const float x = inner_bb.Min.x + n * column_w;
+                const float y_top = ImLerp(inner_bb.Min.y, inner_bb.Max.y, 1.0f - ImSaturate((v_max - scale_min) * inv_scale));
+                const float y_bottom = ImLerp(inner_bb.Min.y, inner_bb.Max.y, 1.0f - ImSaturate((v_min - scale_min) * inv_scale));
+                const ImU32 col = (idx_hovered >= idx_begin && idx_hovered < idx_end) ? col_hovered : col_base;
+                if (plot_type == ImGuiPlotType_Lines)
+                {
+                    // Connect to previous column when ranges don't overlap, then draw a vertical segment covering min/max
+                    if (prev_valid && y_top > prev_y_bottom)
+                        window->DrawList->AddLine(ImVec2(x - column_w, prev_y_bottom), ImVec2(x, y_top), col);
+                    else if (prev_valid && y_bottom < prev_y_top)
+                        window->DrawList->AddLine(ImVec2(x - column_w, prev_y_top), ImVec2(x, y_bottom), col);
+                    window->DrawList->AddLine(ImVec2(x, y_top), ImVec2(x, ImMax(y_bottom, y_top + 1.0f)), col);
+                }
+                else if (plot_type == ImGuiPlotType_Histogram)
+                {
+                    window->DrawList->AddRectFilled(ImVec2(x, ImMin(y_top, histogram_zero_line_y)), ImVec2(x + column_w, ImMax(y_bottom, histogram_zero_line_y)), col);
+                }
+                prev_y_top = y_top;
+                prev_y_bottom = y_bottom;
+                prev_valid = true;
+            }
+            res_w = 0; // Skip sampling loop below
+        }
+
         for (int n = 0; n < res_w; n++)
         {
             const float t1 = t0 + t_step;
             const int v1_idx = (int)(t0 * item_count + 0.5f);
             IM_ASSERT(v1_idx >= 0 && v1_idx < values_count);
-            const float v1 = values_getter(data, (v1_idx + values_offset + 1) % values_count);
+            const float v1 = values_getter(data, (v1_idx + values_offset + 1) % values_wrap_count);
             const ImVec2 tp1 = ImVec2( t1, 1.0f - ImSaturate((v1 - scale_min) * inv_scale) );
 
             // NB: Draw calls are merged together by the DrawList system. Still, we should render our batch are lower level to save a bit of CPU.
@@ -8439,21 +9646,6 @@ int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_get
     return idx_hovered;
 }
 
-struct ImGuiPlotArrayGetterData
-{
-    const float* Values;
-    int Stride;
-
-    ImGuiPlotArrayGetterData(const float* values, int stride) { Values = values; Stride = stride; }
-};
-
-static float Plot_ArrayGetter(void* data, int idx)
-{
-    ImGuiPlotArrayGetterData* plot_data = (ImGuiPlotArrayGetterData*)data;
-    const float v = *(const float*)(const void*)((const unsigned char*)plot_data->Values + (size_t)idx * plot_data->Stride);
-    return v;
-}
-
 void ImGui::PlotLines(const char* label, const float* values, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size, int stride)
 {
     ImGuiPlotArrayGetterData data(values, stride);
@@ -8476,6 +9668,16 @@ void ImGui::PlotHistogram(const char* label, float (*values_getter)(void* data,
     PlotEx(ImGuiPlotType_Histogram, label, values_getter, data, values_count, values_offset, overlay_text, scale_min, scale_max, graph_size);
 }
 
+void ImGui::PlotLines(const char* label, const ImGuiPlotLod* lod, int values_offset, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size)
+{
+    PlotEx(ImGuiPlotType_Lines, label, &Plot_LodGetter, (void*)lod, lod->ValuesCount, values_offset, overlay_text, scale_min, scale_max, graph_size, lod);
+}
+
+void ImGui::PlotHistogram(const char* label, const ImGuiPlotLod* lod, int values_offset, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size)
+{
+    PlotEx(ImGuiPlotType_Histogram, label, &Plot_LodGetter, (void*)lod, lod->ValuesCount, values_offset, overlay_text, scale_min, scale_max, graph_size, lod);
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] Widgets: Value helpers
 // Those is not very useful, legacy API.
@@ -5,6 +5,8 @@
 // - Fix in stb_textedit_find_charpos to handle last line (see https://github.com/ocornut/imgui/issues/6000 + #6783)
 // - Added name to struct or it may be forward declared in our code.
 // - Added UTF-8 support (see https://github.com/nothings/stb/issues/188 + https://github.com/ocornut/imgui/pull/7925)
+// - Added IMSTB_TEXTEDIT_FINDROWBYCOORD/IMSTB_TEXTEDIT_FINDROWBYCHAR hooks to skip rows in stb_text_locate_coord()/stb_textedit_find_charpos()
+// - Undo state uses dynamically allocated storage limited by a memory budget, instead of IMSTB_TEXTEDIT_UNDOSTATECOUNT/IMSTB_TEXTEDIT_UNDOCHARCOUNT fixed-size arrays. Consecutive typed characters are coalesced into a single undo record.
 // Grep for [DEAR IMGUI] to find the changes.
 // - Also renamed macros used or defined outside of IMSTB_TEXTEDIT_IMPLEMENTATION block from STB_TEXTEDIT_* to IMSTB_TEXTEDIT_*
 
@@ -102,6 +104,8 @@
 //        [4 + 3 * sizeof(STB_TEXTEDIT_POSITIONTYPE)] * STB_TEXTEDIT_UNDOSTATECOUNT
 //      +          sizeof(STB_TEXTEDIT_CHARTYPE)      * STB_TEXTEDIT_UNDOCHARCOUNT
 //
+//   [DEAR IMGUI] Not applicable anymore: undo storage is allocated on demand, see StbUndoState.
+//
 //
 // Implementation mode:
 //
@@ -295,12 +299,6 @@
 // and undo state.
 //
 
-#ifndef IMSTB_TEXTEDIT_UNDOSTATECOUNT
-#define IMSTB_TEXTEDIT_UNDOSTATECOUNT   99
-#endif
-#ifndef IMSTB_TEXTEDIT_UNDOCHARCOUNT
-#define IMSTB_TEXTEDIT_UNDOCHARCOUNT   999
-#endif
 #ifndef IMSTB_TEXTEDIT_CHARTYPE
 #define IMSTB_TEXTEDIT_CHARTYPE        int
 #endif
@@ -317,13 +315,19 @@ typedef struct
    int                        char_storage;
 } StbUndoRecord;
 
+// [DEAR IMGUI] Dynamic undo storage.
+// Undo and redo are two stacks of records, each with their own character storage ('char_storage' is an offset in it, or -1).
+// When exceeding 'mem_budget', oldest undo records are discarded by advancing 'undo_rec_first'/'undo_char_first': discarded space is reclaimed lazily.
 typedef struct
 {
    // private data
-   StbUndoRecord          undo_rec [IMSTB_TEXTEDIT_UNDOSTATECOUNT];
-   IMSTB_TEXTEDIT_CHARTYPE  undo_char[IMSTB_TEXTEDIT_UNDOCHARCOUNT];
-   short undo_point, redo_point;
-   int undo_char_point, redo_char_point;
+   ImVector<StbUndoRecord>            undo_rec;
+   ImVector<IMSTB_TEXTEDIT_CHARTYPE>  undo_char;
+   ImVector<StbUndoRecord>            redo_rec;
+   ImVector<IMSTB_TEXTEDIT_CHARTYPE>  redo_char;
+   int undo_rec_first, undo_char_first;   // oldest valid undo record and character (older ones have been discarded)
+   int mem_budget;                        // max amount of memory used by records and characters, in bytes
+   unsigned char coalesce;                // last undo record was created by typing and may be extended by more typing
 } StbUndoState;
 
 typedef struct STB_TexteditState
@@ -419,6 +423,9 @@ static int stb_text_locate_coord(IMSTB_TEXTEDIT_STRING *str, float x, float y)
    r.num_chars = 0;
 
    // search rows to find one that straddles 'y'
+#ifdef IMSTB_TEXTEDIT_FINDROWBYCOORD
+   i = IMSTB_TEXTEDIT_FINDROWBYCOORD(str, y, &base_y); // [DEAR IMGUI] skip rows above 'y' (must return the start of a row at or before the one straddling 'y')
+#endif
    while (i < n) {
       STB_TEXTEDIT_LAYOUTROW(&r, str, i);
       if (r.num_chars <= 0)
@@ -515,6 +522,7 @@ static void stb_text_undo(IMSTB_TEXTEDIT_STRING *str, STB_TexteditState *state);
 static void stb_text_redo(IMSTB_TEXTEDIT_STRING *str, STB_TexteditState *state);
 static void stb_text_makeundo_delete(IMSTB_TEXTEDIT_STRING *str, STB_TexteditState *state, int where, int length);
 static void stb_text_makeundo_insert(STB_TexteditState *state, int where, int length);
+static void stb_text_makeundo_insert_typed(IMSTB_TEXTEDIT_STRING *str, STB_TexteditState *state, int where, int length);
 static void stb_text_makeundo_replace(IMSTB_TEXTEDIT_STRING *str, STB_TexteditState *state, int where, int old_length, int new_length);
 
 typedef struct
@@ -547,6 +555,9 @@ static void stb_textedit_find_charpos(StbFindState *find, IMSTB_TEXTEDIT_STRING
 
    // search rows to find the one that straddles character n
    find->y = 0;
+#ifdef IMSTB_TEXTEDIT_FINDROWBYCHAR
+   i = IMSTB_TEXTEDIT_FINDROWBYCHAR(str, n, &find->y, &prev_start); // [DEAR IMGUI] skip rows before character n (must return the start of a row at or before the one straddling n)
+#endif
 
    for(;;) {
       STB_TEXTEDIT_LAYOUTROW(&r, str, i);
@@ -757,7 +768,7 @@ static void stb_textedit_text(IMSTB_TEXTEDIT_STRING* str, STB_TexteditState* sta
    else {
       stb_textedit_delete_selection(str, state); // implicitly clamps
       if (STB_TEXTEDIT_INSERTCHARS(str, state->cursor, text, text_len)) {
-         stb_text_makeundo_insert(state, state->cursor, text_len);
+         stb_text_makeundo_insert_typed(str, state, state->cursor, text_len); // [DEAR IMGUI]
          state->cursor += text_len;
          state->has_preferred_x = 0;
       }
@@ -1137,89 +1148,85 @@ retry:
 //
 //      Undo processing
 //
-// @OPTIMIZE: the undo/redo buffer should be circular
+
+// [DEAR IMGUI] Rewritten to use dynamic storage, see StbUndoState.
+static int stb_textedit_undo_memory_usage(StbUndoState *state)
+{
+   return (state->undo_rec.Size - state->undo_rec_first + state->redo_rec.Size) * (int)sizeof(StbUndoRecord)
+        + (state->undo_char.Size - state->undo_char_first + state->redo_char.Size) * (int)sizeof(IMSTB_TEXTEDIT_CHARTYPE);
+}
 
 static void stb_textedit_flush_redo(StbUndoState *state)
 {
-   state->redo_point = IMSTB_TEXTEDIT_UNDOSTATECOUNT;
-   state->redo_char_point = IMSTB_TEXTEDIT_UNDOCHARCOUNT;
+   state->redo_rec.resize(0);
+   state->redo_char.resize(0);
+}
+
+static void stb_textedit_clear_undo(StbUndoState *state)
+{
+   state->undo_rec.resize(0);
+   state->undo_char.resize(0);
+   state->undo_rec_first = state->undo_char_first = 0;
+}
+
+// move remaining undo records and characters to the front of their storage
+static void stb_textedit_compact_undo(StbUndoState *state)
+{
+   int i, rec_n = state->undo_rec_first, char_n = state->undo_char_first;
+   if (rec_n > 0) {
+      IMSTB_TEXTEDIT_memmove(state->undo_rec.Data, state->undo_rec.Data + rec_n, (size_t) ((state->undo_rec.Size - rec_n) * sizeof(StbUndoRecord)));
+      state->undo_rec.resize(state->undo_rec.Size - rec_n);
+   }
+   if (char_n > 0) {
+      IMSTB_TEXTEDIT_memmove(state->undo_char.Data, state->undo_char.Data + char_n, (size_t) ((state->undo_char.Size - char_n) * sizeof(IMSTB_TEXTEDIT_CHARTYPE)));
+      state->undo_char.resize(state->undo_char.Size - char_n);
+      for (i=0; i < state->undo_rec.Size; ++i)
+         if (state->undo_rec[i].char_storage >= 0)
+            state->undo_rec[i].char_storage -= char_n;
+   }
+   state->undo_rec_first = state->undo_char_first = 0;
 }
 
 // discard the oldest entry in the undo list
 static void stb_textedit_discard_undo(StbUndoState *state)
 {
-   if (state->undo_point > 0) {
-      // if the 0th undo state has characters, clean those up
-      if (state->undo_rec[0].char_storage >= 0) {
-         int n = state->undo_rec[0].insert_length, i;
-         // delete n characters from all other records
-         state->undo_char_point -= n;
-         IMSTB_TEXTEDIT_memmove(state->undo_char, state->undo_char + n, (size_t) (state->undo_char_point*sizeof(IMSTB_TEXTEDIT_CHARTYPE)));
-         for (i=0; i < state->undo_point; ++i)
-            if (state->undo_rec[i].char_storage >= 0)
-               state->undo_rec[i].char_storage -= n; // @OPTIMIZE: get rid of char_storage and infer it
-      }
-      --state->undo_point;
-      IMSTB_TEXTEDIT_memmove(state->undo_rec, state->undo_rec+1, (size_t) (state->undo_point*sizeof(state->undo_rec[0])));
+   if (state->undo_rec_first < state->undo_rec.Size) {
+      StbUndoRecord *r = &state->undo_rec[state->undo_rec_first++];
+      if (r->char_storage >= 0)
+         state->undo_char_first = r->char_storage + r->insert_length;
    }
+   // space is reclaimed once at least half of the records have been discarded, so the cost of moving data is amortized
+   if (state->undo_rec_first == state->undo_rec.Size)
+      stb_textedit_clear_undo(state);
+   else if (state->undo_rec_first * 2 >= state->undo_rec.Size)
+      stb_textedit_compact_undo(state);
 }
 
-// discard the oldest entry in the redo list--it's bad if this
-// ever happens, but because undo & redo have to store the actual
-// characters in different cases, the redo character buffer can
-// fill up even though the undo buffer didn't
-static void stb_textedit_discard_redo(StbUndoState *state)
+// discard oldest undo records until we fit in the memory budget
+static void stb_textedit_enforce_undo_budget(StbUndoState *state, int extra_bytes)
 {
-   int k = IMSTB_TEXTEDIT_UNDOSTATECOUNT-1;
-
-   if (state->redo_point <= k) {
-      // if the k'th undo state has characters, clean those up
-      if (state->undo_rec[k].char_storage >= 0) {
-         int n = state->undo_rec[k].insert_length, i;
-         // move the remaining redo character data to the end of the buffer
-         state->redo_char_point += n;
-         IMSTB_TEXTEDIT_memmove(state->undo_char + state->redo_char_point, state->undo_char + state->redo_char_point-n, (size_t) ((IMSTB_TEXTEDIT_UNDOCHARCOUNT - state->redo_char_point)*sizeof(IMSTB_TEXTEDIT_CHARTYPE)));
-         // adjust the position of all the other records to account for above memmove
-         for (i=state->redo_point; i < k; ++i)
-            if (state->undo_rec[i].char_storage >= 0)
-               state->undo_rec[i].char_storage += n;
-      }
-      // now move all the redo records towards the end of the buffer; the first one is at 'redo_point'
-      // [DEAR IMGUI]
-      size_t move_size = (size_t)((IMSTB_TEXTEDIT_UNDOSTATECOUNT - state->redo_point - 1) * sizeof(state->undo_rec[0]));
-      const char* buf_begin = (char*)state->undo_rec; (void)buf_begin;
-      const char* buf_end   = (char*)state->undo_rec + sizeof(state->undo_rec); (void)buf_end;
-      IM_ASSERT(((char*)(state->undo_rec + state->redo_point)) >= buf_begin);
-      IM_ASSERT(((char*)(state->undo_rec + state->redo_point + 1) + move_size) <= buf_end);
-      IMSTB_TEXTEDIT_memmove(state->undo_rec + state->redo_point+1, state->undo_rec + state->redo_point, move_size);
-
-      // now move redo_point to point to the new one
-      ++state->redo_point;
-   }
+   while (state->undo_rec_first < state->undo_rec.Size && stb_textedit_undo_memory_usage(state) + extra_bytes > state->mem_budget)
+      stb_textedit_discard_undo(state);
 }
 
 static StbUndoRecord *stb_text_create_undo_record(StbUndoState *state, int numchars)
 {
    // any time we create a new undo record, we discard redo
    stb_textedit_flush_redo(state);
+   state->coalesce = 0;
 
-   // if we have no free records, we have to make room, by sliding the
-   // existing records down
-   if (state->undo_point == IMSTB_TEXTEDIT_UNDOSTATECOUNT)
-      stb_textedit_discard_undo(state);
-
-   // if the characters to store won't possibly fit in the buffer, we can't undo
-   if (numchars > IMSTB_TEXTEDIT_UNDOCHARCOUNT) {
-      state->undo_point = 0;
-      state->undo_char_point = 0;
+   // if the characters to store won't possibly fit in the budget, we can't undo
+   int record_bytes = (int)sizeof(StbUndoRecord) + numchars * (int)sizeof(IMSTB_TEXTEDIT_CHARTYPE);
+   if (record_bytes > state->mem_budget) {
+      stb_textedit_clear_undo(state);
       return NULL;
    }
 
-   // if we don't have enough free characters in the buffer, we have to make room
-   while (state->undo_char_point + numchars > IMSTB_TEXTEDIT_UNDOCHARCOUNT)
-      stb_textedit_discard_undo(state);
+   // if we don't have enough memory left, we have to make room
+   stb_textedit_enforce_undo_budget(state, record_bytes);
 
-   return &state->undo_rec[state->undo_point++];
+   state->undo_rec.resize(state->undo_rec.Size + 1);
+   return &state->undo_rec.back();
 }
 
 static IMSTB_TEXTEDIT_CHARTYPE *stb_text_createundo(StbUndoState *state, int pos, int insert_len, int delete_len)
@@ -1236,8 +1243,8 @@ static IMSTB_TEXTEDIT_CHARTYPE *stb_text_createundo(StbUndoState *state, int pos
       r->char_storage = -1;
       return NULL;
    } else {
-      r->char_storage = state->undo_char_point;
-      state->undo_char_point += insert_len;
+      r->char_storage = state->undo_char.Size;
+      state->undo_char.resize(state->undo_char.Size + insert_len);
       return &state->undo_char[r->char_storage];
    }
 }
@@ -1245,52 +1252,33 @@ static IMSTB_TEXTEDIT_CHARTYPE *stb_text_createundo(StbUndoState *state, int pos
 static void stb_text_undo(IMSTB_TEXTEDIT_STRING *str, STB_TexteditState *state)
 {
    StbUndoState *s = &state->undostate;
-   StbUndoRecord u, *r;
-   if (s->undo_point == 0)
+   StbUndoRecord u, r;
+   int i, has_redo = 1;
+   if (s->undo_rec.Size == s->undo_rec_first)
       return;
+   s->coalesce = 0;
 
    // we need to do two things: apply the undo record, and create a redo record
-   u = s->undo_rec[s->undo_point-1];
-   r = &s->undo_rec[s->redo_point-1];
-   r->char_storage = -1;
+   u = s->undo_rec.back();
+   s->undo_rec.pop_back();
 
-   r->insert_length = u.delete_length;
-   r->delete_length = u.insert_length;
-   r->where = u.where;
+   r.where = u.where;
+   r.insert_length = u.delete_length;
+   r.delete_length = u.insert_length;
+   r.char_storage = -1;
 
    if (u.delete_length) {
       // if the undo record says to delete characters, then the redo record will
       // need to re-insert the characters that get deleted, so we need to store
-      // them.
-
-      // there are three cases:
-      //    there's enough room to store the characters
-      //    characters stored for *redoing* don't leave room for redo
-      //    characters stored for *undoing* don't leave room for redo
-      // if the last is true, we have to bail
-
-      if (s->undo_char_point + u.delete_length >= IMSTB_TEXTEDIT_UNDOCHARCOUNT) {
-         // the undo records take up too much character space; there's no space to store the redo characters
-         r->insert_length = 0;
+      // them. if they don't fit in the budget, we can't redo.
+      if ((int)sizeof(StbUndoRecord) + u.delete_length * (int)sizeof(IMSTB_TEXTEDIT_CHARTYPE) > s->mem_budget) {
+         stb_textedit_flush_redo(s);
+         has_redo = 0;
       } else {
-         int i;
-
-         // there's definitely room to store the characters eventually
-         while (s->undo_char_point + u.delete_length > s->redo_char_point) {
-            // should never happen:
-            if (s->redo_point == IMSTB_TEXTEDIT_UNDOSTATECOUNT)
-               return;
-            // there's currently not enough room, so discard a redo record
-            stb_textedit_discard_redo(s);
-         }
-         r = &s->undo_rec[s->redo_point-1];
-
-         r->char_storage = s->redo_char_point - u.delete_length;
-         s->redo_char_point = s->redo_char_point - u.delete_length;
-
-         // now save the characters
+         r.char_storage = s->redo_char.Size;
+         s->redo_char.resize(s->redo_char.Size + u.delete_length);
          for (i=0; i < u.delete_length; ++i)
-            s->undo_char[r->char_storage + i] = STB_TEXTEDIT_GETCHAR(str, u.where + i);
+            s->redo_char[r.char_storage + i] = STB_TEXTEDIT_GETCHAR(str, u.where + i);
       }
 
       // now we can carry out the deletion
@@ -1301,64 +1289,58 @@ static void stb_text_undo(IMSTB_TEXTEDIT_STRING *str, STB_TexteditState *state)
    if (u.insert_length) {
       // easy case: was a deletion, so we need to insert n characters
       STB_TEXTEDIT_INSERTCHARS(str, u.where, &s->undo_char[u.char_storage], u.insert_length);
-      s->undo_char_point -= u.insert_length;
+      s->undo_char.resize(u.char_storage);
    }
+   if (s->undo_rec.Size == s->undo_rec_first)
+      stb_textedit_clear_undo(s);
 
    state->cursor = u.where + u.insert_length;
 
-   s->undo_point--;
-   s->redo_point--;
+   if (has_redo) {
+      s->redo_rec.push_back(r);
+      stb_textedit_enforce_undo_budget(s, 0);
+   }
 }
 
 static void stb_text_redo(IMSTB_TEXTEDIT_STRING *str, STB_TexteditState *state)
 {
    StbUndoState *s = &state->undostate;
-   StbUndoRecord *u, r;
-   if (s->redo_point == IMSTB_TEXTEDIT_UNDOSTATECOUNT)
+   StbUndoRecord u, r;
+   int i;
+   if (s->redo_rec.Size == 0)
       return;
+   s->coalesce = 0;
 
    // we need to do two things: apply the redo record, and create an undo record
-   u = &s->undo_rec[s->undo_point];
-   r = s->undo_rec[s->redo_point];
+   r = s->redo_rec.back();
+   s->redo_rec.pop_back();
 
-   // we KNOW there must be room for the undo record, because the redo record
-   // was derived from an undo record
-
-   u->delete_length = r.insert_length;
-   u->insert_length = r.delete_length;
-   u->where = r.where;
-   u->char_storage = -1;
+   u.delete_length = r.insert_length;
+   u.insert_length = r.delete_length;
+   u.where = r.where;
+   u.char_storage = -1;
 
    if (r.delete_length) {
       // the redo record requires us to delete characters, so the undo record
       // needs to store the characters
-
-      if (s->undo_char_point + u->insert_length > s->redo_char_point) {
-         u->insert_length = 0;
-         u->delete_length = 0;
-      } else {
-         int i;
-         u->char_storage = s->undo_char_point;
-         s->undo_char_point = s->undo_char_point + u->insert_length;
-
-         // now save the characters
-         for (i=0; i < u->insert_length; ++i)
-            s->undo_char[u->char_storage + i] = STB_TEXTEDIT_GETCHAR(str, u->where + i);
-      }
+      u.char_storage = s->undo_char.Size;
+      s->undo_char.resize(s->undo_char.Size + u.insert_length);
+      for (i=0; i < u.insert_length; ++i)
+         s->undo_char[u.char_storage + i] = STB_TEXTEDIT_GETCHAR(str, u.where + i);
 
       STB_TEXTEDIT_DELETECHARS(str, r.where, r.delete_length);
    }
 
    if (r.insert_length) {
       // easy case: need to insert n characters
-      STB_TEXTEDIT_INSERTCHARS(str, r.where, &s->undo_char[r.char_storage], r.insert_length);
-      s->redo_char_point += r.insert_length;
+      STB_TEXTEDIT_INSERTCHARS(str, r.where, &s->redo_char[r.char_storage], r.insert_length);
+      s->redo_char.resize(r.char_storage);
    }
 
    state->cursor = r.where + r.insert_length;
 
-   s->undo_point++;
-   s->redo_point++;
+   s->undo_rec.push_back(u);
+   stb_textedit_enforce_undo_budget(s, 0);
 }
 
 static void stb_text_makeundo_insert(STB_TexteditState *state, int where, int length)
@@ -1366,6 +1348,28 @@ static void stb_text_makeundo_insert(STB_TexteditState *state, int where, int le
    stb_text_createundo(&state->undostate, where, 0, length);
 }
 
+// [DEAR IMGUI] Extend the previous record when typing consecutive characters, instead of creating one record per character.
+// A new record is started at the beginning of each word and on new lines.
+static void stb_text_makeundo_insert_typed(IMSTB_TEXTEDIT_STRING *str, STB_TexteditState *state, int where, int length)
+{
+   StbUndoState *s = &state->undostate;
+   if (s->coalesce && s->undo_rec.Size > s->undo_rec_first) {
+      StbUndoRecord *r = &s->undo_rec.back();
+      if (r->insert_length == 0 && r->where + r->delete_length == where) {
+         IMSTB_TEXTEDIT_CHARTYPE prev_c = STB_TEXTEDIT_GETCHAR(str, where - 1);
+         IMSTB_TEXTEDIT_CHARTYPE c = STB_TEXTEDIT_GETCHAR(str, where);
+         int prev_is_space = (prev_c == ' ' || prev_c == '\t' || prev_c == STB_TEXTEDIT_NEWLINE);
+         int is_space = (c == ' ' || c == '\t' || c == STB_TEXTEDIT_NEWLINE);
+         if (c != STB_TEXTEDIT_NEWLINE && !(prev_is_space && !is_space)) {
+            r->delete_length += length;
+            return;
+         }
+      }
+   }
+   stb_text_makeundo_insert(state, where, length);
+   s->coalesce = 1;
+}
+
 static void stb_text_makeundo_delete(IMSTB_TEXTEDIT_STRING *str, STB_TexteditState *state, int where, int length)
 {
    int i;
@@ -1389,10 +1393,13 @@ static void stb_text_makeundo_replace(IMSTB_TEXTEDIT_STRING *str, STB_TexteditSt
 // reset the state to default
 static void stb_textedit_clear_state(STB_TexteditState *state, int is_single_line)
 {
-   state->undostate.undo_point = 0;
-   state->undostate.undo_char_point = 0;
-   state->undostate.redo_point = IMSTB_TEXTEDIT_UNDOSTATECOUNT;
-   state->undostate.redo_char_point = IMSTB_TEXTEDIT_UNDOCHARCOUNT;
+   state->undostate.undo_rec.clear(); // [DEAR IMGUI] Free memory
+   state->undostate.undo_char.clear();
+   state->undostate.redo_rec.clear();
+   state->undostate.redo_char.clear();
+   state->undostate.undo_rec_first = 0;
+   state->undostate.undo_char_first = 0;
+   state->undostate.coalesce = 0;
    state->select_end = state->select_start = 0;
    state->cursor = 0;
    state->has_preferred_x = 0;
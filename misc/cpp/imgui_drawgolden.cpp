@@ -0,0 +1,443 @@
+// dear imgui: helper to save ImDrawData of frames to a file (golden output) and compare it with a later run, with float tolerance
+// This is an optional helper, it is not used by the core library.
+
+// Changelog:
+// - v0.10: Initial version. Added ImGuiDrawGolden.
+
+#include "imgui.h"
+#include "imgui_internal.h"     // ImFileOpen(), ImFormatString()
+#include "imgui_drawgolden.h"
+#include <string.h>             // memcpy, memcmp
+
+// Clang warnings with -Weverything
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wsign-conversion"    // warning: implicit conversion changes signedness
+#pragma clang diagnostic ignored "-Wdouble-promotion"   // warning: implicit conversion from 'float' to 'double' when passing argument to function
+#endif
+
+// File layout (host byte order):
+// - Header: "IMGOLDEN", u32 version, u32 frames count.
+// - Each frame: string label, f32 x2 DisplayPos, f32 x2 DisplaySize, u32 draw lists count, draw lists.
+// - Each draw list: string owner name, u32 commands count, commands, u32 indices count, u32 x N indices,
+//   u32 vertices count, vertices.
+// - Each command: f32 x4 ClipRect, u32 VtxOffset, u32 IdxOffset, u32 ElemCount, u8 has callback.
+// - Each vertex: f32 x2 pos, f32 x2 uv, u32 col. Each string: u32 length, characters.
+static const char   IMGUI_DRAWGOLDEN_MAGIC[8] = { 'I', 'M', 'G', 'O', 'L', 'D', 'E', 'N' };
+static const ImU32  IMGUI_DRAWGOLDEN_VERSION = 1;
+static const int    IMGUI_DRAWGOLDEN_FRAMES_COUNT_OFFSET = 12;
+static const ImU32  IMGUI_DRAWGOLDEN_CMD_SIZE = 4 * 4 + 3 * 4 + 1;
+static const ImU32  IMGUI_DRAWGOLDEN_VTX_SIZE = 4 * 4 + 4;
+
+template<typename T>
+static void ImGuiDrawGolden_Write(ImVector<char>* buf, T value)
+{
+    const int offset = buf->Size;
+    buf->resize(offset + (int)sizeof(T));
+    memcpy(buf->Data + offset, &value, sizeof(T));
+}
+
+static void ImGuiDrawGolden_WriteString(ImVector<char>* buf, const char* s)
+{
+    const int len = (s != NULL) ? (int)strlen(s) : 0;
+    ImGuiDrawGolden_Write<ImU32>(buf, (ImU32)len);
+    const int offset = buf->Size;
+    buf->resize(offset + len);
+    if (len > 0)
+        memcpy(buf->Data + offset, s, (size_t)len);
+}
+
+template<typename T>
+static T ImGuiDrawGolden_Get(const char* p)
+{
+    T value;
+    memcpy(&value, p, sizeof(T));
+    return value;
+}
+
+struct ImGuiDrawGoldenReader
+{
+    const char*     P;
+    const char*     End;
+    bool            Error;
+
+    ImGuiDrawGoldenReader(const char* p, const char* end) { P = p; End = end; Error = false; }
+    template<typename T> T Read()
+    {
+        T value = T();
+        if ((size_t)(End - P) < sizeof(T)) { Error = true; return value; }
+        memcpy(&value, P, sizeof(T));
+        P += sizeof(T);
+        return value;
+    }
+    const char* SkipArray(ImU32 count, ImU32 elem_size)
+    {
+        if (count > (size_t)(End - P) / elem_size) { Error = true; return NULL; }
+        const char* p = P;
+        P += (size_t)count * elem_size;
+        return p;
+    }
+};
+
+struct ImGuiDrawGoldenCmd
+{
+    ImVec4          ClipRect;
+    ImU32           VtxOffset;
+    ImU32           IdxOffset;
+    ImU32           ElemCount;
+    bool            HasCallback;
+};
+
+struct ImGuiDrawGoldenVtx
+{
+    ImVec2          Pos;
+    ImVec2          Uv;
+    ImU32           Col;
+};
+
+// Frame and draw list, pointing into file data
+struct ImGuiDrawGoldenFrame
+{
+    const char*     Label;
+    int             LabelLen;
+    ImVec2          DisplayPos;
+    ImVec2          DisplaySize;
+    int             ListsCount;
+};
+
+struct ImGuiDrawGoldenList
+{
+    const char*     Name;
+    int             NameLen;
+    int             CmdCount;
+    const char*     Cmds;
+    int             IdxCount;
+    const char*     Idx;
+    int             VtxCount;
+    const char*     Vtx;
+
+    ImGuiDrawGoldenCmd GetCmd(int n) const
+    {
+        const char* p = Cmds + (size_t)n * IMGUI_DRAWGOLDEN_CMD_SIZE;
+        ImGuiDrawGoldenCmd cmd;
+        cmd.ClipRect = ImGuiDrawGolden_Get<ImVec4>(p);
+        cmd.VtxOffset = ImGuiDrawGolden_Get<ImU32>(p + 16);
+        cmd.IdxOffset = ImGuiDrawGolden_Get<ImU32>(p + 20);
+        cmd.ElemCount = ImGuiDrawGolden_Get<ImU32>(p + 24);
+        cmd.HasCallback = p[28] != 0;
+        return cmd;
+    }
+    ImU32 GetIdx(ImU32 n) const { return ImGuiDrawGolden_Get<ImU32>(Idx + (size_t)n * 4); }
+    ImGuiDrawGoldenVtx GetVtx(ImU32 n) const
+    {
+        const char* p = Vtx + (size_t)n * IMGUI_DRAWGOLDEN_VTX_SIZE;
+        ImGuiDrawGoldenVtx vtx;
+        vtx.Pos = ImGuiDrawGolden_Get<ImVec2>(p);
+        vtx.Uv = ImGuiDrawGolden_Get<ImVec2>(p + 8);
+        vtx.Col = ImGuiDrawGolden_Get<ImU32>(p + 16);
+        return vtx;
+    }
+};
+
+static bool ImGuiDrawGolden_ReadString(ImGuiDrawGoldenReader* r, const char** out_s, int* out_len)
+{
+    const ImU32 len = r->Read<ImU32>();
+    *out_s = r->SkipArray(len, 1);
+    *out_len = (int)len;
+    return !r->Error;
+}
+
+static bool ImGuiDrawGolden_ReadFrame(ImGuiDrawGoldenReader* r, ImGuiDrawGoldenFrame* out_frame)
+{
+    if (!ImGuiDrawGolden_ReadString(r, &out_frame->Label, &out_frame->LabelLen))
+        return false;
+    out_frame->DisplayPos = r->Read<ImVec2>();
+    out_frame->DisplaySize = r->Read<ImVec2>();
+    out_frame->ListsCount = (int)r->Read<ImU32>();
+    return !r->Error && out_frame->ListsCount >= 0;
+}
+
+// Commands and indices are validated so Compare() never reads out of bounds
+static bool ImGuiDrawGolden_ReadList(ImGuiDrawGoldenReader* r, ImGuiDrawGoldenList* out_list)
+{
+    if (!ImGuiDrawGolden_ReadString(r, &out_list->Name, &out_list->NameLen))
+        return false;
+    const ImU32 cmd_count = r->Read<ImU32>();
+    out_list->Cmds = r->SkipArray(cmd_count, IMGUI_DRAWGOLDEN_CMD_SIZE);
+    const ImU32 idx_count = r->Read<ImU32>();
+    out_list->Idx = r->SkipArray(idx_count, 4);
+    const ImU32 vtx_count = r->Read<ImU32>();
+    out_list->Vtx = r->SkipArray(vtx_count, IMGUI_DRAWGOLDEN_VTX_SIZE);
+    if (r->Error || cmd_count > INT_MAX || idx_count > INT_MAX || vtx_count > INT_MAX)
+        return false;
+    out_list->CmdCount = (int)cmd_count;
+    out_list->IdxCount = (int)idx_count;
+    out_list->VtxCount = (int)vtx_count;
+    for (int cmd_n = 0; cmd_n < out_list->CmdCount; cmd_n++)
+    {
+        const ImGuiDrawGoldenCmd cmd = out_list->GetCmd(cmd_n);
+        if ((ImU64)cmd.IdxOffset + cmd.ElemCount > idx_count)
+            return false;
+        for (ImU32 idx_n = cmd.IdxOffset; idx_n < cmd.IdxOffset + cmd.ElemCount; idx_n++)
+            if ((ImU64)cmd.VtxOffset + out_list->GetIdx(idx_n) >= vtx_count)
+                return false;
+    }
+    return true;
+}
+
+void ImGuiDrawGolden::CaptureFrame(const ImDrawData* draw_data, const char* label)
+{
+    IM_ASSERT(draw_data != NULL && draw_data->Valid && "Call after ImGui::Render()");
+    ImVector<char>* buf = &Data;
+    if (buf->Size == 0)
+    {
+        buf->resize((int)sizeof(IMGUI_DRAWGOLDEN_MAGIC));
+        memcpy(buf->Data, IMGUI_DRAWGOLDEN_MAGIC, sizeof(IMGUI_DRAWGOLDEN_MAGIC));
+        ImGuiDrawGolden_Write<ImU32>(buf, IMGUI_DRAWGOLDEN_VERSION);
+        ImGuiDrawGolden_Write<ImU32>(buf, 0);
+    }
+
+    // Reserve once for the whole frame
+    size_t frame_size = 4 + strlen(label) + 4 * 5;
+    for (const ImDrawList* draw_list : draw_data->CmdLists)
+        frame_size += 4 * 4 + 256 + (size_t)draw_list->CmdBuffer.Size * IMGUI_DRAWGOLDEN_CMD_SIZE + (size_t)draw_list->IdxBuffer.Size * 4 + (size_t)draw_list->VtxBuffer.Size * IMGUI_DRAWGOLDEN_VTX_SIZE;
+    if (buf->Size + (int)frame_size > buf->Capacity)
+        buf->reserve(buf->_grow_capacity(buf->Size + (int)frame_size));
+
+    FrameOffsets.push_back(buf->Size);
+    ImGuiDrawGolden_WriteString(buf, label);
+    ImGuiDrawGolden_Write<ImVec2>(buf, draw_data->DisplayPos);
+    ImGuiDrawGolden_Write<ImVec2>(buf, draw_data->DisplaySize);
+    ImGuiDrawGolden_Write<ImU32>(buf, (ImU32)draw_data->CmdLists.Size);
+    for (const ImDrawList* draw_list : draw_data->CmdLists)
+    {
+        ImGuiDrawGolden_WriteString(buf, draw_list->_OwnerName);
+        ImGuiDrawGolden_Write<ImU32>(buf, (ImU32)draw_list->CmdBuffer.Size);
+        for (const ImDrawCmd& cmd : draw_list->CmdBuffer)
+        {
+            ImGuiDrawGolden_Write<ImVec4>(buf, cmd.ClipRect);
+            ImGuiDrawGolden_Write<ImU32>(buf, cmd.VtxOffset);
+            ImGuiDrawGolden_Write<ImU32>(buf, cmd.IdxOffset);
+            ImGuiDrawGolden_Write<ImU32>(buf, cmd.UserCallback ? 0 : cmd.ElemCount);
+            ImGuiDrawGolden_Write<ImU8>(buf, cmd.UserCallback ? 1 : 0);
+        }
+        ImGuiDrawGolden_Write<ImU32>(buf, (ImU32)draw_list->IdxBuffer.Size);
+        for (ImDrawIdx idx : draw_list->IdxBuffer)
+            ImGuiDrawGolden_Write<ImU32>(buf, (ImU32)idx);
+        ImGuiDrawGolden_Write<ImU32>(buf, (ImU32)draw_list->VtxBuffer.Size);
+        for (const ImDrawVert& vtx : draw_list->VtxBuffer)
+        {
+            ImGuiDrawGolden_Write<ImVec2>(buf, vtx.pos);
+            ImGuiDrawGolden_Write<ImVec2>(buf, vtx.uv);
+            ImGuiDrawGolden_Write<ImU32>(buf, vtx.col);
+        }
+    }
+
+    // Keep header valid so SaveToFile() can be called at any time
+    const ImU32 frames_count = (ImU32)FrameOffsets.Size;
+    memcpy(buf->Data + IMGUI_DRAWGOLDEN_FRAMES_COUNT_OFFSET, &frames_count, sizeof(ImU32));
+}
+
+bool ImGuiDrawGolden::SaveToFile(const char* filename) const
+{
+    if (Data.Size == 0)
+        return false;
+    ImFileHandle f = ImFileOpen(filename, "wb");
+    if (f == NULL)
+        return false;
+    const bool ret = ImFileWrite(Data.Data, 1, (ImU64)Data.Size, f) == (ImU64)Data.Size;
+    ImFileClose(f);
+    return ret;
+}
+
+bool ImGuiDrawGolden::LoadFromFile(const char* filename)
+{
+    Clear();
+    size_t file_size = 0;
+    char* file_data = (char*)ImFileLoadToMemory(filename, "rb", &file_size);
+    if (file_data == NULL)
+        return false;
+    if (file_size > INT_MAX)
+    {
+        IM_FREE(file_data);
+        return false;
+    }
+    Data.resize((int)file_size);
+    memcpy(Data.Data, file_data, file_size);
+    IM_FREE(file_data);
+
+    // Validate everything now, so Compare() doesn't have to
+    ImGuiDrawGoldenReader r(Data.Data, Data.Data + Data.Size);
+    const char* magic = r.SkipArray(sizeof(IMGUI_DRAWGOLDEN_MAGIC), 1);
+    bool ret = magic != NULL && memcmp(magic, IMGUI_DRAWGOLDEN_MAGIC, sizeof(IMGUI_DRAWGOLDEN_MAGIC)) == 0;
+    ret = ret && r.Read<ImU32>() == IMGUI_DRAWGOLDEN_VERSION;
+    const ImU32 frames_count = r.Read<ImU32>();
+    for (ImU32 frame_n = 0; ret && frame_n < frames_count; frame_n++)
+    {
+        FrameOffsets.push_back((int)(r.P - Data.Data));
+        ImGuiDrawGoldenFrame frame;
+        ret = ImGuiDrawGolden_ReadFrame(&r, &frame);
+        for (int list_n = 0; ret && list_n < frame.ListsCount; list_n++)
+        {
+            ImGuiDrawGoldenList list;
+            ret = ImGuiDrawGolden_ReadList(&r, &list);
+        }
+    }
+    if (!ret || r.Error || r.P != r.End)
+    {
+        Clear();
+        return false;
+    }
+    return true;
+}
+
+void ImGuiDrawGolden::GetFrameLabel(int frame_idx, const char** out_label, const char** out_label_end) const
+{
+    IM_ASSERT(frame_idx >= 0 && frame_idx < FrameOffsets.Size);
+    ImGuiDrawGoldenReader r(Data.Data + FrameOffsets[frame_idx], Data.Data + Data.Size);
+    ImGuiDrawGoldenFrame frame;
+    ImGuiDrawGolden_ReadFrame(&r, &frame);
+    *out_label = frame.Label;
+    *out_label_end = frame.Label + frame.LabelLen;
+}
+
+void ImGuiDrawGolden::Clear()
+{
+    Data.clear();
+    FrameOffsets.clear();
+}
+
+//-----------------------------------------------------------------------------
+// Comparison
+//-----------------------------------------------------------------------------
+
+static bool ImGuiDrawGolden_CompareFloat(float a, float b, float tolerance)
+{
+    return a == b || ImFabs(a - b) <= tolerance;
+}
+
+// Fill description from location stored in 'diff'. Always return false.
+static bool ImGuiDrawGolden_ReportDiff(ImGuiDrawGoldenDiff* diff, const ImGuiDrawGoldenFrame* frame, const ImGuiDrawGoldenList* list, const char* fmt, ...) IM_FMTARGS(4);
+static bool ImGuiDrawGolden_ReportDiff(ImGuiDrawGoldenDiff* diff, const ImGuiDrawGoldenFrame* frame, const ImGuiDrawGoldenList* list, const char* fmt, ...)
+{
+    char* p = diff->Desc;
+    char* p_end = diff->Desc + IM_ARRAYSIZE(diff->Desc);
+    p += ImFormatString(p, p_end - p, "frame %d", diff->Frame);
+    if (frame != NULL)
+        p += ImFormatString(p, p_end - p, " '%.*s'", frame->LabelLen, frame->Label);
+    if (diff->DrawList != -1 && list != NULL)
+        p += ImFormatString(p, p_end - p, ", draw list %d '%.*s'", diff->DrawList, list->NameLen, list->Name);
+    if (diff->Cmd != -1)
+        p += ImFormatString(p, p_end - p, ", cmd %d", diff->Cmd);
+    if (diff->Idx != -1)
+        p += ImFormatString(p, p_end - p, ", idx %d, vtx %d", diff->Idx, diff->Vtx);
+    p += ImFormatString(p, p_end - p, ": ");
+    va_list args;
+    va_start(args, fmt);
+    ImFormatStringV(p, p_end - p, fmt, args);
+    va_end(args);
+    return false;
+}
+
+static bool ImGuiDrawGolden_CompareList(const ImGuiDrawGoldenFrame* frame, const ImGuiDrawGoldenList* list, const ImGuiDrawGoldenList* ref_list, float tolerance, ImGuiDrawGoldenDiff* diff)
+{
+    if (list->NameLen != ref_list->NameLen || memcmp(list->Name, ref_list->Name, (size_t)list->NameLen) != 0)
+        return ImGuiDrawGolden_ReportDiff(diff, frame, list, "owner (reference: '%.*s')", ref_list->NameLen, ref_list->Name);
+
+    // Walk commands in order, comparing vertices through indices, so the first divergence is reported
+    const int cmds_count = ImMin(list->CmdCount, ref_list->CmdCount);
+    for (int cmd_n = 0; cmd_n < cmds_count; cmd_n++)
+    {
+        diff->Cmd = cmd_n;
+        const ImGuiDrawGoldenCmd cmd = list->GetCmd(cmd_n);
+        const ImGuiDrawGoldenCmd ref_cmd = ref_list->GetCmd(cmd_n);
+        for (int n = 0; n < 4; n++)
+            if (!ImGuiDrawGolden_CompareFloat((&cmd.ClipRect.x)[n], (&ref_cmd.ClipRect.x)[n], tolerance))
+                return ImGuiDrawGolden_ReportDiff(diff, frame, list, "ClipRect (%.2f,%.2f)-(%.2f,%.2f) (reference: (%.2f,%.2f)-(%.2f,%.2f))",
+                    cmd.ClipRect.x, cmd.ClipRect.y, cmd.ClipRect.z, cmd.ClipRect.w, ref_cmd.ClipRect.x, ref_cmd.ClipRect.y, ref_cmd.ClipRect.z, ref_cmd.ClipRect.w);
+        if (cmd.HasCallback != ref_cmd.HasCallback)
+            return ImGuiDrawGolden_ReportDiff(diff, frame, list, "%s (reference: %s)", cmd.HasCallback ? "callback" : "no callback", ref_cmd.HasCallback ? "callback" : "no callback");
+
+        const ImU32 elem_count = ImMin(cmd.ElemCount, ref_cmd.ElemCount);
+        for (ImU32 elem_n = 0; elem_n < elem_count; elem_n++)
+        {
+            const ImU32 vtx_n = cmd.VtxOffset + list->GetIdx(cmd.IdxOffset + elem_n);
+            const ImU32 ref_vtx_n = ref_cmd.VtxOffset + ref_list->GetIdx(ref_cmd.IdxOffset + elem_n);
+            diff->Idx = (int)(cmd.IdxOffset + elem_n);
+            diff->Vtx = (int)vtx_n;
+            if (vtx_n != ref_vtx_n)
+                return ImGuiDrawGolden_ReportDiff(diff, frame, list, "index to vtx %u (reference: vtx %u)", vtx_n, ref_vtx_n);
+            const ImGuiDrawGoldenVtx vtx = list->GetVtx(vtx_n);
+            const ImGuiDrawGoldenVtx ref_vtx = ref_list->GetVtx(ref_vtx_n);
+            const float values[4] = { vtx.Pos.x, vtx.Pos.y, vtx.Uv.x, vtx.Uv.y };
+            const float ref_values[4] = { ref_vtx.Pos.x, ref_vtx.Pos.y, ref_vtx.Uv.x, ref_vtx.Uv.y };
+            static const char* const value_names[4] = { "pos.x", "pos.y", "uv.x", "uv.y" };
+            for (int n = 0; n < 4; n++)
+                if (!ImGuiDrawGolden_CompareFloat(values[n], ref_values[n], tolerance))
+                    return ImGuiDrawGolden_ReportDiff(diff, frame, list, "%s %f (reference: %f)", value_names[n], values[n], ref_values[n]);
+            if (vtx.Col != ref_vtx.Col)
+                return ImGuiDrawGolden_ReportDiff(diff, frame, list, "col 0x%08X (reference: 0x%08X)", vtx.Col, ref_vtx.Col);
+        }
+        diff->Idx = diff->Vtx = -1;
+        if (cmd.ElemCount != ref_cmd.ElemCount)
+            return ImGuiDrawGolden_ReportDiff(diff, frame, list, "ElemCount %u (reference: %u)", cmd.ElemCount, ref_cmd.ElemCount);
+    }
+    diff->Cmd = -1;
+    if (list->CmdCount != ref_list->CmdCount)
+        return ImGuiDrawGolden_ReportDiff(diff, frame, list, "%d commands (reference: %d)", list->CmdCount, ref_list->CmdCount);
+
+    // Vertices and indices not referenced by any command
+    if (list->VtxCount != ref_list->VtxCount)
+        return ImGuiDrawGolden_ReportDiff(diff, frame, list, "%d vertices (reference: %d)", list->VtxCount, ref_list->VtxCount);
+    if (list->IdxCount != ref_list->IdxCount)
+        return ImGuiDrawGolden_ReportDiff(diff, frame, list, "%d indices (reference: %d)", list->IdxCount, ref_list->IdxCount);
+    return true;
+}
+
+bool ImGuiDrawGolden::Compare(const ImGuiDrawGolden& reference, float tolerance, ImGuiDrawGoldenDiff* out_diff) const
+{
+    ImGuiDrawGoldenDiff diff;
+    const int frames_count = ImMin(FrameOffsets.Size, reference.FrameOffsets.Size);
+    bool ret = true;
+    for (int frame_n = 0; ret && frame_n < frames_count; frame_n++)
+    {
+        // Data was validated by CaptureFrame() or LoadFromFile()
+        diff.Frame = frame_n;
+        ImGuiDrawGoldenReader r(Data.Data + FrameOffsets[frame_n], Data.Data + Data.Size);
+        ImGuiDrawGoldenReader ref_r(reference.Data.Data + reference.FrameOffsets[frame_n], reference.Data.Data + reference.Data.Size);
+        ImGuiDrawGoldenFrame frame, ref_frame;
+        ImGuiDrawGolden_ReadFrame(&r, &frame);
+        ImGuiDrawGolden_ReadFrame(&ref_r, &ref_frame);
+        if (frame.LabelLen != ref_frame.LabelLen || memcmp(frame.Label, ref_frame.Label, (size_t)frame.LabelLen) != 0)
+            ret = ImGuiDrawGolden_ReportDiff(&diff, &frame, NULL, "label (reference: '%.*s')", ref_frame.LabelLen, ref_frame.Label);
+        else if (frame.DisplayPos.x != ref_frame.DisplayPos.x || frame.DisplayPos.y != ref_frame.DisplayPos.y || frame.DisplaySize.x != ref_frame.DisplaySize.x || frame.DisplaySize.y != ref_frame.DisplaySize.y)
+            ret = ImGuiDrawGolden_ReportDiff(&diff, &frame, NULL, "display size %.0fx%.0f (reference: %.0fx%.0f)", frame.DisplaySize.x, frame.DisplaySize.y, ref_frame.DisplaySize.x, ref_frame.DisplaySize.y);
+
+        const int lists_count = ImMin(frame.ListsCount, ref_frame.ListsCount);
+        for (int list_n = 0; ret && list_n < lists_count; list_n++)
+        {
+            diff.DrawList = list_n;
+            ImGuiDrawGoldenList list, ref_list;
+            ImGuiDrawGolden_ReadList(&r, &list);
+            ImGuiDrawGolden_ReadList(&ref_r, &ref_list);
+            ret = ImGuiDrawGolden_CompareList(&frame, &list, &ref_list, tolerance, &diff);
+        }
+        if (!ret)
+            break;
+        diff.DrawList = -1;
+        if (frame.ListsCount != ref_frame.ListsCount)
+            ret = ImGuiDrawGolden_ReportDiff(&diff, &frame, NULL, "%d draw lists (reference: %d)", frame.ListsCount, ref_frame.ListsCount);
+    }
+    if (ret && FrameOffsets.Size != reference.FrameOffsets.Size)
+    {
+        diff.Frame = frames_count;
+        ret = ImGuiDrawGolden_ReportDiff(&diff, NULL, NULL, "%d frames (reference: %d)", FrameOffsets.Size, reference.FrameOffsets.Size);
+    }
+    if (out_diff != NULL)
+        *out_diff = ret ? ImGuiDrawGoldenDiff() : diff;
+    return ret;
+}
+
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
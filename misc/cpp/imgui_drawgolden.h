@@ -0,0 +1,57 @@
+// dear imgui: helper to save ImDrawData of frames to a file (golden output) and compare it with a later run, with float tolerance
+// This is an optional helper, it is not used by the core library.
+
+// Changelog:
+// - v0.10: Initial version. Added ImGuiDrawGolden.
+
+// When optimizing code producing vertices (tessellation, text rendering...), this verifies that the output didn't change:
+// - Run the same scripted frames before and after a change (e.g. example_null_benchmark --golden-save/--golden-compare).
+// - Each captured frame stores all draw lists of ImDrawData: owner window name, vertices (pos, uv, col), indices and
+//   commands (clip rectangle, element count). Texture identifiers and callbacks pointers are not stored.
+// - Compare() walks commands in order and reports the first divergence: frame, draw list (window), command, index and
+//   vertex. Positions, uv and clip rectangles are compared with a tolerance, everything else must be identical.
+// - The file format is compact binary in host byte order, it is not meant to be portable across versions.
+//
+// Usage:
+//   ImGuiDrawGolden golden;
+//   [... for each frame ...]
+//       ImGui::Render();
+//       golden.CaptureFrame(ImGui::GetDrawData(), "my_test");
+//   golden.SaveToFile("my_test.imgolden");         // Before your change
+//
+//   ImGuiDrawGolden reference;                     // After your change, with 'golden' captured again
+//   reference.LoadFromFile("my_test.imgolden");
+//   ImGuiDrawGoldenDiff diff;
+//   if (!golden.Compare(reference, 0.001f, &diff))
+//       printf("%s\n", diff.Desc);
+
+#pragma once
+
+struct ImGuiDrawGoldenDiff
+{
+    int                     Frame;              // Index of first divergent frame, -1 if none
+    int                     DrawList;           // Index in ImDrawData::CmdLists, -1 if not applicable
+    int                     Cmd;                // Index in ImDrawList::CmdBuffer, -1 if not applicable
+    int                     Idx;                // Index in ImDrawList::IdxBuffer, -1 if not applicable
+    int                     Vtx;                // Index in ImDrawList::VtxBuffer (including VtxOffset), -1 if not applicable
+    char                    Desc[512];          // e.g. "frame 12 'demo_window:12 (warmup 30)', draw list 3 'Dear ImGui Demo', cmd 5, idx 1200, vtx 803: pos.y 104.500000 (reference: 104.750000)"
+
+    ImGuiDrawGoldenDiff()   { Frame = DrawList = Cmd = Idx = Vtx = -1; Desc[0] = 0; }
+};
+
+struct ImGuiDrawGolden
+{
+    IMGUI_API void          CaptureFrame(const ImDrawData* draw_data, const char* label);  // Append a frame. 'label' identifies the frame in reports (e.g. test name).
+    IMGUI_API bool          SaveToFile(const char* filename) const;
+    IMGUI_API bool          LoadFromFile(const char* filename);                             // Return false if the file can't be read or is not valid.
+    IMGUI_API bool          Compare(const ImGuiDrawGolden& reference, float tolerance, ImGuiDrawGoldenDiff* out_diff) const; // Return true if frames are identical (within tolerance), otherwise fill 'out_diff' with first divergence.
+    IMGUI_API void          Clear();
+
+    IMGUI_API void          GetFrameLabel(int frame_idx, const char** out_label, const char** out_label_end) const;
+
+    int                     GetFramesCount() const  { return FrameOffsets.Size; }
+
+    // [Internal]
+    ImVector<char>          Data;                   // File contents
+    ImVector<int>           FrameOffsets;           // Offset of each frame in Data
+};
@@ -0,0 +1,130 @@
+// dear imgui: helper to save .ini settings to disk from a background thread (C++11 standard library: std::thread, std::mutex)
+// This is an optional helper, it is not used by the core library.
+
+// Changelog:
+// - v0.10: Initial version. Added ImGuiIniSaver.
+
+#include "imgui.h"
+#include "imgui_internal.h"     // ImFileOpen(), ImFileWrite(), ImFileClose()
+#include "imgui_inisaver.h"
+#include <string.h>             // memcpy
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+// Clang warnings with -Weverything
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wsign-conversion"    // warning: implicit conversion changes signedness
+#endif
+
+// Buffers are only allocated/resized by the UI thread. The writer thread swaps PendingData with WritingData under the lock.
+struct ImGuiIniSaverShared
+{
+    ImVector<char>          Filename;
+    ImVector<char>          PendingData;    // Protected by Mutex. Latest settings to write, written by UI thread.
+    ImVector<char>          WritingData;    // Owned by writer thread while Writing is set.
+    bool                    HasPending;     // Protected by Mutex
+    bool                    Writing;        // Protected by Mutex
+    bool                    Quit;           // Protected by Mutex
+    std::mutex              Mutex;
+    std::condition_variable Cond;
+    std::thread             Thread;
+
+    ImGuiIniSaverShared() : HasPending(false), Writing(false), Quit(false) {}
+};
+
+static void ImGuiIniSaver_RunThread(ImGuiIniSaverShared* shared)
+{
+    std::unique_lock<std::mutex> lock(shared->Mutex);
+    for (;;)
+    {
+        shared->Cond.wait(lock, [shared] { return shared->HasPending || shared->Quit; });
+        if (!shared->HasPending)
+            break; // Quit and everything is written
+        shared->PendingData.swap(shared->WritingData);
+        shared->HasPending = false;
+        shared->Writing = true;
+        lock.unlock();
+
+        if (ImFileHandle f = ImFileOpen(shared->Filename.Data, "wt"))
+        {
+            ImFileWrite(shared->WritingData.Data, sizeof(char), (ImU64)shared->WritingData.Size, f);
+            ImFileClose(f);
+        }
+
+        lock.lock();
+        shared->Writing = false;
+        shared->Cond.notify_all();
+    }
+}
+
+ImGuiIniSaver::ImGuiIniSaver()
+{
+    Shared = NULL;
+}
+
+ImGuiIniSaver::~ImGuiIniSaver()
+{
+    IM_ASSERT(Shared == NULL && "Call Shutdown() before destroying ImGuiIniSaver!");
+}
+
+void ImGuiIniSaver::Init(const char* ini_filename)
+{
+    IM_ASSERT(Shared == NULL && ini_filename != NULL && ini_filename[0] != 0);
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+    ImGui::LoadIniSettingsFromDisk(ini_filename);
+
+    ImGuiIniSaverShared* shared = IM_NEW(ImGuiIniSaverShared)();
+    const int filename_len = (int)strlen(ini_filename);
+    shared->Filename.resize(filename_len + 1);
+    memcpy(shared->Filename.Data, ini_filename, (size_t)filename_len + 1);
+    shared->Thread = std::thread(ImGuiIniSaver_RunThread, shared);
+    Shared = shared;
+}
+
+void ImGuiIniSaver::Update()
+{
+    ImGuiIO& io = ImGui::GetIO();
+    if (Shared == NULL || !io.WantSaveIniSettings)
+        return;
+    io.WantSaveIniSettings = false;
+
+    // Copy settings while holding the lock: writer thread may not use PendingData at this point (it only swaps it under the lock)
+    size_t ini_size = 0;
+    const char* ini_data = ImGui::SaveIniSettingsToMemory(&ini_size);
+    std::lock_guard<std::mutex> lock(Shared->Mutex);
+    Shared->PendingData.resize((int)ini_size);
+    memcpy(Shared->PendingData.Data, ini_data, ini_size);
+    Shared->HasPending = true;
+    Shared->Cond.notify_all();
+}
+
+void ImGuiIniSaver::Shutdown()
+{
+    if (Shared == NULL)
+        return;
+    ImGui::GetIO().WantSaveIniSettings = true;
+    Update();
+    {
+        std::lock_guard<std::mutex> lock(Shared->Mutex);
+        Shared->Quit = true;
+        Shared->Cond.notify_all();
+    }
+    Shared->Thread.join();
+    IM_DELETE(Shared);
+    Shared = NULL;
+}
+
+bool ImGuiIniSaver::IsWriting() const
+{
+    if (Shared == NULL)
+        return false;
+    std::lock_guard<std::mutex> lock(Shared->Mutex);
+    return Shared->HasPending || Shared->Writing;
+}
+
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
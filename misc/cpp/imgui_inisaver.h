@@ -0,0 +1,45 @@
+// dear imgui: helper to save .ini settings to disk from a background thread (C++11 standard library: std::thread, std::mutex)
+// This is an optional helper, it is not used by the core library.
+
+// Changelog:
+// - v0.10: Initial version. Added ImGuiIniSaver.
+
+// When io.IniFilename is set, settings are written to disk by NewFrame() on the UI thread, every io.IniSavingRate seconds
+// when they are modified. Writing the file can stall a frame when it is on a slow drive (e.g. network share).
+// ImGuiIniSaver:
+// - Clears io.IniFilename so the core library only formats settings and sets io.WantSaveIniSettings.
+// - Update() copies settings text (SaveIniSettingsToMemory()) and lets a writer thread write it to disk.
+//   If settings are saved again while the writer thread is busy, only the latest version is written after it.
+// - Shutdown() saves a last time and waits until the file is written. Call it before DestroyContext().
+// - Never touches the Dear ImGui context (nor allocates memory) from the writer thread.
+//
+// Usage:
+//   ImGui::CreateContext();
+//   static ImGuiIniSaver ini_saver;
+//   ini_saver.Init("imgui.ini");               // Load settings, clear io.IniFilename
+//   while (...)
+//   {
+//       ImGui::NewFrame();
+//       ini_saver.Update();
+//       [...]
+//   }
+//   ini_saver.Shutdown();
+//   ImGui::DestroyContext();
+
+#pragma once
+
+struct ImGuiIniSaverShared;
+
+struct ImGuiIniSaver
+{
+    IMGUI_API ImGuiIniSaver();
+    IMGUI_API ~ImGuiIniSaver();
+
+    IMGUI_API void          Init(const char* ini_filename);     // Load settings from file (if it exists), clear io.IniFilename and start writer thread.
+    IMGUI_API void          Update();                           // Call every frame. Hand settings to the writer thread when io.WantSaveIniSettings is set.
+    IMGUI_API void          Shutdown();                         // Save settings a last time, wait for writer thread and stop it.
+    IMGUI_API bool          IsWriting() const;                  // Return true if a save is pending or in progress.
+
+    // [Internal]
+    ImGuiIniSaverShared*    Shared;
+};
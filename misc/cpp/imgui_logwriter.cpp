@@ -0,0 +1,146 @@
+// dear imgui: helper to write captured log output to a file from a background thread (C++11 standard library: std::thread, std::mutex)
+// This is an optional helper, it is not used by the core library.
+
+// Changelog:
+// - v0.10: Initial version. Added ImGuiLogFileWriter.
+
+#include "imgui.h"
+#include "imgui_internal.h"     // LogToCallback(), ImFileOpen(), ImFileWrite(), ImFileClose()
+#include "imgui_logwriter.h"
+#include <string.h>             // memcpy
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+// Clang warnings with -Weverything
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wsign-conversion"    // warning: implicit conversion changes signedness
+#endif
+
+// A capture in progress. Owned by ImGuiLogFileWriter, shared with the writer thread until it is joined.
+// Ring buffer is allocated by the UI thread before starting the writer thread. Positions are in bytes since start of capture.
+struct ImGuiLogFileWriterShared
+{
+    ImFileHandle            File;
+    ImVector<char>          Ring;
+    ImU64                   ReadPos;        // Protected by Mutex. Written by writer thread.
+    ImU64                   WritePos;       // Protected by Mutex. Written by UI thread.
+    bool                    Finishing;      // Protected by Mutex. Set by UI thread: writer thread exits once everything is written.
+    std::mutex              Mutex;
+    std::condition_variable Cond;
+    std::thread             Thread;
+
+    ImGuiLogFileWriterShared() : File(NULL), ReadPos(0), WritePos(0), Finishing(false) {}
+};
+
+static void ImGuiLogFileWriter_RunThread(ImGuiLogFileWriterShared* shared)
+{
+    const ImU64 ring_size = (ImU64)shared->Ring.Size;
+    std::unique_lock<std::mutex> lock(shared->Mutex);
+    for (;;)
+    {
+        shared->Cond.wait(lock, [shared] { return shared->ReadPos != shared->WritePos || shared->Finishing; });
+        if (shared->ReadPos == shared->WritePos)
+            break; // Finishing and everything is written
+
+        // Write contiguous part of pending data without holding the lock
+        const ImU64 read_pos = shared->ReadPos;
+        const ImU64 offset = read_pos % ring_size;
+        const ImU64 size = ImMin(shared->WritePos - read_pos, ring_size - offset);
+        lock.unlock();
+        ImFileWrite(shared->Ring.Data + offset, sizeof(char), size, shared->File);
+        lock.lock();
+        shared->ReadPos = read_pos + size;
+        shared->Cond.notify_all();
+    }
+}
+
+static void ImGuiLogFileWriter_LogCallback(const char* data, int data_size, bool finish, void* user_data)
+{
+    ImGuiLogFileWriter* writer = (ImGuiLogFileWriter*)user_data;
+    ImGuiLogFileWriterShared* shared = writer->Shared;
+    IM_ASSERT(shared != NULL);
+
+    // Copy into ring buffer, waiting for writer thread when it is full
+    const ImU64 ring_size = (ImU64)shared->Ring.Size;
+    while (data_size > 0)
+    {
+        std::unique_lock<std::mutex> lock(shared->Mutex);
+        shared->Cond.wait(lock, [shared, ring_size] { return shared->WritePos - shared->ReadPos < ring_size; });
+        const ImU64 write_pos = shared->WritePos;
+        const ImU64 offset = write_pos % ring_size;
+        const ImU64 size = ImMin(ImMin(ring_size - (write_pos - shared->ReadPos), ring_size - offset), (ImU64)data_size);
+        lock.unlock();
+
+        // Writer thread never reads past WritePos, so we can copy without holding the lock
+        memcpy(shared->Ring.Data + offset, data, (size_t)size);
+        data += size;
+        data_size -= (int)size;
+
+        lock.lock();
+        shared->WritePos = write_pos + size;
+        shared->Cond.notify_all();
+    }
+
+    if (finish)
+    {
+        {
+            std::lock_guard<std::mutex> lock(shared->Mutex);
+            shared->Finishing = true;
+            shared->Cond.notify_all();
+        }
+        shared->Thread.join();
+        ImFileClose(shared->File);
+        IM_DELETE(shared);
+        writer->Shared = NULL;
+    }
+}
+
+ImGuiLogFileWriter::ImGuiLogFileWriter()
+{
+    BufferSize = 4 * 1024 * 1024;
+    Shared = NULL;
+}
+
+ImGuiLogFileWriter::~ImGuiLogFileWriter()
+{
+    IM_ASSERT(Shared == NULL && "Call ImGui::LogFinish() before destroying ImGuiLogFileWriter!");
+}
+
+bool ImGuiLogFileWriter::LogToFile(const char* filename, int auto_open_depth)
+{
+    ImGuiContext& g = *GImGui;
+    if (g.LogEnabled || Shared != NULL)
+        return false;
+    IM_ASSERT(BufferSize > 0);
+
+    // Same as ImGui::LogToFile(): open in binary append mode
+    if (!filename)
+        filename = g.IO.LogFilename;
+    if (!filename || !filename[0])
+        return false;
+    ImFileHandle f = ImFileOpen(filename, "ab");
+    if (!f)
+        return false;
+
+    ImGuiLogFileWriterShared* shared = IM_NEW(ImGuiLogFileWriterShared)();
+    shared->File = f;
+    shared->Ring.resize(BufferSize);
+    shared->Thread = std::thread(ImGuiLogFileWriter_RunThread, shared);
+    Shared = shared;
+    ImGui::LogToCallback(ImGuiLogFileWriter_LogCallback, this, auto_open_depth);
+    return true;
+}
+
+int ImGuiLogFileWriter::GetPendingSize() const
+{
+    if (Shared == NULL)
+        return 0;
+    std::lock_guard<std::mutex> lock(Shared->Mutex);
+    return (int)(Shared->WritePos - Shared->ReadPos);
+}
+
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,39 @@
+// dear imgui: helper to write captured log output to a file from a background thread (C++11 standard library: std::thread, std::mutex)
+// This is an optional helper, it is not used by the core library.
+
+// Changelog:
+// - v0.10: Initial version. Added ImGuiLogFileWriter.
+
+// LogToFile() accumulates text and writes it in chunks of IMGUI_LOG_FLUSH_SIZE bytes, but writes still happen on the UI thread,
+// which can stall frames when capturing a large amount of text to a slow file (e.g. on a network share).
+// ImGuiLogFileWriter:
+// - Captures with ImGui::LogToCallback(): chunks of text are copied into a fixed-size ring buffer, and written to the file by a writer thread.
+// - Memory is bounded: when the ring buffer is full, the UI thread waits for the writer thread to make room (backpressure).
+// - LogFinish() waits until all text has been written and the file is closed.
+// - Never touches the Dear ImGui context (nor allocates memory) from the writer thread.
+//
+// Usage:
+//   static ImGuiLogFileWriter log_writer;
+//   if (ImGui::Button("Capture"))
+//       log_writer.LogToFile("capture.txt");   // Instead of ImGui::LogToFile()
+//   [...]
+//   ImGui::LogFinish();
+
+#pragma once
+
+struct ImGuiLogFileWriterShared;
+
+struct ImGuiLogFileWriter
+{
+    int                     BufferSize;     // Size of ring buffer, allocated by LogToFile(). Default to 4 MB.
+
+    IMGUI_API ImGuiLogFileWriter();
+    IMGUI_API ~ImGuiLogFileWriter();
+
+    IMGUI_API bool          LogToFile(const char* filename = NULL, int auto_open_depth = -1);  // Start logging/capturing text output to given file (default to io.LogFilename). Return false if file couldn't be opened or a capture is already in progress.
+    bool                    IsWriting() const { return Shared != NULL; }
+    IMGUI_API int           GetPendingSize() const;                                             // Number of bytes not written yet.
+
+    // [Internal]
+    ImGuiLogFileWriterShared* Shared;       // Capture in progress, if any
+};
@@ -0,0 +1,185 @@
+// dear imgui: helper to plot values streamed from another thread (C++11 standard library: std::atomic)
+// This is an optional helper, it is not used by the core library.
+
+// Changelog:
+// - v0.10: Initial version. Added ImGuiPlotStream.
+
+#include "imgui.h"
+#include "imgui_internal.h"     // PlotEx(), IMGUI_PLOT_LOD_BLOCK_SIZE
+#include "imgui_plotstream.h"
+#include <string.h>             // memcpy, memset
+#include <atomic>
+
+// Clang warnings with -Weverything
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wsign-conversion"    // warning: implicit conversion changes signedness
+#endif
+
+// Positions are in number of values pushed since Init(), ring buffer index is (position % Values.Size).
+// - WritePos is only written by the producer, after writing values (release): the UI thread may read values up to WritePos.
+// - ReadPos is only written by the UI thread, before reading values (release): the producer may write values up to ReadPos + Values.Size.
+struct ImGuiPlotStreamShared
+{
+    std::atomic<ImU64>      WritePos;
+    std::atomic<ImU64>      ReadPos;
+    std::atomic<int>        DroppedCount;
+
+    ImGuiPlotStreamShared() : WritePos(0), ReadPos(0), DroppedCount(0) {}
+};
+
+static float PlotStream_Getter(void* data, int idx)
+{
+    return ((const ImGuiPlotLod*)data)->GetValue(idx);
+}
+
+ImGuiPlotStream::ImGuiPlotStream()
+{
+    HistoryCount = MarginCount = 0;
+    SnapshotBegin = SnapshotEnd = 0;
+    Shared = NULL;
+    LodUpdatedEnd = 0;
+    LastUpdateFrame = -1;
+}
+
+ImGuiPlotStream::~ImGuiPlotStream()
+{
+    Clear();
+}
+
+void ImGuiPlotStream::Init(int history_count, int margin_count)
+{
+    IM_ASSERT(history_count > 0);
+    if (margin_count < 0)
+        margin_count = history_count;
+    HistoryCount = history_count;
+    MarginCount = margin_count;
+
+    // Capacity is a multiple of block size so blocks of the min/max pyramid map to the same values after wrapping around
+    const int capacity = ((history_count + margin_count + IMGUI_PLOT_LOD_BLOCK_SIZE - 1) / IMGUI_PLOT_LOD_BLOCK_SIZE) * IMGUI_PLOT_LOD_BLOCK_SIZE;
+    Values.resize(capacity);
+    memset(Values.Data, 0, (size_t)Values.size_in_bytes());
+    Lod.Build(Values.Data, Values.Size);
+    if (Shared == NULL)
+        Shared = IM_NEW(ImGuiPlotStreamShared)();
+    Shared->WritePos.store(0);
+    Shared->ReadPos.store(0);
+    Shared->DroppedCount.store(0);
+    SnapshotBegin = SnapshotEnd = 0;
+    LodUpdatedEnd = 0;
+    LastUpdateFrame = -1;
+}
+
+void ImGuiPlotStream::Clear()
+{
+    if (Shared != NULL)
+        IM_DELETE(Shared);
+    Shared = NULL;
+    Values.clear();
+    Lod.Clear();
+    HistoryCount = MarginCount = 0;
+    SnapshotBegin = SnapshotEnd = 0;
+    LodUpdatedEnd = 0;
+}
+
+int ImGuiPlotStream::Push(const float* values, int values_count)
+{
+    IM_ASSERT(Shared != NULL && "Call Init() before pushing values!");
+    IM_ASSERT(values_count >= 0);
+    const ImU64 write_pos = Shared->WritePos.load(std::memory_order_relaxed);
+    const ImU64 read_pos = Shared->ReadPos.load(std::memory_order_acquire);
+    const ImU64 capacity = (ImU64)Values.Size;
+    const ImU64 available = read_pos + capacity - write_pos;
+    const int push_count = ((ImU64)values_count < available) ? values_count : (int)available;
+    if (push_count < values_count)
+        Shared->DroppedCount.fetch_add(values_count - push_count, std::memory_order_relaxed);
+    if (push_count == 0)
+        return 0;
+
+    // Copy in up to two parts, as we may wrap around the end of the ring buffer
+    const int idx = (int)(write_pos % capacity);
+    const int count_0 = (push_count < Values.Size - idx) ? push_count : Values.Size - idx;
+    memcpy(Values.Data + idx, values, (size_t)count_0 * sizeof(float));
+    if (count_0 < push_count)
+        memcpy(Values.Data, values + count_0, (size_t)(push_count - count_0) * sizeof(float));
+    Shared->WritePos.store(write_pos + (ImU64)push_count, std::memory_order_release);
+    return push_count;
+}
+
+void ImGuiPlotStream::Update()
+{
+    IM_ASSERT(Shared != NULL && "Call Init() before Update()!");
+    LastUpdateFrame = ImGui::GetCurrentContext() ? ImGui::GetFrameCount() : -1;
+
+    // Publish start of snapshot before reading values: producer won't overwrite them until next Update()
+    const ImU64 write_pos = Shared->WritePos.load(std::memory_order_acquire);
+    const ImU64 begin = (write_pos > (ImU64)HistoryCount) ? write_pos - (ImU64)HistoryCount : 0;
+    Shared->ReadPos.store(begin, std::memory_order_release);
+    SnapshotBegin = begin;
+    SnapshotEnd = write_pos;
+
+    // Update min/max pyramid for blocks which have been completed since last Update().
+    // Only complete blocks inside the snapshot are updated, as the producer may be writing to other blocks.
+    // Partial blocks at both ends of the snapshot are read from values by ImGuiPlotLod::GetMinMax().
+    const ImU64 block_size = IMGUI_PLOT_LOD_BLOCK_SIZE;
+    const ImU64 begin_block_aligned = ((begin + block_size - 1) / block_size) * block_size;
+    ImU64 update_begin = (LodUpdatedEnd > begin_block_aligned) ? LodUpdatedEnd : begin_block_aligned;
+    const ImU64 update_end = (write_pos / block_size) * block_size;
+    const ImU64 capacity = (ImU64)Values.Size;
+    while (update_begin < update_end)
+    {
+        const int idx_begin = (int)(update_begin % capacity);
+        const ImU64 count = ImMin(update_end - update_begin, capacity - (ImU64)idx_begin);
+        Lod.UpdateRange(idx_begin, idx_begin + (int)count);
+        update_begin += count;
+    }
+    if (update_end > LodUpdatedEnd)
+        LodUpdatedEnd = update_end;
+}
+
+bool ImGuiPlotStream::GetMinMax(float* out_min, float* out_max) const
+{
+    float v_min = FLT_MAX, v_max = -FLT_MAX;
+    const ImU64 capacity = (ImU64)Values.Size;
+    ImU64 pos = SnapshotBegin;
+    while (pos < SnapshotEnd)
+    {
+        const int idx_begin = (int)(pos % capacity);
+        const ImU64 count = ImMin(SnapshotEnd - pos, capacity - (ImU64)idx_begin);
+        float range_min, range_max;
+        if (Lod.GetMinMax(idx_begin, idx_begin + (int)count, &range_min, &range_max))
+        {
+            v_min = ImMin(v_min, range_min);
+            v_max = ImMax(v_max, range_max);
+        }
+        pos += count;
+    }
+    *out_min = v_min;
+    *out_max = v_max;
+    return v_min <= v_max;
+}
+
+int ImGuiPlotStream::GetDroppedCount() const
+{
+    return Shared ? Shared->DroppedCount.load(std::memory_order_relaxed) : 0;
+}
+
+void ImGuiPlotStream::PlotLines(const char* label, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size)
+{
+    if (LastUpdateFrame != ImGui::GetFrameCount())
+        Update();
+    const int values_offset = (int)(SnapshotBegin % (ImU64)Values.Size);
+    ImGui::PlotEx(ImGuiPlotType_Lines, label, &PlotStream_Getter, (void*)&Lod, GetCount(), values_offset, overlay_text, scale_min, scale_max, graph_size, &Lod);
+}
+
+void ImGuiPlotStream::PlotHistogram(const char* label, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size)
+{
+    if (LastUpdateFrame != ImGui::GetFrameCount())
+        Update();
+    const int values_offset = (int)(SnapshotBegin % (ImU64)Values.Size);
+    ImGui::PlotEx(ImGuiPlotType_Histogram, label, &PlotStream_Getter, (void*)&Lod, GetCount(), values_offset, overlay_text, scale_min, scale_max, graph_size, &Lod);
+}
+
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
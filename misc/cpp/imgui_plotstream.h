@@ -0,0 +1,66 @@
+// dear imgui: helper to plot values streamed from another thread (C++11 standard library: std::atomic)
+// This is an optional helper, it is not used by the core library.
+
+// Changelog:
+// - v0.10: Initial version. Added ImGuiPlotStream.
+
+// Plotting the last N values of a circular buffer with PlotLines(values, count, values_offset) requires
+// the UI thread to copy (or lock) the buffer, and scans all values every frame when scale_min/scale_max are FLT_MAX.
+// ImGuiPlotStream:
+// - Is a lock-free single-producer ring buffer: one data thread calls Push(), the UI thread calls Update() and plots.
+// - Is plotted without copying: the UI thread reads a snapshot (last HistoryCount values) directly from the ring buffer.
+//   The producer never overwrites values of the current snapshot, it drops new values instead if the ring buffer is full
+//   (this only happens if the UI thread doesn't call Update() while more than MarginCount values are pushed).
+// - Maintains a min/max pyramid (ImGuiPlotLod) incrementally: Update() is O(new values), plotting and GetMinMax() are O(log(n))
+//   per pixel column, so history can contain millions of values.
+// - Never touches the Dear ImGui context from the producer thread.
+//
+// Usage:
+//   static ImGuiPlotStream stream;
+//   stream.Init(100000);                                      // Before starting the producer thread
+//   [producer thread]
+//   stream.Push(samples, samples_count);
+//   [UI thread]
+//   stream.PlotLines("Telemetry", NULL, FLT_MAX, FLT_MAX, ImVec2(0, 80.0f));   // Calls Update() if it wasn't called this frame
+
+#pragma once
+
+struct ImGuiPlotStreamShared;
+
+struct ImGuiPlotStream
+{
+    // Ring buffer (values are written by the producer thread)
+    ImVector<float>     Values;             // Ring buffer storage. Size is a multiple of IMGUI_PLOT_LOD_BLOCK_SIZE, >= HistoryCount + MarginCount.
+    int                 HistoryCount;       // Number of values plotted (most recent ones)
+    int                 MarginCount;        // Number of values which can be pushed between two calls to Update() without dropping any
+
+    // Snapshot (owned by the UI thread, set by Update())
+    ImU64               SnapshotBegin;      // Position of first value of the snapshot, in number of values pushed since Init()
+    ImU64               SnapshotEnd;        // Position after last value of the snapshot
+    ImGuiPlotLod        Lod;                // Min/max pyramid over Values[], only valid for blocks inside the snapshot
+
+    IMGUI_API ImGuiPlotStream();
+    IMGUI_API ~ImGuiPlotStream();
+
+    // Setup. Not thread-safe: call before starting the producer thread (or while it is stopped).
+    IMGUI_API void      Init(int history_count, int margin_count = -1); // Default margin_count = history_count.
+    IMGUI_API void      Clear();                                        // Free all memory.
+
+    // Producer thread (one thread at a time)
+    IMGUI_API int       Push(const float* values, int values_count);    // Return number of values pushed. Values not fitting in the ring buffer are dropped.
+    bool                Push(float value)           { return Push(&value, 1) == 1; }
+
+    // UI thread
+    IMGUI_API void      Update();                                       // Take a snapshot of the last HistoryCount values and update min/max pyramid. Call once per frame.
+    int                 GetCount() const            { return (int)(SnapshotEnd - SnapshotBegin); }
+    float               GetValue(int idx) const     { return Values.Data[(SnapshotBegin + (ImU64)idx) % (ImU64)Values.Size]; } // 0 <= idx < GetCount()
+    IMGUI_API bool      GetMinMax(float* out_min, float* out_max) const; // Min/max of snapshot. O(log(n)). Return false if there are no values (or only NaN).
+    IMGUI_API int       GetDroppedCount() const;                        // Total number of values dropped because ring buffer was full.
+    IMGUI_API void      PlotLines(const char* label, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0));
+    IMGUI_API void      PlotHistogram(const char* label, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0));
+
+    // [Internal]
+    ImGuiPlotStreamShared* Shared;          // Positions shared with the producer thread (atomics)
+    ImU64               LodUpdatedEnd;      // Position up to which Lod blocks have been updated
+    int                 LastUpdateFrame;
+};
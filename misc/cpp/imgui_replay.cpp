@@ -0,0 +1,500 @@
+// dear imgui: helper to record inputs of a session and replay them with identical frames (e.g. headless, to profile a slowdown)
+// This is an optional helper, it is not used by the core library.
+
+// Changelog:
+// - v0.10: Initial version. Added ImGuiReplay.
+
+#include "imgui.h"
+#include "imgui_internal.h"     // g.InputEventsQueue, AddContextHook(), ImFileOpen()
+#include "imgui_replay.h"
+#include <string.h>             // memcpy, memcmp
+
+// Clang warnings with -Weverything
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wsign-conversion"    // warning: implicit conversion changes signedness
+#endif
+
+// File layout (host byte order):
+// - Header: "IMREPLAY", u32 version, u32 frames count, i32 io.ConfigFlags, u32 ini size, ini data.
+// - Each frame: u32 ImDrawData hash (0: none), f32 io.DeltaTime, f32 x2 io.DisplaySize, u32 events count, events,
+//   u32 application state size, application state data.
+// - Each event: u8 type, u8 source, then payload depending on type.
+static const char   IMGUI_REPLAY_MAGIC[8] = { 'I', 'M', 'R', 'E', 'P', 'L', 'A', 'Y' };
+static const ImU32  IMGUI_REPLAY_VERSION = 1;
+static const int    IMGUI_REPLAY_FRAMES_COUNT_OFFSET = 12;
+static const int    IMGUI_REPLAY_MIN_FRAME_SIZE = 4 + 4 + 4 * 2 + 4 + 4;  // Frame without events nor application state
+
+template<typename T>
+static void ImGuiReplay_Write(ImVector<char>* buf, T value)
+{
+    const int offset = buf->Size;
+    buf->resize(offset + (int)sizeof(T));
+    memcpy(buf->Data + offset, &value, sizeof(T));
+}
+
+struct ImGuiReplayReader
+{
+    const char*     P;
+    const char*     End;
+    bool            Error;
+
+    ImGuiReplayReader(const char* p, const char* end) { P = p; End = end; Error = false; }
+    template<typename T> T Read()
+    {
+        T value;
+        memset(&value, 0, sizeof(T));
+        if ((size_t)(End - P) < sizeof(T)) { Error = true; return value; }
+        memcpy(&value, P, sizeof(T));
+        P += sizeof(T);
+        return value;
+    }
+    const char* Skip(ImU32 size)
+    {
+        if ((size_t)(End - P) < size) { Error = true; return NULL; }
+        const char* p = P;
+        P += size;
+        return p;
+    }
+};
+
+static void ImGuiReplay_WriteEvent(ImVector<char>* buf, const ImGuiInputEvent* e)
+{
+    ImGuiReplay_Write<ImU8>(buf, (ImU8)e->Type);
+    ImGuiReplay_Write<ImU8>(buf, (ImU8)e->Source);
+    switch (e->Type)
+    {
+    case ImGuiInputEventType_MousePos:
+        ImGuiReplay_Write<float>(buf, e->MousePos.PosX);
+        ImGuiReplay_Write<float>(buf, e->MousePos.PosY);
+        ImGuiReplay_Write<ImU8>(buf, (ImU8)e->MousePos.MouseSource);
+        break;
+    case ImGuiInputEventType_MouseWheel:
+        ImGuiReplay_Write<float>(buf, e->MouseWheel.WheelX);
+        ImGuiReplay_Write<float>(buf, e->MouseWheel.WheelY);
+        ImGuiReplay_Write<ImU8>(buf, (ImU8)e->MouseWheel.MouseSource);
+        break;
+    case ImGuiInputEventType_MouseButton:
+        ImGuiReplay_Write<ImU8>(buf, (ImU8)e->MouseButton.Button);
+        ImGuiReplay_Write<ImU8>(buf, (ImU8)e->MouseButton.Down);
+        ImGuiReplay_Write<ImU8>(buf, (ImU8)e->MouseButton.MouseSource);
+        break;
+    case ImGuiInputEventType_Key:
+        ImGuiReplay_Write<ImU32>(buf, (ImU32)e->Key.Key);
+        ImGuiReplay_Write<ImU8>(buf, (ImU8)e->Key.Down);
+        ImGuiReplay_Write<float>(buf, e->Key.AnalogValue);
+        break;
+    case ImGuiInputEventType_Text:
+        ImGuiReplay_Write<ImU32>(buf, e->Text.Char);
+        break;
+    case ImGuiInputEventType_Focus:
+        ImGuiReplay_Write<ImU8>(buf, (ImU8)e->AppFocused.Focused);
+        break;
+    default:
+        IM_ASSERT(0);
+    }
+}
+
+static bool ImGuiReplay_ReadEvent(ImGuiReplayReader* r, ImGuiInputEvent* e)
+{
+    // Values are validated before being cast to enums
+    const ImU8 type = r->Read<ImU8>();
+    const ImU8 source = r->Read<ImU8>();
+    if (type >= ImGuiInputEventType_COUNT || source >= ImGuiInputSource_COUNT)
+        return false;
+    e->Type = (ImGuiInputEventType)type;
+    e->Source = (ImGuiInputSource)source;
+    ImU8 mouse_source = 0;
+    switch (e->Type)
+    {
+    case ImGuiInputEventType_MousePos:
+        e->MousePos.PosX = r->Read<float>();
+        e->MousePos.PosY = r->Read<float>();
+        if ((mouse_source = r->Read<ImU8>()) >= ImGuiMouseSource_COUNT)
+            return false;
+        e->MousePos.MouseSource = (ImGuiMouseSource)mouse_source;
+        break;
+    case ImGuiInputEventType_MouseWheel:
+        e->MouseWheel.WheelX = r->Read<float>();
+        e->MouseWheel.WheelY = r->Read<float>();
+        if ((mouse_source = r->Read<ImU8>()) >= ImGuiMouseSource_COUNT)
+            return false;
+        e->MouseWheel.MouseSource = (ImGuiMouseSource)mouse_source;
+        break;
+    case ImGuiInputEventType_MouseButton:
+        e->MouseButton.Button = r->Read<ImU8>();
+        e->MouseButton.Down = r->Read<ImU8>() != 0;
+        if ((mouse_source = r->Read<ImU8>()) >= ImGuiMouseSource_COUNT)
+            return false;
+        e->MouseButton.MouseSource = (ImGuiMouseSource)mouse_source;
+        if (e->MouseButton.Button >= ImGuiMouseButton_COUNT)
+            return false;
+        break;
+    case ImGuiInputEventType_Key:
+    {
+        const ImU32 key = r->Read<ImU32>();
+        if (!ImGui::IsNamedKeyOrMod((ImGuiKey)key))
+            return false;
+        e->Key.Key = (ImGuiKey)key;
+        e->Key.Down = r->Read<ImU8>() != 0;
+        e->Key.AnalogValue = r->Read<float>();
+        break;
+    }
+    case ImGuiInputEventType_Text:
+        e->Text.Char = r->Read<ImU32>();
+        break;
+    case ImGuiInputEventType_Focus:
+        e->AppFocused.Focused = r->Read<ImU8>() != 0;
+        break;
+    default:
+        return false;
+    }
+    return !r->Error;
+}
+
+static bool ImGuiReplay_ReadHeader(ImGuiReplayReader* r, int* out_frames_count, ImGuiConfigFlags* out_config_flags, const char** out_ini_data, int* out_ini_size)
+{
+    const char* magic = r->Skip(sizeof(IMGUI_REPLAY_MAGIC));
+    if (magic == NULL || memcmp(magic, IMGUI_REPLAY_MAGIC, sizeof(IMGUI_REPLAY_MAGIC)) != 0)
+        return false;
+    if (r->Read<ImU32>() != IMGUI_REPLAY_VERSION)
+        return false;
+    *out_frames_count = (int)r->Read<ImU32>();
+    *out_config_flags = (ImGuiConfigFlags)r->Read<ImS32>();
+    const ImU32 ini_size = r->Read<ImU32>();
+    *out_ini_data = r->Skip(ini_size);
+    *out_ini_size = (int)ini_size;
+    return !r->Error;
+}
+
+// Read one frame. Events are appended to 'out_events' (without EventId).
+static bool ImGuiReplay_ReadFrame(ImGuiReplayReader* r, ImU32* out_hash, float* out_delta_time, ImVec2* out_display_size, ImVector<ImGuiInputEvent>* out_events, const char** out_app_state, int* out_app_state_size)
+{
+    *out_hash = r->Read<ImU32>();
+    *out_delta_time = r->Read<float>();
+    out_display_size->x = r->Read<float>();
+    out_display_size->y = r->Read<float>();
+    const ImU32 events_count = r->Read<ImU32>();
+    if (!(*out_delta_time >= 0.0f) || !(out_display_size->x >= 0.0f && out_display_size->y >= 0.0f)) // DeltaTime may be 0 on first frame
+        return false;
+    if (r->Error || events_count > (ImU32)(r->End - r->P) / 3) // Smallest event is 3 bytes
+        return false;
+    for (ImU32 n = 0; n < events_count; n++)
+    {
+        ImGuiInputEvent e;
+        if (!ImGuiReplay_ReadEvent(r, &e))
+            return false;
+        out_events->push_back(e);
+    }
+    const ImU32 app_state_size = r->Read<ImU32>();
+    *out_app_state = r->Skip(app_state_size);
+    *out_app_state_size = (int)app_state_size;
+    return !r->Error;
+}
+
+static ImU32 ImGuiReplay_HashDrawData(ImGuiContext* ctx)
+{
+    // Texture identifiers are not hashed as they are generally pointers or handles provided by the backend.
+    ImGuiID hash = 0;
+    for (ImGuiViewportP* viewport : ctx->Viewports)
+    {
+        const ImDrawData* draw_data = &viewport->DrawDataP;
+        if (!draw_data->Valid)
+            continue;
+        for (const ImDrawList* draw_list : draw_data->CmdLists)
+        {
+            hash = ImHashData(draw_list->VtxBuffer.Data, (size_t)draw_list->VtxBuffer.size_in_bytes(), hash);
+            hash = ImHashData(draw_list->IdxBuffer.Data, (size_t)draw_list->IdxBuffer.size_in_bytes(), hash);
+            for (const ImDrawCmd& cmd : draw_list->CmdBuffer)
+            {
+                const ImU32 cmd_data[3] = { cmd.VtxOffset, cmd.IdxOffset, cmd.ElemCount };
+                hash = ImHashData(&cmd.ClipRect, sizeof(cmd.ClipRect), hash);
+                hash = ImHashData(cmd_data, sizeof(cmd_data), hash);
+            }
+        }
+    }
+    return (hash != 0) ? hash : 1; // 0 means no hash
+}
+
+static void ImGuiReplay_RecordFrame(ImGuiReplay* replay, ImGuiContext* ctx)
+{
+    ImGuiContext& g = *ctx;
+    ImVector<char>* buf = &replay->Data;
+    replay->FrameOffsets.push_back(buf->Size);
+    replay->RecordHashOffset = replay->HashDrawData ? buf->Size : -1;
+    ImGuiReplay_Write<ImU32>(buf, 0); // Written by RenderPost hook
+    ImGuiReplay_Write<float>(buf, g.IO.DeltaTime);
+    ImGuiReplay_Write<float>(buf, g.IO.DisplaySize.x);
+    ImGuiReplay_Write<float>(buf, g.IO.DisplaySize.y);
+
+    // Events not processed yet by previous frame were already recorded
+    ImU32 events_count = 0;
+    for (const ImGuiInputEvent& e : g.InputEventsQueue)
+        if (e.EventId >= replay->RecordNextEventId)
+            events_count++;
+    ImGuiReplay_Write<ImU32>(buf, events_count);
+    for (const ImGuiInputEvent& e : g.InputEventsQueue)
+        if (e.EventId >= replay->RecordNextEventId)
+            ImGuiReplay_WriteEvent(buf, &e);
+    replay->RecordNextEventId = g.InputEventsNextEventId;
+
+    const int app_state_size_offset = buf->Size;
+    ImGuiReplay_Write<ImU32>(buf, 0);
+    if (replay->SaveAppStateFunc != NULL)
+    {
+        replay->SaveAppStateFunc(replay, buf);
+        const ImU32 app_state_size = (ImU32)(buf->Size - app_state_size_offset - (int)sizeof(ImU32));
+        memcpy(buf->Data + app_state_size_offset, &app_state_size, sizeof(ImU32));
+    }
+
+    // Keep header valid so SaveToFile() can be called while recording
+    const ImU32 frames_count = (ImU32)replay->FrameOffsets.Size;
+    memcpy(buf->Data + IMGUI_REPLAY_FRAMES_COUNT_OFFSET, &frames_count, sizeof(ImU32));
+}
+
+static void ImGuiReplay_ReplayFrame(ImGuiReplay* replay, ImGuiContext* ctx)
+{
+    ImGuiContext& g = *ctx;
+
+    // Discard events submitted by the application since last frame
+    for (int n = g.InputEventsQueue.Size - 1; n >= 0; n--)
+        if (g.InputEventsQueue[n].EventId >= replay->ReplayNextEventId)
+            g.InputEventsQueue.erase(&g.InputEventsQueue[n]);
+
+    replay->ReplayFrameHash = 0;
+    if (replay->IsReplayDone())
+        return;
+
+    // Frames were validated by LoadFromFile()
+    ImGuiReplayReader r(replay->Data.Data + replay->FrameOffsets[replay->ReplayFrameIdx], replay->Data.Data + replay->Data.Size);
+    const int events_start = g.InputEventsQueue.Size;
+    const char* app_state = NULL;
+    int app_state_size = 0;
+    bool ret = ImGuiReplay_ReadFrame(&r, &replay->ReplayFrameHash, &g.IO.DeltaTime, &g.IO.DisplaySize, &g.InputEventsQueue, &app_state, &app_state_size);
+    IM_ASSERT(ret);
+    IM_UNUSED(ret);
+    for (int n = events_start; n < g.InputEventsQueue.Size; n++)
+        g.InputEventsQueue[n].EventId = g.InputEventsNextEventId++;
+    replay->ReplayNextEventId = g.InputEventsNextEventId;
+    if (replay->LoadAppStateFunc != NULL)
+        replay->LoadAppStateFunc(replay, app_state, app_state_size);
+    replay->ReplayFrameIdx++;
+}
+
+static void ImGuiReplay_NewFramePreHook(ImGuiContext* ctx, ImGuiContextHook* hook)
+{
+    ImGuiReplay* replay = (ImGuiReplay*)hook->UserData;
+    if (replay->IsRecording())
+        ImGuiReplay_RecordFrame(replay, ctx);
+    else if (replay->IsReplaying())
+        ImGuiReplay_ReplayFrame(replay, ctx);
+}
+
+static void ImGuiReplay_RenderPostHook(ImGuiContext* ctx, ImGuiContextHook* hook)
+{
+    ImGuiReplay* replay = (ImGuiReplay*)hook->UserData;
+    if (replay->IsRecording() && replay->RecordHashOffset != -1)
+    {
+        const ImU32 hash = ImGuiReplay_HashDrawData(ctx);
+        memcpy(replay->Data.Data + replay->RecordHashOffset, &hash, sizeof(ImU32));
+        replay->RecordHashOffset = -1;
+    }
+    else if (replay->IsReplaying() && replay->ReplayFrameHash != 0)
+    {
+        if (replay->HashDrawData && ImGuiReplay_HashDrawData(ctx) != replay->ReplayFrameHash)
+        {
+            if (replay->HashMismatchCount++ == 0)
+                replay->FirstHashMismatchFrame = replay->ReplayFrameIdx - 1;
+        }
+        replay->ReplayFrameHash = 0;
+    }
+}
+
+static void ImGuiReplay_AddHooks(ImGuiReplay* replay)
+{
+    ImGuiContextHook hook;
+    hook.UserData = replay;
+    hook.Type = ImGuiContextHookType_NewFramePre;
+    hook.Callback = ImGuiReplay_NewFramePreHook;
+    replay->HookIds[0] = ImGui::AddContextHook(replay->Ctx, &hook);
+    hook.Type = ImGuiContextHookType_RenderPost;
+    hook.Callback = ImGuiReplay_RenderPostHook;
+    replay->HookIds[1] = ImGui::AddContextHook(replay->Ctx, &hook);
+}
+
+static void ImGuiReplay_RemoveHooks(ImGuiReplay* replay)
+{
+    for (ImGuiID& hook_id : replay->HookIds)
+    {
+        ImGui::RemoveContextHook(replay->Ctx, hook_id);
+        hook_id = 0;
+    }
+}
+
+ImGuiReplay::ImGuiReplay()
+{
+    HashDrawData = true;
+    SaveAppStateFunc = NULL;
+    LoadAppStateFunc = NULL;
+    UserData = NULL;
+    Ctx = NULL;
+    Mode = 0;
+    HookIds[0] = HookIds[1] = 0;
+    Clear();
+}
+
+ImGuiReplay::~ImGuiReplay()
+{
+    IM_ASSERT(Mode == 0 && "Call StopRecording()/StopReplay() before destroying ImGuiReplay!");
+}
+
+void ImGuiReplay::Clear()
+{
+    IM_ASSERT(Mode == 0);
+    Data.clear();
+    FrameOffsets.clear();
+    RecordNextEventId = 0;
+    RecordHashOffset = -1;
+    ReplayFrameIdx = 0;
+    ReplayNextEventId = 0;
+    ReplayFrameHash = 0;
+    HashMismatchCount = 0;
+    FirstHashMismatchFrame = -1;
+}
+
+void ImGuiReplay::StartRecording()
+{
+    IM_ASSERT(Mode == 0 && "Already recording or replaying!");
+    ImGuiContext& g = *ImGui::GetCurrentContext();
+    Clear();
+    Ctx = &g;
+
+    // Settings are normally loaded by the first NewFrame(): load them now so they are recorded
+    if (!g.SettingsLoaded && g.IO.IniFilename != NULL)
+        ImGui::LoadIniSettingsFromDisk(g.IO.IniFilename);
+    size_t ini_size = 0;
+    const char* ini_data = ImGui::SaveIniSettingsToMemory(&ini_size);
+
+    Data.reserve(64 * 1024);
+    for (char c : IMGUI_REPLAY_MAGIC)
+        Data.push_back(c);
+    ImGuiReplay_Write<ImU32>(&Data, IMGUI_REPLAY_VERSION);
+    IM_ASSERT(Data.Size == IMGUI_REPLAY_FRAMES_COUNT_OFFSET);
+    ImGuiReplay_Write<ImU32>(&Data, 0);
+    ImGuiReplay_Write<ImS32>(&Data, (ImS32)g.IO.ConfigFlags);
+    ImGuiReplay_Write<ImU32>(&Data, (ImU32)ini_size);
+    const int ini_offset = Data.Size;
+    Data.resize(ini_offset + (int)ini_size);
+    if (ini_size > 0)
+        memcpy(Data.Data + ini_offset, ini_data, ini_size);
+
+    // Events already queued for next frame are recorded with it
+    RecordNextEventId = 0;
+    Mode = 1;
+    ImGuiReplay_AddHooks(this);
+}
+
+void ImGuiReplay::StopRecording()
+{
+    IM_ASSERT(Mode == 1);
+    ImGuiReplay_RemoveHooks(this);
+    Mode = 0;
+}
+
+bool ImGuiReplay::SaveToFile(const char* filename) const
+{
+    if (Data.Size == 0)
+        return false;
+    ImFileHandle f = ImFileOpen(filename, "wb");
+    if (f == NULL)
+        return false;
+    const bool ret = ImFileWrite(Data.Data, 1, (ImU64)Data.Size, f) == (ImU64)Data.Size;
+    ImFileClose(f);
+    return ret;
+}
+
+bool ImGuiReplay::LoadFromFile(const char* filename)
+{
+    IM_ASSERT(Mode == 0);
+    Clear();
+    size_t file_size = 0;
+    char* file_data = (char*)ImFileLoadToMemory(filename, "rb", &file_size);
+    if (file_data == NULL)
+        return false;
+    if (file_size > INT_MAX)
+    {
+        IM_FREE(file_data);
+        return false;
+    }
+    Data.resize((int)file_size);
+    memcpy(Data.Data, file_data, file_size);
+    IM_FREE(file_data);
+
+    // Validate everything now, so replaying doesn't have to
+    ImGuiReplayReader r(Data.Data, Data.Data + Data.Size);
+    int frames_count = 0;
+    ImGuiConfigFlags config_flags = 0;
+    const char* ini_data = NULL;
+    int ini_size = 0;
+    bool ret = ImGuiReplay_ReadHeader(&r, &frames_count, &config_flags, &ini_data, &ini_size);
+    ImVector<ImGuiInputEvent> events;
+    if (ret && frames_count >= 0 && frames_count <= (int)(r.End - r.P) / IMGUI_REPLAY_MIN_FRAME_SIZE)
+        FrameOffsets.reserve(frames_count);
+    else
+        ret = false;
+    for (int n = 0; ret && n < frames_count; n++)
+    {
+        FrameOffsets.push_back((int)(r.P - Data.Data));
+        ImU32 hash;
+        float delta_time;
+        ImVec2 display_size;
+        const char* app_state;
+        int app_state_size;
+        events.resize(0);
+        ret = ImGuiReplay_ReadFrame(&r, &hash, &delta_time, &display_size, &events, &app_state, &app_state_size);
+    }
+    if (!ret)
+        Clear();
+    return ret;
+}
+
+void ImGuiReplay::StartReplay()
+{
+    IM_ASSERT(Mode == 0 && "Already recording or replaying!");
+    IM_ASSERT(Data.Size > 0 && "Call LoadFromFile() first!");
+    ImGuiContext& g = *ImGui::GetCurrentContext();
+    Ctx = &g;
+
+    ImGuiReplayReader r(Data.Data, Data.Data + Data.Size);
+    int frames_count = 0;
+    ImGuiConfigFlags config_flags = 0;
+    const char* ini_data = NULL;
+    int ini_size = 0;
+    bool ret = ImGuiReplay_ReadHeader(&r, &frames_count, &config_flags, &ini_data, &ini_size);
+    IM_ASSERT(ret);
+    IM_UNUSED(ret);
+    g.IO.IniFilename = NULL; // Don't load nor overwrite your settings
+    g.IO.ConfigFlags = config_flags;
+    if (ini_size > 0)
+        ImGui::LoadIniSettingsFromMemory(ini_data, (size_t)ini_size);
+
+    g.InputEventsQueue.resize(0);
+    ReplayNextEventId = g.InputEventsNextEventId;
+    ReplayFrameIdx = 0;
+    ReplayFrameHash = 0;
+    HashMismatchCount = 0;
+    FirstHashMismatchFrame = -1;
+    Mode = 2;
+    ImGuiReplay_AddHooks(this);
+}
+
+void ImGuiReplay::StopReplay()
+{
+    IM_ASSERT(Mode == 2);
+    ImGuiReplay_RemoveHooks(this);
+    Mode = 0;
+}
+
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,79 @@
+// dear imgui: helper to record inputs of a session and replay them with identical frames (e.g. headless, to profile a slowdown)
+// This is an optional helper, it is not used by the core library.
+
+// Changelog:
+// - v0.10: Initial version. Added ImGuiReplay.
+
+// Recording is done with context hooks, so it doesn't require changes to your main loop:
+// - At the start of NewFrame(): io.DeltaTime, io.DisplaySize, input events queued since last frame (before they are
+//   processed, see g.InputEventsQueue) and optional application state written by SaveAppStateFunc().
+// - At the end of Render(): optional hash of ImDrawData contents, to verify that replayed frames are identical.
+// - StartRecording() also stores .ini settings and io.ConfigFlags, which are restored by StartReplay().
+// Replaying:
+// - Each NewFrame() consumes one recorded frame: events are injected into the queue, io.DeltaTime and io.DisplaySize are
+//   overwritten, LoadAppStateFunc() is called. Events submitted by your backend in the meanwhile are discarded.
+// - For identical frames: start recording right after CreateContext() (before the first NewFrame()), and replay into a
+//   new context with the same fonts, style and UI code. Clipboard and other platform functions are not recorded.
+// - The file format is compact binary in host byte order, it is not meant to be portable across versions.
+//
+// Usage:
+//   static ImGuiReplay recorder;                   // Recording, in your application
+//   recorder.StartRecording();
+//   [... run frames ...]
+//   recorder.StopRecording();
+//   recorder.SaveToFile("session.imreplay");
+//
+//   ImGuiReplay player;                            // Replaying, e.g. with example_null_benchmark --replay
+//   player.LoadFromFile("session.imreplay");
+//   player.StartReplay();
+//   while (!player.IsReplayDone())
+//   {
+//       ImGui::NewFrame();
+//       [... same UI code ...]
+//       ImGui::Render();
+//   }
+//   player.StopReplay();                           // player.HashMismatchCount > 0 if frames were not identical
+
+#pragma once
+
+struct ImGuiReplay
+{
+    // Options
+    bool                    HashDrawData;       // = true. When recording: store a hash of ImDrawData contents after each Render(). When replaying: compare with it.
+    void                    (*SaveAppStateFunc)(ImGuiReplay* replay, ImVector<char>* out_data);         // Optional. Called at the start of each recorded frame: append application state you need to restore (e.g. random seed).
+    void                    (*LoadAppStateFunc)(ImGuiReplay* replay, const char* data, int data_size);  // Optional. Called at the start of each replayed frame with data appended by SaveAppStateFunc().
+    void*                   UserData;
+
+    // Replay results
+    int                     HashMismatchCount;      // Number of replayed frames with ImDrawData contents different from recording.
+    int                     FirstHashMismatchFrame; // -1 if none.
+
+    IMGUI_API ImGuiReplay();
+    IMGUI_API ~ImGuiReplay();
+
+    IMGUI_API void          StartRecording();                       // Record frames of current context. Call before NewFrame(), ideally right after CreateContext().
+    IMGUI_API void          StopRecording();
+    IMGUI_API bool          SaveToFile(const char* filename) const;
+    IMGUI_API bool          LoadFromFile(const char* filename);     // Return false if the file can't be read or is not a valid recording.
+    IMGUI_API void          StartReplay();                          // Replay into current context. Call before NewFrame(). Clears io.IniFilename and restores recorded settings and io.ConfigFlags.
+    IMGUI_API void          StopReplay();
+    IMGUI_API void          Clear();
+
+    bool                    IsRecording() const     { return Mode == 1; }
+    bool                    IsReplaying() const     { return Mode == 2; }
+    bool                    IsReplayDone() const    { return ReplayFrameIdx >= FrameOffsets.Size; }
+    int                     GetFramesCount() const  { return FrameOffsets.Size; }
+    int                     GetReplayFrame() const  { return ReplayFrameIdx; }  // Index of next frame to replay.
+
+    // [Internal]
+    ImGuiContext*           Ctx;
+    int                     Mode;                   // 0: none, 1: recording, 2: replaying
+    ImGuiID                 HookIds[2];             // NewFramePre, RenderPost
+    ImVector<char>          Data;                   // File contents
+    ImVector<int>           FrameOffsets;           // Offset of each frame in Data
+    ImU32                   RecordNextEventId;      // Queued events with a lower EventId have been recorded
+    int                     RecordHashOffset;       // Offset of hash of frame being recorded, -1 if none
+    int                     ReplayFrameIdx;
+    ImU32                   ReplayNextEventId;      // Queued events with an EventId >= this were not injected by us
+    ImU32                   ReplayFrameHash;        // Recorded hash of frame being replayed, 0 if none
+};
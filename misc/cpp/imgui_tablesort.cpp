@@ -0,0 +1,252 @@
+// dear imgui: helper to sort large tables on worker threads (C++11 standard library: std::thread, std::atomic)
+// This is an optional helper, it is not used by the core library.
+
+// Changelog:
+// - v0.10: Initial version. Added ImGuiTableSorter.
+
+#include "imgui.h"
+#include "imgui_tablesort.h"
+#include <limits.h>     // INT_MAX
+#include <string.h>     // memcpy
+#include <algorithm>    // std::stable_sort, std::merge
+#include <atomic>
+#include <thread>
+#include <vector>
+
+// Clang warnings with -Weverything
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wsign-conversion"    // warning: implicit conversion changes signedness
+#endif
+
+// A sort in progress. Owned by ImGuiTableSorter, shared with worker threads until Done is set.
+// Everything here is written once by the UI thread before starting the coordinator thread, except for atomics and work buffers.
+struct ImGuiTableSorterJob
+{
+    ImVector<ImGuiTableColumnSortSpecs> Specs;  // Copy of sort specs
+    ImGuiTableSorterKeyFunc KeyFunc;
+    void*                   UserData;
+    int                     ItemsCount;
+    int                     WorkersCount;
+    ImVector<int>           ChunksBounds;       // WorkersCount + 1 boundaries, each worker sorts a contiguous range of items
+    ImVector<double>        Keys;               // ItemsCount * Specs.Size keys, stored per item
+    ImVector<int>           Indices;            // Result
+    ImVector<int>           TempIndices;        // Merge destination
+    std::thread             Coordinator;
+    std::atomic<bool>       Done;
+    std::atomic<bool>       Cancelled;
+    std::atomic<ImS64>      WorkDone;           // Progress, in items processed
+    ImS64                   WorkTotal;
+
+    ImGuiTableSorterJob() : KeyFunc(NULL), UserData(NULL), ItemsCount(0), WorkersCount(0), Done(false), Cancelled(false), WorkDone(0), WorkTotal(0) {}
+};
+
+// Multi-key compare on pre-extracted keys. Ties are left to std::stable_sort()/std::merge() which preserve item order.
+struct ImGuiTableSorterLess
+{
+    const double*                       Keys;
+    const ImGuiTableColumnSortSpecs*    Specs;
+    int                                 SpecsCount;
+
+    bool operator()(int item_a, int item_b) const
+    {
+        const double* keys_a = Keys + (size_t)item_a * SpecsCount;
+        const double* keys_b = Keys + (size_t)item_b * SpecsCount;
+        for (int n = 0; n < SpecsCount; n++)
+            if (keys_a[n] != keys_b[n])
+                return (Specs[n].SortDirection == ImGuiSortDirection_Descending) ? (keys_a[n] > keys_b[n]) : (keys_a[n] < keys_b[n]);
+        return false;
+    }
+};
+
+// Worker: extract keys and sort a contiguous range of items
+static void ImGuiTableSorter_SortChunk(ImGuiTableSorterJob* job, int chunk_n)
+{
+    const int item_begin = job->ChunksBounds[chunk_n];
+    const int item_end = job->ChunksBounds[chunk_n + 1];
+    const int specs_count = job->Specs.Size;
+    const int BATCH_SIZE = 4096; // Check for cancellation and report progress every N items
+    for (int batch_begin = item_begin; batch_begin < item_end; batch_begin += BATCH_SIZE)
+    {
+        if (job->Cancelled.load(std::memory_order_relaxed))
+            return;
+        const int batch_end = (item_end - batch_begin > BATCH_SIZE) ? batch_begin + BATCH_SIZE : item_end;
+        for (int item_n = batch_begin; item_n < batch_end; item_n++)
+        {
+            double* keys = &job->Keys.Data[(size_t)item_n * specs_count];
+            for (int spec_n = 0; spec_n < specs_count; spec_n++)
+                keys[spec_n] = job->KeyFunc(job->UserData, item_n, &job->Specs.Data[spec_n]);
+            job->Indices.Data[item_n] = item_n;
+        }
+        job->WorkDone.fetch_add((batch_end - batch_begin) / 2, std::memory_order_relaxed);
+    }
+    if (job->Cancelled.load(std::memory_order_relaxed))
+        return;
+    ImGuiTableSorterLess less = { job->Keys.Data, job->Specs.Data, specs_count };
+    std::stable_sort(job->Indices.Data + item_begin, job->Indices.Data + item_end, less);
+    job->WorkDone.fetch_add((item_end - item_begin) - (item_end - item_begin) / 2, std::memory_order_relaxed);
+}
+
+// Worker: merge two consecutive sorted ranges [begin,mid) and [mid,end) from src into dst
+static void ImGuiTableSorter_MergeChunks(ImGuiTableSorterJob* job, const int* src, int* dst, int item_begin, int item_mid, int item_end)
+{
+    if (job->Cancelled.load(std::memory_order_relaxed))
+        return;
+    ImGuiTableSorterLess less = { job->Keys.Data, job->Specs.Data, job->Specs.Size };
+    if (item_mid < item_end)
+        std::merge(src + item_begin, src + item_mid, src + item_mid, src + item_end, dst + item_begin, less);
+    else
+        memcpy(dst + item_begin, src + item_begin, (size_t)(item_end - item_begin) * sizeof(int));
+    job->WorkDone.fetch_add(item_end - item_begin, std::memory_order_relaxed);
+}
+
+// Coordinator thread: sort chunks in parallel, then merge them pairwise in parallel, log2(WorkersCount) passes.
+static void ImGuiTableSorter_RunJob(ImGuiTableSorterJob* job)
+{
+    std::vector<std::thread> threads;
+    threads.reserve((size_t)job->WorkersCount);
+
+    // Sort chunks (chunk 0 on this thread)
+    for (int chunk_n = 1; chunk_n < job->WorkersCount; chunk_n++)
+        threads.emplace_back(ImGuiTableSorter_SortChunk, job, chunk_n);
+    ImGuiTableSorter_SortChunk(job, 0);
+    for (std::thread& thread : threads)
+        thread.join();
+    threads.clear();
+
+    // Merge chunks
+    const int* src = job->Indices.Data;
+    int* dst = job->TempIndices.Data;
+    for (int width = 1; width < job->WorkersCount && !job->Cancelled.load(); width *= 2)
+    {
+        for (int chunk_n = 0; chunk_n < job->WorkersCount; chunk_n += width * 2)
+        {
+            const int item_begin = job->ChunksBounds[chunk_n];
+            const int item_mid = job->ChunksBounds[(chunk_n + width < job->WorkersCount) ? chunk_n + width : job->WorkersCount];
+            const int item_end = job->ChunksBounds[(chunk_n + width * 2 < job->WorkersCount) ? chunk_n + width * 2 : job->WorkersCount];
+            threads.emplace_back(ImGuiTableSorter_MergeChunks, job, src, dst, item_begin, item_mid, item_end);
+        }
+        for (std::thread& thread : threads)
+            thread.join();
+        threads.clear();
+        int* tmp = (int*)src; src = dst; dst = tmp;
+    }
+    if (src != job->Indices.Data)
+        job->Indices.swap(job->TempIndices);
+    job->Done.store(true);
+}
+
+ImGuiTableSorter::ImGuiTableSorter()
+{
+    WorkersCount = 0;
+    MinItemsPerWorker = 16384;
+    SortJob = NULL;
+    SortRequested = false;
+    SortedItemsCount = 0;
+}
+
+ImGuiTableSorter::~ImGuiTableSorter()
+{
+    Cancel();
+}
+
+void ImGuiTableSorter::Update(ImGuiTableSortSpecs* sort_specs, int items_count, ImGuiTableSorterKeyFunc key_func, void* user_data)
+{
+    IM_ASSERT(items_count >= 0);
+
+    // Swap in result of completed sort
+    if (SortJob != NULL && SortJob->Done.load())
+    {
+        SortJob->Coordinator.join();
+        Indices.swap(SortJob->Indices);
+        IM_DELETE(SortJob);
+        SortJob = NULL;
+    }
+
+    const bool specs_dirty = (sort_specs != NULL && sort_specs->SpecsDirty);
+    if (!specs_dirty && !SortRequested && items_count == SortedItemsCount)
+        return;
+    if (sort_specs != NULL)
+        sort_specs->SpecsDirty = false;
+    Cancel();
+    SortRequested = false;
+    SortedItemsCount = items_count;
+
+    // Previous permutation may reference items that don't exist anymore
+    if (Indices.Size > items_count)
+        Indices.resize(0);
+
+    // No sort: use identity
+    if (sort_specs == NULL || sort_specs->SpecsCount == 0 || items_count == 0)
+    {
+        Indices.resize(0);
+        return;
+    }
+    IM_ASSERT(key_func != NULL);
+
+    // Keys are stored in a single ImVector, indexed with 'int'
+    const ImS64 keys_count = (ImS64)items_count * sort_specs->SpecsCount;
+    IM_ASSERT(keys_count <= INT_MAX && "Too many items * sort specs.");
+    if (keys_count > INT_MAX)
+    {
+        Indices.resize(0);
+        return;
+    }
+
+    // Setup job
+    ImGuiTableSorterJob* job = IM_NEW(ImGuiTableSorterJob)();
+    job->Specs.resize(sort_specs->SpecsCount);
+    memcpy(job->Specs.Data, sort_specs->Specs, sort_specs->SpecsCount * sizeof(ImGuiTableColumnSortSpecs));
+    job->KeyFunc = key_func;
+    job->UserData = user_data;
+    job->ItemsCount = items_count;
+    int workers_count = (WorkersCount > 0) ? WorkersCount : (int)std::thread::hardware_concurrency();
+    const int workers_needed = items_count / (MinItemsPerWorker > 1 ? MinItemsPerWorker : 1);
+    if (workers_count > workers_needed)
+        workers_count = workers_needed;
+    workers_count = (workers_count < 1) ? 1 : (workers_count > 256) ? 256 : workers_count;
+    job->WorkersCount = workers_count;
+    job->ChunksBounds.resize(workers_count + 1);
+    for (int n = 0; n <= workers_count; n++)
+        job->ChunksBounds[n] = (int)(((ImS64)items_count * n) / workers_count);
+    job->Keys.resize((int)keys_count);
+    job->Indices.resize(items_count);
+    if (workers_count > 1)
+        job->TempIndices.resize(items_count);
+    int merge_passes = 0;
+    for (int width = 1; width < workers_count; width *= 2)
+        merge_passes++;
+    job->WorkTotal = (ImS64)items_count * (1 + merge_passes);
+    job->Coordinator = std::thread(ImGuiTableSorter_RunJob, job);
+    SortJob = job;
+}
+
+void ImGuiTableSorter::Cancel()
+{
+    if (SortJob == NULL)
+        return;
+    SortJob->Cancelled.store(true);
+    SortJob->Coordinator.join();
+    IM_DELETE(SortJob);
+    SortJob = NULL;
+    SortedItemsCount = -1; // Permutation is out of date: sort again on next Update()
+}
+
+void ImGuiTableSorter::Clear()
+{
+    Cancel();
+    Indices.clear();
+    SortedItemsCount = 0;
+}
+
+float ImGuiTableSorter::GetProgress() const
+{
+    if (SortJob == NULL || SortJob->WorkTotal == 0)
+        return 1.0f;
+    const float progress = (float)SortJob->WorkDone.load(std::memory_order_relaxed) / (float)SortJob->WorkTotal;
+    return (progress < 1.0f) ? progress : 1.0f;
+}
+
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,71 @@
+// dear imgui: helper to sort large tables on worker threads (C++11 standard library: std::thread, std::atomic)
+// This is an optional helper, it is not used by the core library.
+
+// Changelog:
+// - v0.10: Initial version. Added ImGuiTableSorter.
+
+// The core library only tells you what to sort (see TableGetSortSpecs()), sorting is left to the application.
+// With millions of rows, doing it on the UI thread (e.g. with qsort) would block for several frames.
+// ImGuiTableSorter:
+// - Extracts keys for each item and each sort spec using your callback, then runs a stable multi-key sort on worker threads.
+// - Outputs an index permutation: row_n -> item_n. Previous permutation is kept and used until the new one is ready.
+// - Never touches the Dear ImGui context from worker threads. Your key callback however runs on worker threads,
+//   so your data must not be modified while IsSorting() returns true (or call Cancel() before modifying it).
+//
+// Usage:
+//   static ImGuiTableSorter sorter;
+//   if (ImGui::BeginTable("table", 3, ImGuiTableFlags_Sortable | ImGuiTableFlags_ScrollY))
+//   {
+//       ImGui::TableSetupColumn(...);                         // xN
+//       ImGui::TableHeadersRow();
+//       sorter.Update(ImGui::TableGetSortSpecs(), items_count, MyGetSortKey, &my_data);
+//       ImGuiListClipper clipper;
+//       clipper.Begin(items_count);
+//       while (clipper.Step())
+//           for (int row_n = clipper.DisplayStart; row_n < clipper.DisplayEnd; row_n++)
+//           {
+//               MyItem* item = &my_data.Items[sorter.GetItemIndex(row_n)];
+//               ...
+//           }
+//       ImGui::EndTable();
+//   }
+//   if (sorter.IsSorting())
+//       ImGui::ProgressBar(sorter.GetProgress(), ImVec2(-FLT_MIN, 0.0f), "Sorting...");
+
+#pragma once
+
+// Return sort key for a given item and column. Called from worker threads!
+// Keys are compared as double, which is exact for integers up to 2^53. Strings needs to be mapped to a rank ahead.
+typedef double (*ImGuiTableSorterKeyFunc)(void* user_data, int item_index, const ImGuiTableColumnSortSpecs* column_spec);
+
+struct ImGuiTableSorterJob;
+
+struct ImGuiTableSorter
+{
+    // Output (front buffer, owned by the UI thread)
+    ImVector<int>       Indices;            // Last completed permutation (row_n -> item_n). May be smaller than items_count while a sort is pending, in which case GetItemIndex() returns identity for extra rows.
+
+    // Options
+    int                 WorkersCount;       // Number of threads used by a sort. Default to 0: std::thread::hardware_concurrency().
+    int                 MinItemsPerWorker;  // Don't spawn more workers than needed for small data sets. Default to 16384.
+
+    IMGUI_API ImGuiTableSorter();
+    IMGUI_API ~ImGuiTableSorter();
+
+    // Call every frame after TableHeadersRow() (or any point after TableSetupColumn() calls).
+    // - Polls and swaps in results of a completed sort.
+    // - Starts a new sort (cancelling any sort in progress) when sort specs are dirty, items_count changed, or RequestSort() was called.
+    // - Clears sort_specs->SpecsDirty for you.
+    IMGUI_API void      Update(ImGuiTableSortSpecs* sort_specs, int items_count, ImGuiTableSorterKeyFunc key_func, void* user_data);
+    void                RequestSort()               { SortRequested = true; }   // Data changed: sort again on next Update() call.
+    IMGUI_API void      Cancel();                                               // Cancel sort in progress and wait for workers to return. Previous permutation stays.
+    IMGUI_API void      Clear();                                                // Cancel and free all memory.
+    bool                IsSorting() const           { return SortJob != NULL; }
+    IMGUI_API float     GetProgress() const;                                    // 0.0f..1.0f, when IsSorting() == true
+    int                 GetItemIndex(int row_n) const { return (row_n < Indices.Size) ? Indices.Data[row_n] : row_n; }
+
+    // [Internal]
+    ImGuiTableSorterJob* SortJob;           // Sort in progress, if any
+    bool                SortRequested;
+    int                 SortedItemsCount;   // items_count passed to the last sort we started
+};
@@ -0,0 +1,115 @@
+// dear imgui: helper to filter large lists of items with ImGuiTextFilter on worker threads (C++11 standard library: std::thread)
+// This is an optional helper, it is not used by the core library.
+
+// Changelog:
+// - v0.10: Initial version. Added ImGui::FilterItems().
+
+#include "imgui.h"
+#include "imgui_textfilter.h"
+#include <string.h>     // memmove
+#include <thread>
+
+// Clang warnings with -Weverything
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wsign-conversion"    // warning: implicit conversion changes signedness
+#endif
+
+#define IMGUI_FILTER_ITEMS_MIN_PER_WORKER   16384
+
+// Each worker filters items [ItemBegin, ItemEnd) and writes passing indices at the beginning of the same range of the output array.
+struct ImGuiFilterItemsChunk
+{
+    const ImGuiTextFilter*      Filter;
+    ImGuiFilterItemsGetTextFunc GetText;
+    void*                       UserData;
+    int                         ItemBegin;
+    int                         ItemEnd;
+    int*                        Out;            // Output for this chunk (room for ItemEnd - ItemBegin indices)
+    int                         OutCount;
+};
+
+static void ImGuiFilterItems_RunChunk(ImGuiFilterItemsChunk* chunk)
+{
+    int out_count = 0;
+    for (int item_n = chunk->ItemBegin; item_n < chunk->ItemEnd; item_n++)
+    {
+        const char* text_end = NULL;
+        const char* text = chunk->GetText(chunk->UserData, item_n, &text_end);
+        if (chunk->Filter->PassFilter(text, text_end))
+            chunk->Out[out_count++] = item_n;
+    }
+    chunk->OutCount = out_count;
+}
+
+static const char* ImGuiFilterItems_ArrayGetter(void* user_data, int item_index, const char** out_text_end)
+{
+    IM_UNUSED(out_text_end);
+    return ((const char* const*)user_data)[item_index];
+}
+
+int ImGui::FilterItems(const ImGuiTextFilter* filter, int items_count, ImGuiFilterItemsGetTextFunc get_text, void* user_data, ImVector<int>* out_indices, int workers_count)
+{
+    IM_ASSERT(filter != NULL && out_indices != NULL && items_count >= 0);
+    out_indices->resize(items_count);
+    if (!filter->IsActive())
+    {
+        for (int n = 0; n < items_count; n++)
+            out_indices->Data[n] = n;
+        return items_count;
+    }
+    IM_ASSERT(get_text != NULL);
+
+    if (workers_count <= 0)
+        workers_count = (int)std::thread::hardware_concurrency();
+    const int workers_needed = items_count / IMGUI_FILTER_ITEMS_MIN_PER_WORKER;
+    if (workers_count > workers_needed)
+        workers_count = workers_needed;
+    workers_count = (workers_count < 1) ? 1 : (workers_count > 256) ? 256 : workers_count;
+
+    // Setup chunks (all allocations are made on this thread)
+    ImVector<ImGuiFilterItemsChunk> chunks;
+    chunks.resize(workers_count);
+    for (int n = 0; n < workers_count; n++)
+    {
+        ImGuiFilterItemsChunk& chunk = chunks[n];
+        chunk.Filter = filter;
+        chunk.GetText = get_text;
+        chunk.UserData = user_data;
+        chunk.ItemBegin = (int)(((ImS64)items_count * n) / workers_count);
+        chunk.ItemEnd = (int)(((ImS64)items_count * (n + 1)) / workers_count);
+        chunk.Out = out_indices->Data + chunk.ItemBegin;
+        chunk.OutCount = 0;
+    }
+
+    // Run first chunk on this thread
+    ImVector<std::thread*> threads;
+    threads.resize(workers_count - 1);
+    for (int n = 1; n < workers_count; n++)
+        threads[n - 1] = IM_NEW(std::thread)(ImGuiFilterItems_RunChunk, &chunks[n]);
+    ImGuiFilterItems_RunChunk(&chunks[0]);
+    for (std::thread* thread : threads)
+    {
+        thread->join();
+        IM_DELETE(thread);
+    }
+
+    // Compact outputs of all chunks
+    int out_count = chunks[0].OutCount;
+    for (int n = 1; n < workers_count; n++)
+    {
+        memmove(out_indices->Data + out_count, chunks[n].Out, (size_t)chunks[n].OutCount * sizeof(int));
+        out_count += chunks[n].OutCount;
+    }
+    out_indices->resize(out_count);
+    return out_count;
+}
+
+int ImGui::FilterItems(const ImGuiTextFilter* filter, const char* const* items, int items_count, ImVector<int>* out_indices, int workers_count)
+{
+    return FilterItems(filter, items_count, &ImGuiFilterItems_ArrayGetter, (void*)items, out_indices, workers_count);
+}
+
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
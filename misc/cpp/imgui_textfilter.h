@@ -0,0 +1,37 @@
+// dear imgui: helper to filter large lists of items with ImGuiTextFilter on worker threads (C++11 standard library: std::thread)
+// This is an optional helper, it is not used by the core library.
+
+// Changelog:
+// - v0.10: Initial version. Added ImGui::FilterItems().
+
+// Calling ImGuiTextFilter::PassFilter() on every item each frame is fine for thousands of items, but with millions of items
+// (e.g. lines of a log) filtering needs to be done once when the filter changes, and the result used with ImGuiListClipper.
+// ImGui::FilterItems():
+// - Applies a filter to all items, split in contiguous chunks over worker threads, and blocks until all workers are done.
+// - Outputs indices of items passing the filter, in increasing order. When the filter is not active, outputs all indices.
+// - Never touches the Dear ImGui context (nor allocates memory) from worker threads. Your get_text callback however
+//   runs on worker threads, and your items must not be modified during the call.
+//
+// Usage:
+//   static ImGuiTextFilter filter;
+//   static ImVector<int> filtered;
+//   if (filter.Draw() || lines_count_changed)
+//       ImGui::FilterItems(&filter, lines_count, MyGetLineText, &my_log, &filtered);
+//   ImGuiListClipper clipper;
+//   clipper.Begin(filtered.Size);
+//   while (clipper.Step())
+//       for (int row_n = clipper.DisplayStart; row_n < clipper.DisplayEnd; row_n++)
+//           ImGui::TextUnformatted(...my_log line filtered[row_n]...);
+
+#pragma once
+
+// Return text of a given item, and optionally set *out_text_end (otherwise text is zero-terminated). Called from worker threads!
+typedef const char* (*ImGuiFilterItemsGetTextFunc)(void* user_data, int item_index, const char** out_text_end);
+
+namespace ImGui
+{
+    // Return number of items passing the filter (== out_indices->Size).
+    // workers_count = 0: use std::thread::hardware_concurrency(), but don't spawn more workers than 1 every 16384 items.
+    IMGUI_API int       FilterItems(const ImGuiTextFilter* filter, int items_count, ImGuiFilterItemsGetTextFunc get_text, void* user_data, ImVector<int>* out_indices, int workers_count = 0);
+    IMGUI_API int       FilterItems(const ImGuiTextFilter* filter, const char* const* items, int items_count, ImVector<int>* out_indices, int workers_count = 0);
+}